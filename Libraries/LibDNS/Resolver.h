@@ -6,9 +6,13 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/CountingStream.h>
 #include <AK/HashTable.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
 #include <AK/MaybeOwned.h>
 #include <AK/MemoryStream.h>
 #include <AK/QuickSort.h>
@@ -107,11 +111,64 @@ public:
 
     void add_record(Messages::ResourceRecord record)
     {
-        m_valid = true;
         auto expiration = record.ttl > 0 ? Optional<AK::UnixDateTime>(AK::UnixDateTime::now() + AK::Duration::from_seconds(record.ttl)) : OptionalNone();
+        add_record(move(record), move(expiration));
+    }
+
+    void add_record(Messages::ResourceRecord record, Optional<AK::UnixDateTime> expiration)
+    {
+        m_valid = true;
         m_cached_records.append({ move(record), move(expiration) });
     }
 
+    struct RecordWithExpiration {
+        Messages::ResourceRecord record;
+        Optional<AK::UnixDateTime> expiration;
+    };
+
+    Vector<RecordWithExpiration> const& records_with_expiration() const { return m_cached_records; }
+
+    // The time at which the first of the records expires, if any of them do.
+    Optional<AK::UnixDateTime> expiration() const
+    {
+        Optional<AK::UnixDateTime> result;
+        for (auto const& re : m_cached_records) {
+            if (re.expiration.has_value() && (!result.has_value() || re.expiration.value() < result.value()))
+                result = re.expiration;
+        }
+        return result;
+    }
+
+    bool has_expired_records(AK::UnixDateTime now) const
+    {
+        auto expiration = this->expiration();
+        return expiration.has_value() && expiration.value() < now;
+    }
+
+    // Whether the first record to expire has less than a tenth of its time to live left.
+    bool is_about_to_expire(AK::UnixDateTime now) const
+    {
+        for (auto const& re : m_cached_records) {
+            if (re.expiration.has_value() && re.expiration.value() - now < AK::Duration::from_milliseconds(static_cast<i64>(re.record.ttl) * 100))
+                return true;
+        }
+        return false;
+    }
+
+    // Bookkeeping for the resolver's cache. These don't change the result, so they can be updated on a const result.
+    void did_use() const
+    {
+        ++m_use_count;
+        m_last_use_time = AK::MonotonicTime::now_coarse();
+    }
+    u32 use_count() const { return m_use_count; }
+    AK::MonotonicTime last_use_time() const { return m_last_use_time; }
+
+    bool is_being_refreshed() const { return m_is_being_refreshed; }
+    void set_being_refreshed(bool value) { m_is_being_refreshed = value; }
+
+    HashTable<Messages::ResourceType> const& desired_types() const { return m_desired_types; }
+
     Vector<Messages::ResourceRecord> records() const
     {
         Vector<Messages::ResourceRecord> result;
@@ -189,18 +246,17 @@ private:
     bool m_request_done { false };
     bool m_dnssec_validated { false };
     bool m_being_dnssec_validated { false };
+    bool m_is_being_refreshed { false };
     Messages::DomainName m_name;
 
-    struct RecordWithExpiration {
-        Messages::ResourceRecord record;
-        Optional<AK::UnixDateTime> expiration;
-    };
-
     Vector<RecordWithExpiration> m_cached_records;
     HashTable<Messages::ResourceType> m_desired_types;
     Vector<Messages::Records::DNSKEY> m_used_dnskeys {};
     HashTable<u16> m_seen_key_tags;
     u16 m_id { 0 };
+
+    mutable u32 m_use_count { 0 };
+    mutable AK::MonotonicTime m_last_use_time { AK::MonotonicTime::now_coarse() };
 };
 
 class Resolver {
@@ -223,6 +279,8 @@ public:
     struct LookupOptions {
         bool validate_dnssec_locally { false };
         PendingLookup* repeating_lookup { nullptr };
+        // Refreshes of cache entries always ask the server, and don't count towards the cache statistics.
+        bool is_refresh { false };
 
         static LookupOptions default_() { return {}; }
     };
@@ -232,6 +290,30 @@ public:
         ConnectionMode mode;
     };
 
+    struct CacheStatistics {
+        u64 hits { 0 };
+        u64 stale_hits { 0 };
+        u64 misses { 0 };
+        u64 refreshes { 0 };
+
+        double hit_rate() const
+        {
+            auto lookups = hits + stale_hits + misses;
+            if (lookups == 0)
+                return 0;
+            return static_cast<double>(hits + stale_hits) / static_cast<double>(lookups);
+        }
+    };
+
+    // The cache holds at most this many entries. The least recently used entries are evicted to make room for new ones.
+    static constexpr size_t max_cache_entry_count = 1024;
+
+    // Entries that have expired are kept for this long, and are still served while they are being refreshed.
+    static constexpr AK::Duration max_stale_duration = AK::Duration::from_seconds(24 * 60 * 60);
+
+    // Entries that have been used this many times are refreshed in the background once they are about to expire.
+    static constexpr u32 popular_entry_use_count = 3;
+
     Resolver(Function<ErrorOr<SocketResult>()> create_socket)
         : m_pending_lookups(make<RedBlackTree<u16, PendingLookup>>())
         , m_create_socket(move(create_socket))
@@ -273,6 +355,153 @@ public:
         m_socket.with_write_locked([&](auto& socket) { socket = {}; });
     }
 
+    CacheStatistics cache_statistics() const
+    {
+        return {
+            .hits = m_cache_hits.load(),
+            .stale_hits = m_cache_stale_hits.load(),
+            .misses = m_cache_misses.load(),
+            .refreshes = m_cache_refreshes.load(),
+        };
+    }
+
+    // Serializes the address records in the cache, along with their expiration times, so that a later process can
+    // pick them up again with load_cache().
+    String serialize_cache()
+    {
+        flush_cache();
+
+        JsonArray entries;
+        HashTable<ByteString> serialized_names;
+
+        auto serialize_entries = [&](HashMap<ByteString, NonnullRefPtr<LookupResult>> const& cache) {
+            for (auto const& [name, result] : cache) {
+                if (!result->is_done() || serialized_names.contains(name))
+                    continue;
+
+                JsonArray records;
+                for (auto const& re : result->records_with_expiration()) {
+                    if (!re.expiration.has_value())
+                        continue;
+
+                    auto address = re.record.record.visit(
+                        [](Messages::Records::A const& a) -> Optional<String> { return MUST(a.address.to_string()); },
+                        [](Messages::Records::AAAA const& aaaa) -> Optional<String> { return MUST(aaaa.address.to_string()); },
+                        [](auto const&) -> Optional<String> { return {}; });
+                    if (!address.has_value())
+                        continue;
+
+                    JsonObject record;
+                    record.set("type"sv, to_underlying(re.record.type));
+                    record.set("ttl"sv, re.record.ttl);
+                    record.set("expiration"sv, re.expiration->seconds_since_epoch());
+                    record.set("address"sv, address.release_value());
+                    MUST(records.append(move(record)));
+                }
+
+                if (records.is_empty())
+                    continue;
+
+                JsonArray types;
+                for (auto type : result->desired_types())
+                    MUST(types.append(to_underlying(type)));
+
+                JsonObject entry;
+                entry.set("name"sv, MUST(String::from_byte_string(name)));
+                entry.set("types"sv, move(types));
+                entry.set("records"sv, move(records));
+                MUST(entries.append(move(entry)));
+
+                serialized_names.set(name);
+            }
+        };
+
+        m_cache.with_read_locked(serialize_entries);
+        m_stale_cache.with_read_locked(serialize_entries);
+
+        return entries.serialized();
+    }
+
+    // Adds the entries serialized by serialize_cache() to the cache. Entries that have expired too long ago are dropped.
+    // NOTE: Loaded entries are never considered to be DNSSEC validated.
+    void load_cache(StringView serialized_cache)
+    {
+        auto json = JsonValue::from_string(serialized_cache);
+        if (json.is_error() || !json.value().is_array()) {
+            dbgln("DNS: Ignoring malformed cache");
+            return;
+        }
+
+        auto now = AK::UnixDateTime::now();
+
+        json.value().as_array().for_each([&](JsonValue const& value) {
+            if (!value.is_object())
+                return;
+
+            auto const& entry = value.as_object();
+            auto name = entry.get_string("name"sv);
+            auto records = entry.get_array("records"sv);
+            if (!name.has_value() || !records.has_value())
+                return;
+
+            auto result = make_ref_counted<LookupResult>(Messages::DomainName::from_string(*name));
+
+            if (auto types = entry.get_array("types"sv); types.has_value()) {
+                types->for_each([&](JsonValue const& type) {
+                    if (auto type_value = type.get_u32(); type_value.has_value())
+                        result->will_add_record_of_type(static_cast<Messages::ResourceType>(*type_value));
+                });
+            }
+
+            records->for_each([&](JsonValue const& value) {
+                if (!value.is_object())
+                    return;
+
+                auto const& record = value.as_object();
+                auto type = record.get_u32("type"sv);
+                auto ttl = record.get_u32("ttl"sv);
+                auto expiration = record.get_i64("expiration"sv);
+                auto address = record.get_string("address"sv);
+                if (!type.has_value() || !ttl.has_value() || !expiration.has_value() || !address.has_value())
+                    return;
+
+                auto add_record = [&](Messages::ResourceType type, Messages::Record record) {
+                    result->add_record({ .name = {}, .type = type, .class_ = Messages::Class::IN, .ttl = *ttl, .record = move(record), .raw = {} }, AK::UnixDateTime::from_seconds_since_epoch(*expiration));
+                };
+
+                if (*type == to_underlying(Messages::ResourceType::A)) {
+                    if (auto ipv4 = IPv4Address::from_string(*address); ipv4.has_value())
+                        add_record(Messages::ResourceType::A, Messages::Records::A { *ipv4 });
+                } else if (*type == to_underlying(Messages::ResourceType::AAAA)) {
+                    if (auto ipv6 = IPv6Address::from_string(*address); ipv6.has_value())
+                        add_record(Messages::ResourceType::AAAA, Messages::Records::AAAA { *ipv6 });
+                }
+            });
+
+            result->finished_request();
+
+            auto expiration = result->expiration();
+            if (!expiration.has_value())
+                return;
+
+            auto key = name->to_byte_string();
+
+            if (expiration.value() > now) {
+                m_cache.with_write_locked([&](auto& cache) {
+                    if (cache.contains(key) || cache.size() >= max_cache_entry_count)
+                        return;
+                    cache.set(key, result);
+                });
+            } else if (now - expiration.value() <= max_stale_duration) {
+                m_stale_cache.with_write_locked([&](auto& stale_cache) {
+                    if (stale_cache.contains(key) || stale_cache.size() >= max_cache_entry_count)
+                        return;
+                    stale_cache.set(key, result);
+                });
+            }
+        });
+    }
+
     NonnullRefPtr<LookupResult const> expect_cached(StringView name, Messages::Class class_ = Messages::Class::IN)
     {
         return expect_cached(name, class_, Array { Messages::ResourceType::A, Messages::ResourceType::AAAA });
@@ -386,12 +615,24 @@ public:
             dbgln_if(DNS_DEBUG, "DNS: Resolving {} from cache...", name);
             if (!options.validate_dnssec_locally || result->is_dnssec_validated()) {
                 dbgln_if(DNS_DEBUG, "DNS: Resolved {} from cache", name);
+                did_use_cached_result(name, class_, desired_types, options, *result);
                 promise->resolve(result.release_nonnull());
                 return promise;
             }
             dbgln_if(DNS_DEBUG, "DNS: Cache entry for {} is not DNSSEC validated (and we expect that), re-resolving", name);
         }
 
+        // Serve an expired result while the name is being resolved again, rather than waiting for the server.
+        if (!options.is_refresh) {
+            if (auto result = lookup_in_stale_cache(name, desired_types); result && (!options.validate_dnssec_locally || result->is_dnssec_validated())) {
+                dbgln_if(DNS_DEBUG, "DNS: Resolved {} from stale cache, refreshing", name);
+                ++m_cache_stale_hits;
+                refresh(name, class_, desired_types, options);
+                promise->resolve(result.release_nonnull());
+                return promise;
+            }
+        }
+
         auto domain_name = Messages::DomainName::from_string(name);
 
         if (!has_connection()) {
@@ -456,6 +697,9 @@ public:
             }
 
             dbgln_if(DNS_DEBUG, "DNS: Adding {} to cache", name);
+            if (cache.size() >= max_cache_entry_count)
+                evict_least_recently_used_entry(cache);
+
             auto ptr = make_ref_counted<LookupResult>(domain_name);
             if (!ptr->is_dnssec_validated())
                 ptr->set_dnssec_validated(options.validate_dnssec_locally);
@@ -481,11 +725,15 @@ public:
             // Something has gone wrong if there are no pending lookups but the result isn't done.
             // Continue on and hope that we eventually resolve or timeout in that case.
             if (result->is_done()) {
+                did_use_cached_result(name, class_, desired_types, options, *result);
                 promise->resolve(*result);
                 return promise;
             }
         }
 
+        if (!options.is_refresh && !options.repeating_lookup)
+            ++m_cache_misses;
+
         Messages::Message query;
         if (cached_result_id.has_value()) {
             query.header.id = cached_result_id.value();
@@ -556,7 +804,7 @@ public:
                   p->repeat_timer->set_single_shot(true);
                   p->repeat_timer->set_interval(1000);
                   p->repeat_timer->on_timeout = [=, this] {
-                      (void)lookup(name, class_, desired_types, { .validate_dnssec_locally = options.validate_dnssec_locally, .repeating_lookup = p });
+                      (void)lookup(name, class_, desired_types, { .validate_dnssec_locally = options.validate_dnssec_locally, .repeating_lookup = p, .is_refresh = options.is_refresh });
                   };
 
                   return nullptr;
@@ -1189,9 +1437,21 @@ private:
 
     void flush_cache()
     {
+        auto now = AK::UnixDateTime::now();
+        Vector<NonnullRefPtr<LookupResult>> newly_stale_results;
+        Vector<ByteString> newly_stale_names;
+
         m_cache.with_write_locked([&](auto& cache) {
             HashTable<ByteString> to_remove;
             for (auto& entry : cache) {
+                // Expired results are moved to the stale cache as a whole, rather than dropping their expired records.
+                if (entry.value->is_done() && entry.value->has_expired_records(now)) {
+                    newly_stale_names.append(entry.key);
+                    newly_stale_results.append(entry.value);
+                    to_remove.set(entry.key);
+                    continue;
+                }
+
                 entry.value->check_expiration();
                 if (entry.value->can_be_removed())
                     to_remove.set(entry.key);
@@ -1199,9 +1459,118 @@ private:
             for (auto const& key : to_remove)
                 cache.remove(key);
         });
+
+        m_stale_cache.with_write_locked([&](auto& stale_cache) {
+            for (size_t i = 0; i < newly_stale_names.size(); ++i) {
+                if (!stale_cache.contains(newly_stale_names[i]) && stale_cache.size() >= max_cache_entry_count)
+                    evict_least_recently_used_entry(stale_cache);
+                stale_cache.set(newly_stale_names[i], newly_stale_results[i]);
+            }
+
+            stale_cache.remove_all_matching([&](auto const&, auto const& result) {
+                auto expiration = result->expiration();
+                return !result->is_being_refreshed() && (!expiration.has_value() || now - expiration.value() > max_stale_duration);
+            });
+        });
+    }
+
+    RefPtr<LookupResult const> lookup_in_stale_cache(StringView name, Span<Messages::ResourceType const> desired_types)
+    {
+        return m_stale_cache.with_read_locked([&](auto& stale_cache) -> RefPtr<LookupResult const> {
+            auto it = stale_cache.find(name);
+            if (it == stale_cache.end())
+                return {};
+
+            // NOTE: A name may not have records of every type we ask for, so any one of them will do.
+            for (auto const& type : desired_types) {
+                if (it->value->has_record_of_type(type))
+                    return it->value;
+            }
+
+            return {};
+        });
+    }
+
+    static void evict_least_recently_used_entry(HashMap<ByteString, NonnullRefPtr<LookupResult>>& cache)
+    {
+        Optional<ByteString> least_recently_used_name;
+        AK::MonotonicTime least_recent_use_time = AK::MonotonicTime::now_coarse();
+
+        for (auto const& [name, result] : cache) {
+            if (!result->is_done() || result->is_being_refreshed())
+                continue;
+            if (!least_recently_used_name.has_value() || result->last_use_time() < least_recent_use_time) {
+                least_recently_used_name = name;
+                least_recent_use_time = result->last_use_time();
+            }
+        }
+
+        if (least_recently_used_name.has_value())
+            cache.remove(*least_recently_used_name);
+    }
+
+    void did_use_cached_result(ByteString const& name, Messages::Class class_, Vector<Messages::ResourceType> const& desired_types, LookupOptions const& options, LookupResult const& result)
+    {
+        if (options.is_refresh)
+            return;
+
+        ++m_cache_hits;
+        result.did_use();
+
+        // Popular names are resolved again before they expire, so that they never have to wait for the server.
+        if (result.use_count() >= popular_entry_use_count && result.is_about_to_expire(AK::UnixDateTime::now()))
+            refresh(name, class_, desired_types, options);
+    }
+
+    // Resolves name again in the background. Until that is done, the current result is served from the stale cache.
+    void refresh(ByteString const& name, Messages::Class class_, Vector<Messages::ResourceType> const& desired_types, LookupOptions const& options)
+    {
+        auto current_result = m_cache.with_write_locked([&](auto& cache) -> RefPtr<LookupResult> {
+            auto it = cache.find(name);
+            if (it == cache.end() || !it->value->is_done())
+                return nullptr;
+
+            auto result = it->value;
+            cache.remove(it);
+            return result;
+        });
+
+        current_result = m_stale_cache.with_write_locked([&](auto& stale_cache) -> RefPtr<LookupResult> {
+            if (current_result) {
+                stale_cache.set(name, *current_result);
+                return current_result;
+            }
+            if (auto result = stale_cache.get(name); result.has_value())
+                return *result;
+            return nullptr;
+        });
+
+        if (!current_result || current_result->is_being_refreshed())
+            return;
+
+        dbgln_if(DNS_DEBUG, "DNS: Refreshing {}", name);
+        current_result->set_being_refreshed(true);
+        ++m_cache_refreshes;
+
+        lookup(name, class_, desired_types, { .validate_dnssec_locally = options.validate_dnssec_locally, .is_refresh = true })
+            ->when_resolved([this, name, current_result](auto const&) {
+                m_stale_cache.with_write_locked([&](auto& stale_cache) {
+                    if (auto result = stale_cache.get(name); result.has_value() && *result == current_result.ptr())
+                        stale_cache.remove(name);
+                });
+            })
+            .when_rejected([current_result](auto const& error) {
+                dbgln_if(DNS_DEBUG, "DNS: Failed to refresh {}: {}", current_result->name().to_string(), error);
+                current_result->set_being_refreshed(false);
+            });
     }
 
     Threading::RWLockProtected<HashMap<ByteString, NonnullRefPtr<LookupResult>>> m_cache;
+    Threading::RWLockProtected<HashMap<ByteString, NonnullRefPtr<LookupResult>>> m_stale_cache;
+    Atomic<u64> m_cache_hits { 0 };
+    Atomic<u64> m_cache_stale_hits { 0 };
+    Atomic<u64> m_cache_misses { 0 };
+    Atomic<u64> m_cache_refreshes { 0 };
     Threading::RWLockProtected<NonnullOwnPtr<RedBlackTree<u16, PendingLookup>>> m_pending_lookups;
     Threading::RWLockProtected<Optional<MaybeOwned<Core::Socket>>> m_socket;
     Function<ErrorOr<SocketResult>()> m_create_socket;
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <LibDevTools/Actors/PerfActor.h>
+#include <LibDevTools/Actors/TabActor.h>
+#include <LibDevTools/DevToolsDelegate.h>
+#include <LibDevTools/DevToolsServer.h>
+
+namespace DevTools {
+
+NonnullRefPtr<PerfActor> PerfActor::create(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+{
+    return adopt_ref(*new PerfActor(devtools, move(name), move(tab)));
+}
+
+PerfActor::PerfActor(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+    : Actor(devtools, move(name))
+    , m_tab(move(tab))
+{
+}
+
+PerfActor::~PerfActor()
+{
+    if (!m_is_active)
+        return;
+    if (auto tab = m_tab.strong_ref())
+        devtools().delegate().stop_js_profiler(tab->description(), [](auto) { });
+}
+
+void PerfActor::handle_message(Message const& message)
+{
+    JsonObject response;
+
+    if (message.type == "isActive"sv) {
+        response.set("isActive"sv, m_is_active);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "startProfiler"sv) {
+        if (auto tab = m_tab.strong_ref(); tab && !m_is_active) {
+            devtools().delegate().start_js_profiler(tab->description());
+            m_is_active = true;
+        }
+
+        response.set("value"sv, m_is_active);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "stopProfilerAndDiscardProfile"sv) {
+        if (auto tab = m_tab.strong_ref(); tab && m_is_active)
+            devtools().delegate().stop_js_profiler(tab->description(), [](auto) { });
+
+        m_is_active = false;
+        send_response(message, move(response));
+        return;
+    }
+
+    // NOTE: The profile is in the Gecko profile format, which Firefox DevTools opens in the Firefox Profiler.
+    if (message.type == "getProfileAndStopProfiler"sv) {
+        auto tab = m_tab.strong_ref();
+        if (!tab || !m_is_active) {
+            response.set("profile"sv, JsonValue {});
+            send_response(message, move(response));
+            return;
+        }
+
+        m_is_active = false;
+
+        // NOTE: Responses are sent in the order in which their requests were received, so we must reply even if the
+        //       profile could not be retrieved. Otherwise, none of the replies to later requests would ever be sent.
+        devtools().delegate().stop_js_profiler(tab->description(),
+            [weak_self = make_weak_ptr<PerfActor>(), message_id = message.id](ErrorOr<JsonValue> profile) {
+                auto self = weak_self.strong_ref();
+                if (!self)
+                    return;
+
+                JsonObject response;
+
+                if (profile.is_error()) {
+                    response.set("error"sv, "unknownError"sv);
+                    response.set("message"sv, MUST(String::formatted("Unable to retrieve the profile: {}", profile.error())));
+                } else {
+                    response.set("profile"sv, profile.release_value());
+                }
+
+                self->send_response({ .id = message_id }, move(response));
+            });
+
+        return;
+    }
+
+    send_unrecognized_packet_type_error(message);
+}
+
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <LibDevTools/Actor.h>
+
+namespace DevTools {
+
+class PerfActor final : public Actor {
+public:
+    static constexpr auto base_name = "perf"sv;
+
+    static NonnullRefPtr<PerfActor> create(DevToolsServer&, String name, WeakPtr<TabActor>);
+    virtual ~PerfActor() override;
+
+private:
+    PerfActor(DevToolsServer&, String name, WeakPtr<TabActor>);
+
+    virtual void handle_message(Message const&) override;
+
+    WeakPtr<TabActor> m_tab;
+    bool m_is_active { false };
+};
+
+}
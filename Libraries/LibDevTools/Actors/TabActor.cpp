@@ -5,6 +5,7 @@
  */
 
 #include <AK/JsonObject.h>
+#include <LibDevTools/Actors/PerfActor.h>
 #include <LibDevTools/Actors/TabActor.h>
 #include <LibDevTools/Actors/WatcherActor.h>
 #include <LibDevTools/DevToolsDelegate.h>
@@ -50,6 +51,16 @@ void TabActor::handle_message(Message const& message)
         return;
     }
 
+    // NOTE: Firefox DevTools has a single, browser-wide perf actor. We profile the JavaScript of one tab instead.
+    if (message.type == "getPerfActor"sv) {
+        if (!m_perf)
+            m_perf = devtools().register_actor<PerfActor>(this);
+
+        response.set("actor"sv, m_perf->name());
+        send_response(message, move(response));
+        return;
+    }
+
     send_unrecognized_packet_type_error(message);
 }
 
@@ -37,6 +37,7 @@ private:
 
     TabDescription m_description;
     WeakPtr<WatcherActor> m_watcher;
+    WeakPtr<PerfActor> m_perf;
 };
 
 }
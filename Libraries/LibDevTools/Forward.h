@@ -21,6 +21,7 @@ class InspectorActor;
 class LayoutInspectorActor;
 class NodeActor;
 class PageStyleActor;
+class PerfActor;
 class PreferenceActor;
 class ProcessActor;
 class RootActor;
@@ -58,6 +58,8 @@ void Heap::will_allocate(size_t size)
     }
 
     m_allocated_bytes_since_last_gc += size;
+    ++m_statistics.allocated_cells;
+    m_statistics.allocated_bytes += size;
 }
 
 static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
@@ -253,12 +255,17 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
                 m_should_gc_when_deferral_ends = true;
                 return;
             }
+            auto marking_start_time = MonotonicTime::now();
             HashMap<Cell*, HeapRoot> roots;
             gather_roots(roots);
             mark_live_cells(roots);
+            m_statistics.time_spent_marking += MonotonicTime::now() - marking_start_time;
         }
+        auto sweeping_start_time = MonotonicTime::now();
         finalize_unmarked_cells();
         sweep_dead_cells(print_report, collection_measurement_timer);
+        m_statistics.time_spent_sweeping += MonotonicTime::now() - sweeping_start_time;
+        ++m_statistics.collections;
     }
 
     auto tasks = move(m_post_gc_tasks);
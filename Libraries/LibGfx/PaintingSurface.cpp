@@ -154,6 +154,39 @@ PaintingSurface::~PaintingSurface()
     unlock_context();
 }
 
+RefPtr<PaintingSurface> PaintingSurface::create_view_for_region(IntRect region)
+{
+    auto bitmap = m_impl->bitmap;
+    if (!bitmap)
+        return nullptr;
+
+    region.intersect(rect());
+    if (region.is_empty())
+        return nullptr;
+
+    // Any outstanding image snapshot has to be detached from the pixels before we start writing to them behind
+    // the back of the SkSurface that owns them.
+    m_impl->surface->notifyContentWillChange(SkSurface::kRetain_ContentChangeMode);
+
+    auto image_info = m_impl->surface->imageInfo().makeWH(region.width(), region.height());
+    auto* pixels = bitmap->scanline(region.y()) + region.x();
+    auto surface = SkSurfaces::WrapPixels(image_info, pixels, bitmap->pitch());
+    VERIFY(surface);
+    surface->getCanvas()->translate(-region.x(), -region.y());
+    return adopt_ref(*new PaintingSurface(make<Impl>(RefPtr<SkiaBackendContext> {}, region.size(), surface, bitmap)));
+}
+
+bool PaintingSurface::copy_pixels_from(PaintingSurface const& source, IntPoint offset)
+{
+    auto const& source_bitmap = source.m_impl->bitmap;
+    if (!m_impl->bitmap || !source_bitmap)
+        return false;
+
+    SkPixmap const pixmap(source.m_impl->surface->imageInfo(), source_bitmap->begin(), source_bitmap->pitch());
+    m_impl->surface->writePixels(pixmap, offset.x(), offset.y());
+    return true;
+}
+
 void PaintingSurface::read_into_bitmap(Bitmap& bitmap)
 {
     auto color_type = to_skia_color_type(bitmap.format());
@@ -11,6 +11,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/RefPtr.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/Rect.h>
 #include <LibGfx/Size.h>
 #include <LibGfx/SkiaBackendContext.h>
 
@@ -43,6 +44,15 @@ public:
     static NonnullRefPtr<PaintingSurface> create_from_vkimage(NonnullRefPtr<SkiaBackendContext> context, NonnullRefPtr<VulkanImage> vulkan_image, Origin origin);
 #endif
 
+    // Returns a surface that draws directly into the given region of this surface's pixels, or nullptr if this
+    // surface is not backed by a CPU bitmap. Its canvas is set up to accept coordinates in the space of this
+    // surface, so anything outside the region is clipped away. The returned surface keeps the bitmap alive.
+    RefPtr<PaintingSurface> create_view_for_region(IntRect);
+
+    // Copies the pixels of another surface of the same format into this one, shifted by the given offset.
+    // Returns false if either surface is not backed by a CPU bitmap.
+    bool copy_pixels_from(PaintingSurface const&, IntPoint offset);
+
     void read_into_bitmap(Bitmap&);
     void write_from_bitmap(Bitmap const&);
 
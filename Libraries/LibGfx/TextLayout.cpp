@@ -13,6 +13,9 @@
 #include <LibGfx/TextLayout.h>
 #include <harfbuzz/hb.h>
 
+#include <core/SkFont.h>
+#include <core/SkRect.h>
+
 namespace Gfx {
 
 template<typename UnicodeView>
@@ -128,6 +131,37 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 template NonnullRefPtr<GlyphRun> shape_text(FloatPoint, float, Utf8View const&, Font const&, GlyphRun::TextType, ShapeFeatures const&);
 template NonnullRefPtr<GlyphRun> shape_text(FloatPoint, float, Utf16View const&, Font const&, GlyphRun::TextType, ShapeFeatures const&);
 
+FloatRect GlyphRun::ink_bounding_rect(float scale) const
+{
+    if (m_glyphs.is_empty())
+        return {};
+
+    Vector<SkGlyphID> glyph_ids;
+    glyph_ids.ensure_capacity(m_glyphs.size());
+    for (auto const& glyph : m_glyphs)
+        glyph_ids.unchecked_append(glyph.glyph_id);
+
+    Vector<SkRect> glyph_bounds;
+    glyph_bounds.resize(m_glyphs.size());
+    auto sk_font = m_font->skia_font(scale);
+    sk_font.getBounds(glyph_ids.data(), static_cast<int>(glyph_ids.size()), glyph_bounds.data(), nullptr);
+
+    // Glyph positions are those of the top of the line, so each glyph's baseline is the font's ascent below it.
+    auto ascent = m_font->pixel_metrics().ascent;
+
+    Optional<FloatRect> ink_rect;
+    for (size_t i = 0; i < m_glyphs.size(); ++i) {
+        auto const& bounds = glyph_bounds[i];
+        if (bounds.isEmpty())
+            continue;
+        auto position = m_glyphs[i].position;
+        FloatRect glyph_rect { bounds.x(), bounds.y(), bounds.width(), bounds.height() };
+        glyph_rect.translate_by(position.x() * scale, (position.y() + ascent) * scale);
+        ink_rect = ink_rect.has_value() ? ink_rect->united(glyph_rect) : glyph_rect;
+    }
+    return ink_rect.value_or({});
+}
+
 template<typename UnicodeView>
 float measure_text_width(UnicodeView const& string, Font const& font, ShapeFeatures const& features)
 {
@@ -15,6 +15,7 @@
 #include <LibGfx/FontCascadeList.h>
 #include <LibGfx/Forward.h>
 #include <LibGfx/Point.h>
+#include <LibGfx/Rect.h>
 
 namespace Gfx {
 
@@ -60,6 +61,10 @@ public:
     [[nodiscard]] bool is_empty() const { return m_glyphs.is_empty(); }
     [[nodiscard]] float width() const { return m_width; }
 
+    // The smallest rect containing the ink of all glyphs when drawn at the given scale, relative to the baseline start
+    // of the run. Glyphs may extend well past the run's advance and line height (e.g. italics, diacritics or swashes).
+    [[nodiscard]] FloatRect ink_bounding_rect(float scale) const;
+
 private:
     Vector<DrawGlyph> m_glyphs;
     NonnullRefPtr<Font const> m_font;
@@ -283,10 +283,10 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> BinaryExpression::gener
         generator.emit<Bytecode::Op::UnsignedRightShift>(dst, lhs, rhs);
         break;
     case BinaryOp::In:
-        generator.emit<Bytecode::Op::In>(dst, lhs, rhs);
+        generator.emit<Bytecode::Op::In>(dst, lhs, rhs, generator.next_in_cache());
         break;
     case BinaryOp::InstanceOf:
-        generator.emit<Bytecode::Op::InstanceOf>(dst, lhs, rhs);
+        generator.emit<Bytecode::Op::InstanceOf>(dst, lhs, rhs, generator.next_instance_of_cache());
         break;
     default:
         VERIFY_NOT_REACHED();
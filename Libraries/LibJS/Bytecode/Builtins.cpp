@@ -17,7 +17,7 @@ Optional<Builtin> get_builtin(MemberExpression const& expression)
     auto property_name = static_cast<Identifier const&>(expression.property()).string();
 #define CHECK_MEMBER_BUILTIN(name, snake_case_name, base, property, ...) \
     if (base_name == #base##sv && property_name == #property##sv)        \
-        return Builtin::name;
+        return builtin_has_call_fast_path(Builtin::name) ? Builtin::name : Optional<Builtin> {};
     JS_ENUMERATE_BUILTINS(CHECK_MEMBER_BUILTIN)
 #undef CHECK_MEMBER_BUILTIN
     return {};
@@ -29,7 +29,8 @@ namespace JS::Bytecode {
     O(ArrayIteratorPrototypeNext, array_iterator_prototype_next, ArrayIteratorPrototype, next, 0) \
     O(MapIteratorPrototypeNext, map_iterator_prototype_next, MapIteratorPrototype, next, 0)       \
     O(SetIteratorPrototypeNext, set_iterator_prototype_next, SetIteratorPrototype, next, 0)       \
-    O(StringIteratorPrototypeNext, string_iterator_prototype_next, StringIteratorPrototype, next, 0)
+    O(StringIteratorPrototypeNext, string_iterator_prototype_next, StringIteratorPrototype, next, 0) \
+    O(GeneratorPrototypeNext, generator_prototype_next, GeneratorPrototype, next, 1)
 
 enum class Builtin : u8 {
 #define DEFINE_BUILTIN_ENUM(name, ...) name,
@@ -66,6 +67,22 @@ inline size_t builtin_argument_count(Builtin value)
     VERIFY_NOT_REACHED();
 }
 
+// The iterator next() builtins only let iteration recognize those native functions, so that it can step through their
+// iterators without creating result objects. Calls to them don't have a fast path of their own.
+inline bool builtin_has_call_fast_path(Builtin value)
+{
+    switch (value) {
+    case Builtin::ArrayIteratorPrototypeNext:
+    case Builtin::MapIteratorPrototypeNext:
+    case Builtin::SetIteratorPrototypeNext:
+    case Builtin::StringIteratorPrototypeNext:
+    case Builtin::GeneratorPrototypeNext:
+        return false;
+    default:
+        return true;
+    }
+}
+
 Optional<Builtin> get_builtin(MemberExpression const& expression);
 
 }
@@ -24,6 +24,8 @@ Executable::Executable(
     NonnullRefPtr<SourceCode const> source_code,
     size_t number_of_property_lookup_caches,
     size_t number_of_global_variable_caches,
+    size_t number_of_in_caches,
+    size_t number_of_instance_of_caches,
     size_t number_of_registers,
     bool is_strict_mode)
     : bytecode(move(bytecode))
@@ -37,6 +39,8 @@ Executable::Executable(
 {
     property_lookup_caches.resize(number_of_property_lookup_caches);
     global_variable_caches.resize(number_of_global_variable_caches);
+    in_caches.resize(number_of_in_caches);
+    instance_of_caches.resize(number_of_instance_of_caches);
 }
 
 Executable::~Executable() = default;
@@ -43,6 +43,40 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// Identifies an object whose shape, and everything on whose prototype chain, is unchanged since the entry was recorded.
+// Changes to the prototype chain are tracked by the validity of the [[Prototype]]'s shape.
+struct PrototypeChainLookupCacheEntry {
+    WeakPtr<Shape> shape;
+    WeakPtr<PrototypeChainValidity> prototype_chain_validity;
+    bool has_prototype { false };
+};
+
+struct InCache {
+    static constexpr size_t max_number_of_shapes_to_remember = 4;
+    struct Entry : public PrototypeChainLookupCacheEntry {
+        Utf16FlyString property_name;
+        bool result { false };
+    };
+    AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+};
+
+struct InstanceOfCache {
+    // A constructor for which @@hasInstance resolves to %Function.prototype%[@@hasInstance], and the offset of its own
+    // "prototype" data property.
+    struct ConstructorEntry : public PrototypeChainLookupCacheEntry {
+        WeakPtr<Object> constructor;
+        u32 prototype_property_offset { 0 };
+    };
+    ConstructorEntry constructor_entry;
+
+    static constexpr size_t max_number_of_shapes_to_remember = 4;
+    struct Entry : public PrototypeChainLookupCacheEntry {
+        WeakPtr<Object> prototype;
+        bool result { false };
+    };
+    AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -62,6 +96,8 @@ public:
         NonnullRefPtr<SourceCode const>,
         size_t number_of_property_lookup_caches,
         size_t number_of_global_variable_caches,
+        size_t number_of_in_caches,
+        size_t number_of_instance_of_caches,
         size_t number_of_registers,
         bool is_strict_mode);
 
@@ -71,6 +107,8 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<InCache> in_caches;
+    Vector<InstanceOfCache> instance_of_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
@@ -452,6 +452,8 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         node.source_code(),
         generator.m_next_property_lookup_cache,
         generator.m_next_global_variable_cache,
+        generator.m_next_in_cache,
+        generator.m_next_instance_of_cache,
         generator.m_next_register,
         is_strict_mode);
 
@@ -337,6 +337,8 @@ public:
 
     [[nodiscard]] size_t next_global_variable_cache() { return m_next_global_variable_cache++; }
     [[nodiscard]] size_t next_property_lookup_cache() { return m_next_property_lookup_cache++; }
+    [[nodiscard]] size_t next_in_cache() { return m_next_in_cache++; }
+    [[nodiscard]] size_t next_instance_of_cache() { return m_next_instance_of_cache++; }
 
     enum class DeduplicateConstant {
         Yes,
@@ -407,6 +409,8 @@ private:
     u32 m_next_block { 1 };
     u32 m_next_property_lookup_cache { 0 };
     u32 m_next_global_variable_cache { 0 };
+    u32 m_next_in_cache { 0 };
+    u32 m_next_instance_of_cache { 0 };
     FunctionKind m_enclosing_function_kind { FunctionKind::Normal };
     Vector<LabelableScope> m_continuable_scopes;
     Vector<LabelableScope> m_breakable_scopes;
@@ -21,6 +21,7 @@
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/BigInt.h>
+#include <LibJS/Runtime/BoundFunction.h>
 #include <LibJS/Runtime/CompletionCell.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -190,6 +191,23 @@ Interpreter::~Interpreter()
 {
 }
 
+void Interpreter::start_sampling_profiler(AK::Duration interval)
+{
+    if (m_sampling_profiler)
+        return;
+    m_sampling_profiler = make<SamplingProfiler>(m_vm, interval);
+    m_sampling_profiler->start();
+}
+
+OwnPtr<SamplingProfiler> Interpreter::stop_sampling_profiler()
+{
+    if (!m_sampling_profiler)
+        return {};
+    auto profiler = move(m_sampling_profiler);
+    profiler->stop();
+    return profiler;
+}
+
 ALWAYS_INLINE Value Interpreter::get(Operand op) const
 {
     return m_registers_and_constants_and_locals_arguments.data()[op.index()];
@@ -380,6 +398,9 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     size_t& program_counter = running_execution_context.program_counter;
     program_counter = entry_point;
 
+    // Samples are only taken when entering a function and at jumps, which is where the stack is in a consistent state.
+    take_profiler_sample_if_requested();
+
     // Declare a lookup table for computed goto with each of the `handle_*` labels
     // to avoid the overhead of a switch statement.
     // This is a GCC extension, but it's also supported by Clang.
@@ -402,6 +423,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
     for (;;) {
     start:
+        take_profiler_sample_if_requested();
         for (;;) {
             goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
 
@@ -719,6 +741,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& executable, Optional<size_t> entry_point, Value initial_accumulator_value)
 {
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter will run unit {:p}", &executable);
+    ++m_statistics.executables_run;
 
     TemporaryChange restore_executable { m_current_executable, GC::Ptr { executable } };
     TemporaryChange restore_saved_jump { m_scheduled_jump, Optional<size_t> {} };
@@ -823,7 +846,11 @@ void Interpreter::enter_object_environment(Object& object)
 
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM& vm, ASTNode const& node, FunctionKind kind, Utf16FlyString const& name)
 {
+    auto start_time = MonotonicTime::now();
     auto executable_result = Bytecode::Generator::generate_from_ast_node(vm, node, kind);
+    auto& statistics = vm.bytecode_interpreter().statistics();
+    ++statistics.executables_compiled;
+    statistics.time_spent_compiling += MonotonicTime::now() - start_time;
     if (executable_result.is_error())
         return vm.throw_completion<InternalError>(ErrorType::NotImplemented, TRY_OR_THROW_OOM(vm, executable_result.error().to_string()));
 
@@ -840,7 +867,11 @@ ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM& vm, ECMAScriptFunct
 {
     auto const& name = function.name();
 
+    auto start_time = MonotonicTime::now();
     auto executable_result = Bytecode::Generator::generate_from_function(vm, function);
+    auto& statistics = vm.bytecode_interpreter().statistics();
+    ++statistics.executables_compiled;
+    statistics.time_spent_compiling += MonotonicTime::now() - start_time;
     if (executable_result.is_error())
         return vm.throw_completion<InternalError>(ErrorType::NotImplemented, TRY_OR_THROW_OOM(vm, executable_result.error().to_string()));
 
@@ -1020,6 +1051,8 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
         }
     }
 
+    ++vm.bytecode_interpreter().statistics().get_by_id_cache_misses;
+
     CacheablePropertyMetadata cacheable_metadata;
     auto value = TRY(base_obj->internal_get(executable.get_identifier(property), this_value, &cacheable_metadata));
 
@@ -1388,11 +1421,11 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Utf16Fl
         if (storage
             && storage->is_simple_storage()
             && !object.may_interfere_with_indexed_property_access()) {
-            auto maybe_value = storage->get(index);
-            if (maybe_value.has_value()) {
-                auto existing_value = maybe_value->value;
-                if (!existing_value.is_accessor()) {
-                    storage->put(index, value);
+            auto& simple_storage = static_cast<SimpleIndexedPropertyStorage&>(*storage);
+            if (simple_storage.inline_has_index(index)) {
+                // Storage that only holds numbers can't hold accessors either.
+                if (simple_storage.holds_only_numbers() || !simple_storage.elements()[index].is_accessor()) {
+                    simple_storage.put(index, value);
                     return {};
                 }
             }
@@ -1970,6 +2003,179 @@ JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(JS_DEFINE_EXECUTE_FOR_COMMON_BI
 JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(JS_DEFINE_TO_BYTE_STRING_FOR_COMMON_BINARY_OP)
 JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(JS_DEFINE_TO_BYTE_STRING_FOR_COMMON_BINARY_OP)
 
+// Whether looking up a named property on this object is fully determined by its shape and the shapes of the objects
+// on its prototype chain, so that the result can be cached in a PrototypeChainLookupCacheEntry.
+static bool can_cache_prototype_chain_lookup(Object const& object)
+{
+    if (object.shape().is_dictionary())
+        return false;
+    for (auto const* current = &object; current; current = current->shape().prototype()) {
+        if (current->has_exotic_named_property_lookup())
+            return false;
+    }
+    auto const* prototype = object.shape().prototype();
+    return !prototype || prototype->shape().prototype_chain_validity();
+}
+
+static void record_prototype_chain_lookup_cache_entry(PrototypeChainLookupCacheEntry& entry, Object& object)
+{
+    entry.shape = object.shape();
+    entry.has_prototype = object.shape().prototype() != nullptr;
+    entry.prototype_chain_validity = entry.has_prototype ? object.shape().prototype()->shape().prototype_chain_validity().ptr() : nullptr;
+}
+
+ALWAYS_INLINE static bool prototype_chain_lookup_cache_entry_matches(PrototypeChainLookupCacheEntry const& entry, Object const& object)
+{
+    if (&object.shape() != entry.shape)
+        return false;
+    if (!entry.has_prototype)
+        return true;
+    return entry.prototype_chain_validity && entry.prototype_chain_validity->is_valid();
+}
+
+template<typename Entry, size_t Size>
+static Entry& new_prototype_chain_lookup_cache_entry(AK::Array<Entry, Size>& entries, Object& object)
+{
+    for (size_t i = entries.size() - 1; i >= 1; --i)
+        entries[i] = entries[i - 1];
+    entries[0] = {};
+    record_prototype_chain_lookup_cache_entry(entries[0], object);
+    return entries[0];
+}
+
+ThrowCompletionOr<void> In::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto lhs = interpreter.get(m_lhs);
+    auto rhs = interpreter.get(m_rhs);
+
+    if (!rhs.is_object())
+        return vm.throw_completion<TypeError>(ErrorType::InOperatorWithObject);
+    auto& object = rhs.as_object();
+    auto& cache = interpreter.current_executable().in_caches[m_cache_index];
+
+    // OPTIMIZATION: If we've looked up this name on an object with the same shape before, and nothing on its prototype
+    //               chain has changed since, the answer is the same.
+    if (lhs.is_string() && !object.has_exotic_named_property_lookup()) {
+        auto property_name = lhs.as_string().utf16_string_view();
+        for (auto const& entry : cache.entries) {
+            if (prototype_chain_lookup_cache_entry_matches(entry, object) && entry.property_name == property_name) {
+                interpreter.set(m_dst, Value(entry.result));
+                return {};
+            }
+        }
+    }
+
+    auto property_key = TRY(lhs.to_property_key(vm));
+    auto result = TRY(object.has_property(property_key));
+    interpreter.set(m_dst, Value(result));
+
+    // NOTE: The "length" of arrays is not stored in their shape, so we never cache lookups of it.
+    if (lhs.is_string() && property_key.is_string() && property_key.as_string() != vm.names.length.as_string() && can_cache_prototype_chain_lookup(object)) {
+        auto& entry = new_prototype_chain_lookup_cache_entry(cache.entries, object);
+        entry.property_name = property_key.as_string();
+        entry.result = result;
+    }
+    return {};
+}
+
+ThrowCompletionOr<void> InstanceOf::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto lhs = interpreter.get(m_lhs);
+    auto rhs = interpreter.get(m_rhs);
+    auto& cache = interpreter.current_executable().instance_of_caches[m_cache_index];
+
+    // OPTIMIZATION: If this is the constructor we've seen before, and neither it nor anything on its prototype chain has
+    //               changed since, @@hasInstance still resolves to %Function.prototype%[@@hasInstance], which performs
+    //               OrdinaryHasInstance(C, V) with C's own "prototype" data property.
+    if (rhs.is_object() && &rhs.as_object() == cache.constructor_entry.constructor && prototype_chain_lookup_cache_entry_matches(cache.constructor_entry, rhs.as_object())) {
+        auto prototype = rhs.as_object().get_direct(cache.constructor_entry.prototype_property_offset);
+        if (!lhs.is_object()) {
+            interpreter.set(m_dst, Value(false));
+            return {};
+        }
+        auto& object = lhs.as_object();
+        if (prototype.is_object() && !object.has_exotic_named_property_lookup()) {
+            for (auto const& entry : cache.entries) {
+                if (&prototype.as_object() == entry.prototype && prototype_chain_lookup_cache_entry_matches(entry, object)) {
+                    interpreter.set(m_dst, Value(entry.result));
+                    return {};
+                }
+            }
+        }
+    }
+
+    // NOTE: @@hasInstance may be a getter, or some other user code may run while evaluating the operator, so we remember
+    //       what the constructor and the value looked like before, and only cache the result if they're unchanged.
+    PrototypeChainLookupCacheEntry constructor_before;
+    PrototypeChainLookupCacheEntry value_before;
+    if (rhs.is_object())
+        record_prototype_chain_lookup_cache_entry(constructor_before, rhs.as_object());
+    if (lhs.is_object())
+        record_prototype_chain_lookup_cache_entry(value_before, lhs.as_object());
+
+    auto result = TRY(instance_of(vm, lhs, rhs));
+    interpreter.set(m_dst, result);
+
+    if (!rhs.is_object() || !prototype_chain_lookup_cache_entry_matches(constructor_before, rhs.as_object()))
+        return {};
+    auto& constructor = rhs.as_object();
+
+    if (&constructor != cache.constructor_entry.constructor || !prototype_chain_lookup_cache_entry_matches(cache.constructor_entry, constructor)) {
+        if (!constructor.is_function() || is<BoundFunction>(constructor) || !can_cache_prototype_chain_lookup(constructor))
+            return {};
+
+        // @@hasInstance must be a data property holding %Function.prototype%[@@hasInstance].
+        Value handler;
+        for (auto const* current = &constructor; current; current = current->shape().prototype()) {
+            if (auto metadata = current->shape().lookup(vm.well_known_symbol_has_instance()); metadata.has_value()) {
+                handler = current->get_direct(metadata->offset);
+                break;
+            }
+        }
+        if (!handler.is_object() || &handler.as_object() != vm.current_realm()->intrinsics().function_prototype_symbol_has_instance_function())
+            return {};
+
+        auto prototype_metadata = constructor.shape().lookup(vm.names.prototype);
+        if (!prototype_metadata.has_value())
+            return {};
+
+        cache.constructor_entry = {};
+        record_prototype_chain_lookup_cache_entry(cache.constructor_entry, constructor);
+        cache.constructor_entry.constructor = constructor;
+        cache.constructor_entry.prototype_property_offset = prototype_metadata->offset;
+    }
+
+    auto prototype = constructor.get_direct(cache.constructor_entry.prototype_property_offset);
+    if (!prototype.is_object() || !lhs.is_object())
+        return {};
+    auto& object = lhs.as_object();
+    if (!prototype_chain_lookup_cache_entry_matches(value_before, object) || !can_cache_prototype_chain_lookup(object))
+        return {};
+
+    auto& entry = new_prototype_chain_lookup_cache_entry(cache.entries, object);
+    entry.prototype = prototype.as_object();
+    entry.result = result.as_bool();
+    return {};
+}
+
+ByteString In::to_byte_string_impl(Bytecode::Executable const& executable) const
+{
+    return ByteString::formatted("In {}, {}, {}",
+        format_operand("dst"sv, m_dst, executable),
+        format_operand("lhs"sv, m_lhs, executable),
+        format_operand("rhs"sv, m_rhs, executable));
+}
+
+ByteString InstanceOf::to_byte_string_impl(Bytecode::Executable const& executable) const
+{
+    return ByteString::formatted("InstanceOf {}, {}, {}",
+        format_operand("dst"sv, m_dst, executable),
+        format_operand("lhs"sv, m_lhs, executable),
+        format_operand("rhs"sv, m_rhs, executable));
+}
+
 ThrowCompletionOr<void> Add::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
@@ -2829,6 +3035,7 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
     case Builtin::MapIteratorPrototypeNext:
     case Builtin::SetIteratorPrototypeNext:
     case Builtin::StringIteratorPrototypeNext:
+    case Builtin::GeneratorPrototypeNext:
         VERIFY_NOT_REACHED();
     case Bytecode::Builtin::__Count:
         VERIFY_NOT_REACHED();
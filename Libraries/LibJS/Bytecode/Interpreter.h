@@ -9,6 +9,7 @@
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Register.h>
+#include <LibJS/Bytecode/SamplingProfiler.h>
 #include <LibJS/Export.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
@@ -85,7 +86,28 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    void start_sampling_profiler(AK::Duration interval = AK::Duration::from_milliseconds(1));
+    // Stops the profiler, and returns everything it recorded as a Chrome .cpuprofile document.
+    OwnPtr<SamplingProfiler> stop_sampling_profiler();
+    [[nodiscard]] bool is_sampling_profiler_running() const { return m_sampling_profiler.ptr() != nullptr; }
+
+    // Running totals since the interpreter was created, for benchmarks to take the difference of.
+    struct Statistics {
+        u64 executables_compiled { 0 };
+        AK::Duration time_spent_compiling;
+        u64 executables_run { 0 };
+        u64 get_by_id_cache_misses { 0 };
+    };
+    Statistics& statistics() { return m_statistics; }
+    Statistics const& statistics() const { return m_statistics; }
+
 private:
+    void take_profiler_sample_if_requested()
+    {
+        if (m_sampling_profiler && m_sampling_profiler->sample_requested()) [[unlikely]]
+            m_sampling_profiler->take_sample();
+    }
+
     void run_bytecode(size_t entry_point);
 
     enum class HandleExceptionResponse {
@@ -103,6 +125,8 @@ private:
     Span<Value> m_registers_and_constants_and_locals_arguments;
     Vector<Value> m_argument_values_buffer;
     ExecutionContext* m_running_execution_context { nullptr };
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+    Statistics m_statistics;
 };
 
 JS_API extern bool g_dump_bytecode;
@@ -127,8 +127,6 @@ private:
     O(Div, div)                                             \
     O(Exp, exp)                                             \
     O(Mod, mod)                                             \
-    O(In, in)                                               \
-    O(InstanceOf, instance_of)                              \
     O(LooselyInequals, loosely_inequals)                    \
     O(LooselyEquals, loosely_equals)                        \
     O(StrictlyInequals, strict_inequals)                    \
@@ -168,6 +166,70 @@ JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(JS_DECLARE_COMMON_BINARY_OP)
 JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(JS_DECLARE_COMMON_BINARY_OP)
 #undef JS_DECLARE_COMMON_BINARY_OP
 
+class In final : public Instruction {
+public:
+    In(Operand dst, Operand lhs, Operand rhs, u32 cache_index)
+        : Instruction(Type::In)
+        , m_dst(dst)
+        , m_lhs(lhs)
+        , m_rhs(rhs)
+        , m_cache_index(cache_index)
+    {
+    }
+
+    ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;
+    ByteString to_byte_string_impl(Bytecode::Executable const&) const;
+    void visit_operands_impl(Function<void(Operand&)> visitor)
+    {
+        visitor(m_dst);
+        visitor(m_lhs);
+        visitor(m_rhs);
+    }
+
+    Operand dst() const { return m_dst; }
+    Operand lhs() const { return m_lhs; }
+    Operand rhs() const { return m_rhs; }
+    u32 cache_index() const { return m_cache_index; }
+
+private:
+    Operand m_dst;
+    Operand m_lhs;
+    Operand m_rhs;
+    u32 m_cache_index { 0 };
+};
+
+class InstanceOf final : public Instruction {
+public:
+    InstanceOf(Operand dst, Operand lhs, Operand rhs, u32 cache_index)
+        : Instruction(Type::InstanceOf)
+        , m_dst(dst)
+        , m_lhs(lhs)
+        , m_rhs(rhs)
+        , m_cache_index(cache_index)
+    {
+    }
+
+    ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;
+    ByteString to_byte_string_impl(Bytecode::Executable const&) const;
+    void visit_operands_impl(Function<void(Operand&)> visitor)
+    {
+        visitor(m_dst);
+        visitor(m_lhs);
+        visitor(m_rhs);
+    }
+
+    Operand dst() const { return m_dst; }
+    Operand lhs() const { return m_lhs; }
+    Operand rhs() const { return m_rhs; }
+    u32 cache_index() const { return m_cache_index; }
+
+private:
+    Operand m_dst;
+    Operand m_lhs;
+    Operand m_rhs;
+    u32 m_cache_index { 0 };
+};
+
 #define JS_ENUMERATE_COMMON_UNARY_OPS(O) \
     O(BitwiseNot, bitwise_not)           \
     O(Not, not_)                         \
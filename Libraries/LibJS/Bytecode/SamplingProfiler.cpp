@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/QuickSort.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/SamplingProfiler.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibThreading/Thread.h>
+#include <unistd.h>
+
+namespace JS::Bytecode {
+
+bool SamplingProfiler::Frame::operator==(Frame const& other) const
+{
+    return source_offset == other.source_offset
+        && source_code == other.source_code
+        && function_name == other.function_name;
+}
+
+unsigned SamplingProfiler::FrameTraits::hash(Frame const& frame)
+{
+    auto hash = pair_int_hash(frame.function_name.hash(), frame.source_offset);
+    return pair_int_hash(hash, ptr_hash(frame.source_code.ptr()));
+}
+
+SamplingProfiler::SamplingProfiler(VM& vm, AK::Duration interval)
+    : m_vm(vm)
+    , m_interval(interval)
+{
+    // Frame and node 0 are the root of the call tree, which every sample starts from.
+    m_frames.append({ .function_name = "(root)"_string, .source_code = nullptr, .source_offset = 0 });
+    m_nodes.append({});
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+void SamplingProfiler::start()
+{
+    if (m_running.exchange(true))
+        return;
+
+    m_start_time = MonotonicTime::now();
+    m_start_wall_time = UnixDateTime::now();
+    m_last_sample_time = m_start_time;
+
+    m_sampler_thread = Threading::Thread::construct([this] {
+        auto interval_in_microseconds = max<i64>(m_interval.to_microseconds(), 1);
+        while (m_running.load(AK::MemoryOrder::memory_order_relaxed)) {
+            usleep(static_cast<useconds_t>(interval_in_microseconds));
+            m_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed);
+        }
+        return static_cast<intptr_t>(0);
+    },
+        "JS Profiler"sv);
+    m_sampler_thread->start();
+}
+
+void SamplingProfiler::stop()
+{
+    if (!m_running.exchange(false))
+        return;
+
+    (void)m_sampler_thread->join();
+    m_sampler_thread = nullptr;
+    m_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+    m_end_time = MonotonicTime::now();
+}
+
+Optional<size_t> SamplingProfiler::frame_index_for(ExecutionContext const& context)
+{
+    Frame frame;
+
+    if (auto* function = as_if<ECMAScriptFunctionObject>(context.function.ptr())) {
+        auto const& code = function->ecmascript_code();
+        frame.function_name = function->name().view().to_utf8_but_should_be_ported_to_utf16();
+        frame.source_code = code.unrealized_source_range().source_code;
+        frame.source_offset = code.start_offset();
+    } else if (context.executable) {
+        // Top-level code of a script or module.
+        frame.function_name = context.executable->name.is_empty() ? "(program)"_string : context.executable->name.view().to_utf8_but_should_be_ported_to_utf16();
+        frame.source_code = context.executable->source_code;
+    } else if (context.function_name) {
+        frame.function_name = context.function_name->utf8_string();
+    } else if (context.function) {
+        frame.function_name = "(native)"_string;
+    } else {
+        return {};
+    }
+
+    if (frame.function_name.is_empty())
+        frame.function_name = "(anonymous)"_string;
+
+    return m_frame_indices.ensure(frame, [&] {
+        m_frames.append(frame);
+        return m_frames.size() - 1;
+    });
+}
+
+size_t SamplingProfiler::child_node_index(size_t parent_index, size_t frame_index)
+{
+    auto key = (static_cast<u64>(parent_index) << 32) | static_cast<u32>(frame_index);
+    return m_child_node_indices.ensure(key, [&] {
+        m_nodes.append({ .frame_index = frame_index, .parent_index = parent_index, .child_indices = {}, .hit_count = 0, .hits_by_source_offset = {} });
+        auto index = m_nodes.size() - 1;
+        m_nodes[parent_index].child_indices.append(index);
+        return index;
+    });
+}
+
+void SamplingProfiler::take_sample()
+{
+    m_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+    if (!m_running.load(AK::MemoryOrder::memory_order_relaxed))
+        return;
+
+    auto now = MonotonicTime::now();
+
+    size_t node_index = 0;
+    ExecutionContext const* leaf_context = nullptr;
+    for (auto const* context : m_vm.execution_context_stack()) {
+        auto frame_index = frame_index_for(*context);
+        if (!frame_index.has_value())
+            continue;
+        node_index = child_node_index(node_index, *frame_index);
+        leaf_context = context;
+    }
+
+    auto& node = m_nodes[node_index];
+    ++node.hit_count;
+    if (leaf_context && leaf_context->executable) {
+        auto source_range = leaf_context->executable->source_range_at(leaf_context->program_counter);
+        if (source_range.source_code)
+            ++node.hits_by_source_offset.ensure(source_range.start_offset, [] { return 0; });
+    }
+
+    m_samples.append(node_index);
+    m_time_deltas_in_microseconds.append((now - *m_last_sample_time).to_microseconds());
+    m_last_sample_time = now;
+}
+
+// https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-Profile
+String SamplingProfiler::to_cpuprofile_json() const
+{
+    HashMap<SourceCode const*, size_t> script_ids;
+    auto script_id_for = [&](SourceCode const* source_code) -> size_t {
+        if (!source_code)
+            return 0;
+        return script_ids.ensure(source_code, [&] { return script_ids.size() + 1; });
+    };
+
+    JsonArray nodes;
+    for (size_t node_index = 0; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+        auto const& frame = m_frames[node.frame_index];
+
+        // NOTE: Source positions are 1-based, whereas call frames use 0-based line and column numbers.
+        i64 line_number = -1;
+        i64 column_number = -1;
+        if (frame.source_code) {
+            auto start = frame.source_code->range_from_offsets(frame.source_offset, frame.source_offset).start;
+            line_number = static_cast<i64>(start.line) - 1;
+            column_number = static_cast<i64>(start.column) - 1;
+        }
+
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, frame.function_name);
+        call_frame.set("scriptId"sv, String::number(script_id_for(frame.source_code.ptr())));
+        call_frame.set("url"sv, frame.source_code ? frame.source_code->filename() : String {});
+        call_frame.set("lineNumber"sv, line_number);
+        call_frame.set("columnNumber"sv, column_number);
+
+        JsonArray children;
+        for (auto child_index : node.child_indices)
+            children.must_append(child_index + 1);
+
+        JsonObject json_node;
+        json_node.set("id"sv, node_index + 1);
+        json_node.set("callFrame"sv, move(call_frame));
+        json_node.set("hitCount"sv, node.hit_count);
+        json_node.set("children"sv, move(children));
+
+        if (frame.source_code && !node.hits_by_source_offset.is_empty()) {
+            // Position ticks are reported per 1-based line.
+            HashMap<size_t, size_t> ticks_by_line;
+            for (auto const& [source_offset, ticks] : node.hits_by_source_offset) {
+                auto line = frame.source_code->range_from_offsets(source_offset, source_offset).start.line;
+                ticks_by_line.ensure(line, [] { return 0; }) += ticks;
+            }
+
+            auto lines = ticks_by_line.keys();
+            quick_sort(lines);
+
+            JsonArray position_ticks;
+            for (auto line : lines) {
+                JsonObject position_tick;
+                position_tick.set("line"sv, line);
+                position_tick.set("ticks"sv, *ticks_by_line.get(line));
+                position_ticks.must_append(move(position_tick));
+            }
+            json_node.set("positionTicks"sv, move(position_ticks));
+        }
+
+        nodes.must_append(move(json_node));
+    }
+
+    JsonArray samples;
+    for (auto node_index : m_samples)
+        samples.must_append(node_index + 1);
+
+    JsonArray time_deltas;
+    for (auto delta : m_time_deltas_in_microseconds)
+        time_deltas.must_append(delta);
+
+    auto start_time = m_start_time.value_or(MonotonicTime::now_coarse());
+    auto end_time = m_end_time.value_or(m_last_sample_time.value_or(start_time));
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, end_time.nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile.serialized();
+}
+
+static JsonObject gecko_table(Vector<StringView> const& columns, JsonArray data)
+{
+    // Every table is an array of rows, along with a schema that maps the name of each column to its index in a row.
+    JsonObject schema;
+    for (size_t index = 0; index < columns.size(); ++index)
+        schema.set(columns[index], index);
+
+    JsonObject table;
+    table.set("schema"sv, move(schema));
+    table.set("data"sv, move(data));
+    return table;
+}
+
+// https://github.com/firefox-devtools/profiler/blob/main/docs-developer/gecko-profile-format.md
+String SamplingProfiler::to_gecko_profile_json() const
+{
+    // NOTE: The root of the call tree is not a frame of its own in this format. Samples that stopped in it have no stack,
+    //       and the children of the root have no prefix. So the index of every other frame and node is shifted by one.
+    JsonArray string_table;
+    JsonArray frame_table;
+    for (size_t frame_index = 1; frame_index < m_frames.size(); ++frame_index) {
+        auto const& frame = m_frames[frame_index];
+
+        JsonValue line;
+        JsonValue column;
+        if (frame.source_code) {
+            auto start = frame.source_code->range_from_offsets(frame.source_offset, frame.source_offset).start;
+            line = start.line;
+            column = start.column;
+            string_table.must_append(MUST(String::formatted("{} ({}:{}:{})", frame.function_name, frame.source_code->filename(), start.line, start.column)));
+        } else {
+            string_table.must_append(frame.function_name);
+        }
+
+        JsonArray row;
+        row.must_append(string_table.size() - 1); // location
+        row.must_append(false);                   // relevantForJS
+        row.must_append(0);                       // innerWindowID
+        row.must_append(JsonValue {});            // implementation
+        row.must_append(move(line));              // line
+        row.must_append(move(column));            // column
+        row.must_append(0);                       // category
+        row.must_append(0);                       // subcategory
+        frame_table.must_append(move(row));
+    }
+
+    auto stack_index_for = [](size_t node_index) -> JsonValue {
+        if (node_index == 0)
+            return {};
+        return node_index - 1;
+    };
+
+    JsonArray stack_table;
+    for (size_t node_index = 1; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+
+        JsonArray row;
+        row.must_append(stack_index_for(node.parent_index.value_or(0))); // prefix
+        row.must_append(node.frame_index - 1);                           // frame
+        stack_table.must_append(move(row));
+    }
+
+    // Sample times are in milliseconds since the start time of the profile.
+    JsonArray samples;
+    i64 elapsed_microseconds = 0;
+    for (size_t sample_index = 0; sample_index < m_samples.size(); ++sample_index) {
+        elapsed_microseconds += m_time_deltas_in_microseconds[sample_index];
+
+        JsonArray row;
+        row.must_append(stack_index_for(m_samples[sample_index]));         // stack
+        row.must_append(static_cast<double>(elapsed_microseconds) / 1000); // time
+        row.must_append(0);                                                // eventDelay
+        samples.must_append(move(row));
+    }
+
+    JsonObject thread;
+    thread.set("name"sv, "GeckoMain"sv);
+    thread.set("processType"sv, "default"sv);
+    thread.set("pid"sv, getpid());
+    thread.set("tid"sv, getpid());
+    thread.set("registerTime"sv, 0);
+    thread.set("unregisterTime"sv, JsonValue {});
+    thread.set("samples"sv, gecko_table({ "stack"sv, "time"sv, "eventDelay"sv }, move(samples)));
+    thread.set("markers"sv, gecko_table({ "name"sv, "startTime"sv, "endTime"sv, "phase"sv, "category"sv, "data"sv }, {}));
+    thread.set("stackTable"sv, gecko_table({ "prefix"sv, "frame"sv }, move(stack_table)));
+    thread.set("frameTable"sv, gecko_table({ "location"sv, "relevantForJS"sv, "innerWindowID"sv, "implementation"sv, "line"sv, "column"sv, "category"sv, "subcategory"sv }, move(frame_table)));
+    thread.set("stringTable"sv, move(string_table));
+
+    JsonArray threads;
+    threads.must_append(move(thread));
+
+    // All frames are put in a single category.
+    JsonArray subcategories;
+    subcategories.must_append("Other"sv);
+
+    JsonObject category;
+    category.set("name"sv, "JavaScript"sv);
+    category.set("color"sv, "yellow"sv);
+    category.set("subcategories"sv, move(subcategories));
+
+    JsonArray categories;
+    categories.must_append(move(category));
+
+    auto start_wall_time = m_start_wall_time.value_or(UnixDateTime::now());
+
+    JsonObject meta;
+    meta.set("version"sv, 27);
+    meta.set("startTime"sv, start_wall_time.milliseconds_since_epoch());
+    meta.set("shutdownTime"sv, JsonValue {});
+    meta.set("interval"sv, static_cast<double>(m_interval.to_microseconds()) / 1000);
+    meta.set("processType"sv, 0);
+    meta.set("product"sv, "Ladybird"sv);
+    meta.set("stackwalk"sv, 0);
+    meta.set("debug"sv, 0);
+    meta.set("gcpoison"sv, 0);
+    meta.set("asyncstack"sv, 0);
+    meta.set("categories"sv, move(categories));
+    meta.set("markerSchema"sv, JsonArray {});
+
+    JsonObject profile;
+    profile.set("meta"sv, move(meta));
+    profile.set("libs"sv, JsonArray {});
+    profile.set("threads"sv, move(threads));
+    profile.set("processes"sv, JsonArray {});
+    profile.set("pausedRanges"sv, JsonArray {});
+    return profile.serialized();
+}
+
+}
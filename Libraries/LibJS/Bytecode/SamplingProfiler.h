@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibJS/SourceCode.h>
+
+namespace Threading {
+class Thread;
+}
+
+namespace JS::Bytecode {
+
+// Periodically records the JavaScript call stack, and produces a profile in the format of Chrome's .cpuprofile files or
+// in the Gecko profile format that Firefox DevTools and the Firefox Profiler understand.
+//
+// A background thread requests a sample at a fixed interval, which the interpreter takes the next time it enters a
+// function or jumps. This keeps all access to the execution context stack on the thread that runs the JavaScript.
+class JS_API SamplingProfiler {
+public:
+    explicit SamplingProfiler(VM&, AK::Duration interval);
+    ~SamplingProfiler();
+
+    void start();
+    void stop();
+
+    [[nodiscard]] bool sample_requested() const { return m_sample_requested.load(AK::MemoryOrder::memory_order_relaxed); }
+    void take_sample();
+
+    [[nodiscard]] String to_cpuprofile_json() const;
+    [[nodiscard]] String to_gecko_profile_json() const;
+
+private:
+    struct Frame {
+        String function_name;
+        RefPtr<SourceCode const> source_code;
+        u32 source_offset { 0 };
+
+        bool operator==(Frame const&) const;
+    };
+    struct FrameTraits : public DefaultTraits<Frame> {
+        static unsigned hash(Frame const&);
+    };
+
+    struct Node {
+        size_t frame_index { 0 };
+        Optional<size_t> parent_index;
+        Vector<size_t> child_indices;
+        size_t hit_count { 0 };
+
+        // Samples that stopped in this node, by the source offset of the instruction they stopped at.
+        HashMap<u32, size_t> hits_by_source_offset;
+    };
+
+    Optional<size_t> frame_index_for(ExecutionContext const&);
+    size_t child_node_index(size_t parent_index, size_t frame_index);
+
+    VM& m_vm;
+    AK::Duration m_interval;
+
+    Atomic<bool> m_sample_requested { false };
+    Atomic<bool> m_running { false };
+    RefPtr<Threading::Thread> m_sampler_thread;
+
+    Vector<Frame> m_frames;
+    HashMap<Frame, size_t, FrameTraits> m_frame_indices;
+
+    Vector<Node> m_nodes;
+    // Keyed by the parent node index in the upper 32 bits, and the frame index in the lower 32 bits.
+    HashMap<u64, size_t> m_child_node_indices;
+
+    Vector<size_t> m_samples;
+    Vector<i64> m_time_deltas_in_microseconds;
+    Optional<MonotonicTime> m_start_time;
+    Optional<UnixDateTime> m_start_wall_time;
+    Optional<MonotonicTime> m_end_time;
+    Optional<MonotonicTime> m_last_sample_time;
+};
+
+}
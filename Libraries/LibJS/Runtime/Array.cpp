@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Function.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -173,6 +174,16 @@ ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object
     // 1. Let items be a new empty List.
     auto items = GC::RootVector<Value> { vm.heap() };
 
+    // OPTIMIZATION: Without holes, HasProperty is always true and Get has no side effects, so the elements can be
+    //               copied straight out of storage.
+    if (auto const* array = as_if<Array>(object)) {
+        if (auto const* storage = array->packed_elements_storage(); storage && length <= storage->array_like_size()) {
+            items.append(storage->elements().data(), length);
+            TRY(array_merge_sort(vm, sort_compare, items));
+            return items;
+        }
+    }
+
     // 2. Let k be 0.
     // 3. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
@@ -249,6 +260,26 @@ ThrowCompletionOr<double> compare_array_elements(VM& vm, Value x, Value y, Funct
         return value_number.as_double();
     }
 
+    // OPTIMIZATION: Compare the decimal representations of two int32s without allocating strings for them.
+    //               They're ASCII, so comparing bytes gives the same result as comparing code units.
+    if (x.is_int32() && y.is_int32()) {
+        auto to_decimal = [](i32 value, AK::Array<char, 11>& buffer) {
+            auto magnitude = value < 0 ? -static_cast<i64>(value) : static_cast<i64>(value);
+            size_t position = buffer.size();
+            do {
+                buffer[--position] = static_cast<char>('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude != 0);
+            if (value < 0)
+                buffer[--position] = '-';
+            return StringView { buffer.data() + position, buffer.size() - position };
+        };
+        AK::Array<char, 11> x_buffer;
+        AK::Array<char, 11> y_buffer;
+        auto result = to_decimal(x.as_i32(), x_buffer).compare(to_decimal(y.as_i32(), y_buffer));
+        return result < 0 ? -1 : (result > 0 ? 1 : 0);
+    }
+
     // 5. Let xString be ? ToString(x).
     auto x_string = PrimitiveString::create(vm, TRY(x.to_string(vm)));
 
@@ -299,6 +330,19 @@ ThrowCompletionOr<Optional<PropertyDescriptor>> Array::internal_get_own_property
     return Object::internal_get_own_property(property_key);
 }
 
+SimpleIndexedPropertyStorage const* Array::packed_elements_storage() const
+{
+    if (may_interfere_with_indexed_property_access())
+        return nullptr;
+    auto const* storage = indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*storage);
+    if (simple_storage.has_empty_elements())
+        return nullptr;
+    return &simple_storage;
+}
+
 bool Array::default_prototype_chain_intact() const
 {
     auto const& intrinsics = m_realm->intrinsics();
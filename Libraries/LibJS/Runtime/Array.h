@@ -62,6 +62,14 @@ public:
 
     bool default_prototype_chain_intact() const;
 
+    // OPTIMIZATION: Returns the element storage if every index below the length holds a plain data property, so that
+    //               elements can be read directly from it without consulting the prototype chain.
+    SimpleIndexedPropertyStorage const* packed_elements_storage() const;
+    SimpleIndexedPropertyStorage* packed_elements_storage()
+    {
+        return const_cast<SimpleIndexedPropertyStorage*>(const_cast<Array const&>(*this).packed_elements_storage());
+    }
+
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
 protected:
@@ -379,6 +379,16 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::fill)
     else
         to = min(relative_end, length);
 
+    // OPTIMIZATION: Packed array elements are writable data properties, so they can be overwritten in storage directly.
+    //               This has to be checked after the conversions above, as they may have run user code.
+    if (auto* array = as_if<Array>(*this_object); array && !array->is_proxy_target()) {
+        if (auto* storage = array->packed_elements_storage(); storage && to <= storage->array_like_size()) {
+            for (u64 i = from; i < to; i++)
+                storage->put(i, vm.argument(0));
+            return this_object;
+        }
+    }
+
     for (u64 i = from; i < to; i++)
         TRY(this_object->set(i, vm.argument(0), Object::ShouldThrowExceptions::Yes));
 
@@ -719,6 +729,23 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     return js_undefined();
 }
 
+enum class PackedElementsSearch {
+    NoMatchPossible,
+    CompareEncoded,
+    Generic,
+};
+
+// OPTIMIZATION: Storage that only holds numbers can't contain anything that's equal to a non-number, and int32 storage
+//               searched for an int32 can be compared bit for bit.
+static PackedElementsSearch packed_elements_search(SimpleIndexedPropertyStorage const& storage, Value search_element)
+{
+    if (storage.holds_only_numbers() && !search_element.is_number())
+        return PackedElementsSearch::NoMatchPossible;
+    if (storage.elements_kind() == SimpleIndexedPropertyStorage::ElementsKind::Int32 && search_element.is_int32())
+        return PackedElementsSearch::CompareEncoded;
+    return PackedElementsSearch::Generic;
+}
+
 // 23.1.3.16 Array.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-array.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
 {
@@ -742,6 +769,22 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Packed array elements can be searched without going through Get, which has no side effects for them.
+    if (auto* array = as_if<Array>(*this_object)) {
+        if (auto const* storage = array->packed_elements_storage(); storage && length <= storage->array_like_size()) {
+            auto search = packed_elements_search(*storage, value_to_find);
+            if (search == PackedElementsSearch::NoMatchPossible)
+                return Value(false);
+            auto const* elements = storage->elements().data();
+            for (u64 i = from_index; i < length; ++i) {
+                if (search == PackedElementsSearch::CompareEncoded ? elements[i].encoded() == value_to_find.encoded() : same_value_zero(elements[i], value_to_find))
+                    return Value(true);
+            }
+            return Value(false);
+        }
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -795,6 +838,21 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    // OPTIMIZATION: Packed array elements are all present, and can be read without going through Get.
+    if (auto* array = as_if<Array>(*object)) {
+        if (auto const* storage = array->packed_elements_storage(); storage && length <= storage->array_like_size()) {
+            auto search = packed_elements_search(*storage, search_element);
+            if (search == PackedElementsSearch::NoMatchPossible)
+                return Value(-1);
+            auto const* elements = storage->elements().data();
+            for (; k < length; ++k) {
+                if (search == PackedElementsSearch::CompareEncoded ? elements[k].encoded() == search_element.encoded() : is_strictly_equal(search_element, elements[k]))
+                    return Value(k);
+            }
+            return Value(-1);
+        }
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -906,6 +964,21 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    // OPTIMIZATION: Packed array elements are all present, and can be read without going through Get.
+    if (auto* array = as_if<Array>(*object)) {
+        if (auto const* storage = array->packed_elements_storage(); storage && length <= storage->array_like_size()) {
+            auto search = packed_elements_search(*storage, search_element);
+            if (search == PackedElementsSearch::NoMatchPossible)
+                return Value(-1);
+            auto const* elements = storage->elements().data();
+            for (; k >= 0; --k) {
+                if (search == PackedElementsSearch::CompareEncoded ? elements[k].encoded() == search_element.encoded() : is_strictly_equal(search_element, elements[k]))
+                    return Value((size_t)k);
+            }
+            return Value(-1);
+        }
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
@@ -952,22 +1025,37 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
     // 4. Let A be ? ArraySpeciesCreate(O, len).
     auto* array = TRY(array_species_create(vm, object, length));
 
+    auto* object_as_array = as_if<Array>(*object);
+
     // 5. Let k be 0.
     // 6. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
-        // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
+        Optional<Value> k_value;
 
-        // c. If kPresent is true, then
-        if (k_present) {
-            // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
+        // OPTIMIZATION: Elements of packed arrays are present and can be read directly. The callback may change the
+        //               array, so this is checked again for every element.
+        if (object_as_array) {
+            if (auto const* storage = object_as_array->packed_elements_storage(); storage && k < storage->array_like_size())
+                k_value = storage->elements()[k];
+        }
+
+        if (!k_value.has_value()) {
+            // b. Let kPresent be ? HasProperty(O, Pk).
+            auto k_present = TRY(object->has_property(property_key));
+
+            // c. If kPresent is true, then
+            if (k_present) {
+                // i. Let kValue be ? Get(O, Pk).
+                k_value = TRY(object->get(property_key));
+            }
+        }
 
+        if (k_value.has_value()) {
             // ii. Let mappedValue be ? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »).
-            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object));
+            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, *k_value, Value(k), object));
 
             // iii. Perform ? CreateDataPropertyOrThrow(A, Pk, mappedValue).
             TRY(array->create_data_property_or_throw(property_key, mapped_value));
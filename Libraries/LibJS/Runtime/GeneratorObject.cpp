@@ -13,6 +13,7 @@
 #include <LibJS/Runtime/GeneratorResult.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Iterator.h>
+#include <LibJS/Runtime/NativeFunction.h>
 
 namespace JS {
 
@@ -125,6 +126,28 @@ ThrowCompletionOr<GeneratorObject::IterationResult> GeneratorObject::execute(VM&
     return IterationResult(generated_value(m_previous_value), done);
 }
 
+BuiltinIterator* GeneratorObject::as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const& iterator_record)
+{
+    if (iterator_record.next_method.is_object()) {
+        auto const& next_function = iterator_record.next_method.as_object();
+        if (next_function.is_native_function()) {
+            auto const& native_function = static_cast<NativeFunction const&>(next_function);
+            if (native_function.is_generator_prototype_next_builtin())
+                return this;
+        }
+    }
+    return nullptr;
+}
+
+// OPTIMIZATION: This is %GeneratorPrototype%.next() without creating an iterator result object.
+ThrowCompletionOr<void> GeneratorObject::next(VM& vm, bool& done, Value& value)
+{
+    auto iteration_result = TRY(resume(vm, js_undefined(), {}));
+    done = iteration_result.done;
+    value = iteration_result.value;
+    return {};
+}
+
 // 27.5.3.3 GeneratorResume ( generator, value, generatorBrand ), https://tc39.es/ecma262/#sec-generatorresume
 ThrowCompletionOr<GeneratorObject::IterationResult> GeneratorObject::resume(VM& vm, Value value, Optional<StringView> const& generator_brand)
 {
@@ -8,11 +8,13 @@
 
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/Object.h>
 
 namespace JS {
 
-class GeneratorObject : public Object {
+class GeneratorObject : public Object
+    , public BuiltinIterator {
     JS_OBJECT(GeneratorObject, Object);
     GC_DECLARE_ALLOCATOR(GeneratorObject);
 
@@ -36,6 +38,10 @@ public:
     ThrowCompletionOr<IterationResult> resume(VM&, Value value, Optional<StringView> const& generator_brand);
     ThrowCompletionOr<IterationResult> resume_abrupt(VM&, JS::Completion abrupt_completion, Optional<StringView> const& generator_brand);
 
+    virtual BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const&) override;
+    virtual ThrowCompletionOr<void> next(VM&, bool& done, Value& value) override;
+    virtual bool may_have_return_method() const override { return true; }
+
     enum class GeneratorState {
         SuspendedStart,
         SuspendedYield,
@@ -17,6 +17,8 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     : IndexedPropertyStorage(IsSimpleStorage::Yes, initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements)
+        update_elements_kind(value);
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -59,6 +61,7 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     if (value.is_special_empty_value()) {
         ++m_number_of_empty_elements;
     }
+    update_elements_kind(value);
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
@@ -74,6 +77,7 @@ ValueAndAttributes SimpleIndexedPropertyStorage::take_first()
         --m_number_of_empty_elements;
     }
     m_array_size--;
+    reset_elements_kind_if_empty();
     return { m_packed_elements.take_first(), default_attributes };
 }
 
@@ -85,6 +89,7 @@ ValueAndAttributes SimpleIndexedPropertyStorage::take_last()
         --m_number_of_empty_elements;
     }
     m_packed_elements[m_array_size] = js_special_empty_value();
+    reset_elements_kind_if_empty();
     return { last_element, default_attributes };
 }
 
@@ -106,6 +111,7 @@ bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
                 ++m_number_of_empty_elements;
         }
     }
+    reset_elements_kind_if_empty();
 
     return true;
 }
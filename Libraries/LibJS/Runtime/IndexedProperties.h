@@ -95,12 +95,36 @@ public:
 
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    // The kind of values held by the storage, not counting holes. Kinds only ever get more general while the storage
+    // holds elements, so code that checked the kind can rely on it until it writes to the storage or runs user code.
+    // NOTE: The kind only describes the elements. They are always stored as Values, never as raw i32s or doubles.
+    enum class ElementsKind : u8 {
+        Int32,
+        Number,
+        Any,
+    };
+    ElementsKind elements_kind() const { return m_elements_kind; }
+    bool holds_only_numbers() const { return m_elements_kind != ElementsKind::Any; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    void update_elements_kind(Value value)
+    {
+        if (m_elements_kind == ElementsKind::Any || value.is_int32() || value.is_special_empty_value())
+            return;
+        m_elements_kind = value.is_number() ? ElementsKind::Number : ElementsKind::Any;
+    }
+    void reset_elements_kind_if_empty()
+    {
+        if (m_array_size == 0)
+            m_elements_kind = ElementsKind::Int32;
+    }
+
     Checked<size_t> m_number_of_empty_elements { 0 };
+    ElementsKind m_elements_kind { ElementsKind::Int32 };
     Vector<Value> m_packed_elements;
 };
 
@@ -313,6 +313,7 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
 
     m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm.names.values).as_function();
     m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm.names.now).as_function();
+    m_function_prototype_symbol_has_instance_function = &m_function_prototype->get_without_side_effects(vm.well_known_symbol_has_instance()).as_function();
     m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
     m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
     m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
@@ -444,6 +445,7 @@ void Intrinsics::visit_edges(Visitor& visitor)
     visitor.visit(m_unescape_function);
     visitor.visit(m_array_prototype_values_function);
     visitor.visit(m_date_constructor_now_function);
+    visitor.visit(m_function_prototype_symbol_has_instance_function);
     visitor.visit(m_eval_function);
     visitor.visit(m_json_parse_function);
     visitor.visit(m_json_stringify_function);
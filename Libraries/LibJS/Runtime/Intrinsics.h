@@ -89,6 +89,7 @@ public:
     // Namespace/constructor object functions
     GC::Ref<FunctionObject> array_prototype_values_function() const { return *m_array_prototype_values_function; }
     GC::Ref<FunctionObject> date_constructor_now_function() const { return *m_date_constructor_now_function; }
+    GC::Ref<FunctionObject> function_prototype_symbol_has_instance_function() const { return *m_function_prototype_symbol_has_instance_function; }
     GC::Ref<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
     GC::Ref<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
     GC::Ref<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
@@ -216,6 +217,7 @@ private:
     // Namespace/constructor object functions
     GC::Ptr<FunctionObject> m_array_prototype_values_function;
     GC::Ptr<FunctionObject> m_date_constructor_now_function;
+    GC::Ptr<FunctionObject> m_function_prototype_symbol_has_instance_function;
     GC::Ptr<FunctionObject> m_json_parse_function;
     GC::Ptr<FunctionObject> m_json_stringify_function;
     GC::Ptr<FunctionObject> m_object_prototype_to_string_function;
@@ -75,6 +75,9 @@ class BuiltinIterator {
 public:
     virtual ~BuiltinIterator() = default;
     virtual ThrowCompletionOr<void> next(VM&, bool& done, Value& value) = 0;
+
+    // Whether closing the iterator has to look up and call a "return" method.
+    virtual bool may_have_return_method() const { return false; }
 };
 
 struct IterationResult {
@@ -4,11 +4,17 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
+#include <AK/CharacterTypes.h>
 #include <AK/Function.h>
+#include <AK/GenericLexer.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringConversions.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
@@ -25,6 +31,7 @@
 #include <LibJS/Runtime/RawJSONObject.h>
 #include <LibJS/Runtime/StringObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <typeinfo>
 
 namespace JS {
 
@@ -110,7 +117,9 @@ ThrowCompletionOr<Optional<String>> JSONObject::stringify_impl(VM& vm, Value val
 
     auto wrapper = Object::create(realm, realm.intrinsics().object_prototype());
     MUST(wrapper->create_data_property_or_throw(Utf16String {}, value));
-    return serialize_json_property(vm, state, Utf16String {}, wrapper);
+    if (!TRY(serialize_json_property(vm, state, Utf16String {}, wrapper)))
+        return Optional<String> {};
+    return state.builder.to_string_without_validation();
 }
 
 // 25.5.2 JSON.stringify ( value [ , replacer [ , space ] ] ), https://tc39.es/ecma262/#sec-json.stringify
@@ -130,13 +139,24 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::stringify)
     return PrimitiveString::create(vm, maybe_string.release_value());
 }
 
+// NOTE: Rather than returning a string per property that the caller concatenates, serialization appends to a single
+//       buffer in StringifyState, and these return whether anything was appended (i.e. the spec's result was not undefined).
+
 // 25.5.2.1 SerializeJSONProperty ( state, key, holder ), https://tc39.es/ecma262/#sec-serializejsonproperty
 // 1.4.1 SerializeJSONProperty ( state, key, holder ), https://tc39.es/proposal-json-parse-with-source/#sec-serializejsonproperty
-ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder)
+ThrowCompletionOr<bool> JSONObject::serialize_json_property(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder)
 {
     // 1. Let value be ? Get(holder, key).
     auto value = TRY(holder->get(key));
 
+    return serialize_json_property_value(vm, state, key, holder, value);
+}
+
+// Steps 2 and onwards of SerializeJSONProperty, for callers that already got the value from the holder.
+ThrowCompletionOr<bool> JSONObject::serialize_json_property_value(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder, Value value)
+{
+    auto& builder = state.builder;
+
     // 2. If Type(value) is Object or BigInt, then
     if (value.is_object() || value.is_bigint()) {
         // a. Let toJSON be ? GetV(value, "toJSON").
@@ -162,7 +182,8 @@ ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm,
         // a. If value has an [[IsRawJSON]] internal slot, then
         if (is<RawJSONObject>(value_object)) {
             // i. Return ! Get(value, "rawJSON").
-            return MUST(value_object.get(vm.names.rawJSON)).as_string().utf8_string();
+            builder.append(MUST(value_object.get(vm.names.rawJSON)).as_string().utf8_string_view());
+            return true;
         }
         // b. If value has a [[NumberData]] internal slot, then
         if (is<NumberObject>(value_object)) {
@@ -187,26 +208,39 @@ ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm,
     }
 
     // 5. If value is null, return "null".
-    if (value.is_null())
-        return "null"_string;
+    if (value.is_null()) {
+        builder.append("null"sv);
+        return true;
+    }
 
     // 6. If value is true, return "true".
     // 7. If value is false, return "false".
-    if (value.is_boolean())
-        return value.as_bool() ? "true"_string : "false"_string;
+    if (value.is_boolean()) {
+        builder.append(value.as_bool() ? "true"sv : "false"sv);
+        return true;
+    }
 
     // 8. If Type(value) is String, return QuoteJSONString(value).
-    if (value.is_string())
-        return quote_json_string(value.as_string().utf16_string_view());
+    if (value.is_string()) {
+        auto const& string = value.as_string();
+        if (string.has_utf8_string())
+            quote_json_string(builder, string.utf8_string_view());
+        else
+            quote_json_string(builder, string.utf16_string_view());
+        return true;
+    }
 
     // 9. If Type(value) is Number, then
     if (value.is_number()) {
         // a. If value is finite, return ! ToString(value).
-        if (value.is_finite_number())
-            return MUST(value.to_string(vm));
-
+        if (value.is_int32())
+            builder.appendff("{}", value.as_i32());
+        else if (value.is_finite_number())
+            builder.append(MUST(value.to_string(vm)));
         // b. Return "null".
-        return "null"_string;
+        else
+            builder.append("null"sv);
+        return true;
     }
 
     // 10. If Type(value) is BigInt, throw a TypeError exception.
@@ -220,38 +254,77 @@ ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm,
 
         // b. If isArray is true, return ? SerializeJSONArray(state, value).
         if (is_array)
-            return TRY(serialize_json_array(vm, state, value.as_object()));
-
+            TRY(serialize_json_array(vm, state, value.as_object()));
         // c. Return ? SerializeJSONObject(state, value).
-        return TRY(serialize_json_object(vm, state, value.as_object()));
+        else
+            TRY(serialize_json_object(vm, state, value.as_object()));
+        return true;
     }
 
     // 12. Return undefined.
-    return Optional<String> {};
+    return false;
+}
+
+void JSONObject::append_line_break_and_indent(StringifyState& state)
+{
+    state.builder.append('\n');
+    for (size_t i = 0; i < state.indent_level; ++i)
+        state.builder.append(state.gap);
+}
+
+// Whether the string-keyed own properties of this object can be read straight from its shape and storage, in the
+// same order [[OwnPropertyKeys]] would produce them. This holds for plain objects without integer-keyed properties.
+// NOTE: Dictionary shapes are changed in place when properties are added or removed, so a toJSON or replacer function
+//       could move the offsets we took from the shape without us noticing.
+static bool can_enumerate_properties_through_shape(Object const& object)
+{
+    return (object.is_plain_object() || typeid(object) == typeid(Object))
+        && !object.shape().is_dictionary()
+        && !object.has_intrinsic_accessors()
+        && object.indexed_properties().array_like_size() == 0;
 }
 
 // 25.5.2.4 SerializeJSONObject ( state, value ), https://tc39.es/ecma262/#sec-serializejsonobject
-ThrowCompletionOr<String> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
+ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
 {
+    auto& builder = state.builder;
+
     if (state.seen_objects.contains(&object))
         return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
 
     state.seen_objects.set(&object);
-    String previous_indent = state.indent;
-    state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
-    Vector<String> property_strings;
+    ++state.indent_level;
+    builder.append('{');
+    bool has_properties = false;
 
-    auto process_property = [&](PropertyKey const& key) -> ThrowCompletionOr<void> {
+    auto process_property = [&](PropertyKey const& key, Optional<Value> value = {}) -> ThrowCompletionOr<void> {
         if (key.is_symbol())
             return {};
-        auto serialized_property_string = TRY(serialize_json_property(vm, state, key, &object));
-        if (serialized_property_string.has_value()) {
-            property_strings.append(MUST(String::formatted(
-                "{}:{}{}",
-                quote_json_string(key.to_string()),
-                state.gap.is_empty() ? "" : " ",
-                serialized_property_string)));
+
+        // NOTE: The separator and key are written before we know whether the value serializes to anything, and are
+        //       removed again if it doesn't.
+        auto length_before_property = builder.length();
+        if (has_properties)
+            builder.append(',');
+        if (!state.gap.is_empty())
+            append_line_break_and_indent(state);
+        if (key.is_string()) {
+            quote_json_string(builder, key.as_string().view());
+        } else {
+            auto key_string = key.to_string();
+            quote_json_string(builder, key_string.utf16_view());
         }
+        builder.append(':');
+        if (!state.gap.is_empty())
+            builder.append(' ');
+
+        auto did_serialize = value.has_value()
+            ? TRY(serialize_json_property_value(vm, state, key, &object, *value))
+            : TRY(serialize_json_property(vm, state, key, &object));
+        if (did_serialize)
+            has_properties = true;
+        else
+            builder.trim(builder.length() - length_before_property);
         return {};
     };
 
@@ -259,111 +332,94 @@ ThrowCompletionOr<String> JSONObject::serialize_json_object(VM& vm, StringifySta
         auto property_list = state.property_list.value();
         for (auto& property : property_list)
             TRY(process_property(property));
+    } else if (can_enumerate_properties_through_shape(object)) {
+        // OPTIMIZATION: Take the keys from the shape's property table, and as long as the object keeps that shape,
+        //               read data properties straight from its storage instead of going through [[Get]].
+        GC::Ref<Shape const> shape = object.shape();
+        Vector<PropertyKey> keys;
+        Vector<u32> offsets;
+        for (auto const& [key, metadata] : shape->property_table()) {
+            if (!key.is_string() || !metadata.attributes.is_enumerable())
+                continue;
+            keys.append(key);
+            offsets.append(metadata.offset);
+        }
+
+        // NOTE: If a toJSON or replacer function changes the object's shape, we go back to [[Get]] for the remaining keys.
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (&object.shape() == shape.ptr()) {
+                auto value = object.get_direct(offsets[i]);
+                if (!value.is_accessor()) {
+                    TRY(process_property(keys[i], value));
+                    continue;
+                }
+            }
+            TRY(process_property(keys[i]));
+        }
     } else {
         auto property_list = TRY(object.enumerable_own_property_names(PropertyKind::Key));
         for (auto& property : property_list)
             TRY(process_property(property.as_string().utf16_string()));
     }
-    StringBuilder builder;
-    if (property_strings.is_empty()) {
-        builder.append("{}"sv);
-    } else {
-        bool first = true;
-        builder.append('{');
-        if (state.gap.is_empty()) {
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(',');
-                first = false;
-                builder.append(property_string);
-            }
-        } else {
-            builder.append('\n');
-            builder.append(state.indent);
-            auto separator = MUST(String::formatted(",\n{}", state.indent));
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(separator);
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append('\n');
-            builder.append(previous_indent);
-        }
-        builder.append('}');
-    }
+
+    --state.indent_level;
+    if (has_properties && !state.gap.is_empty())
+        append_line_break_and_indent(state);
+    builder.append('}');
 
     state.seen_objects.remove(&object);
-    state.indent = previous_indent;
-    return builder.to_string_without_validation();
+    return {};
 }
 
 // 25.5.2.5 SerializeJSONArray ( state, value ), https://tc39.es/ecma262/#sec-serializejsonarray
-ThrowCompletionOr<String> JSONObject::serialize_json_array(VM& vm, StringifyState& state, Object& object)
+ThrowCompletionOr<void> JSONObject::serialize_json_array(VM& vm, StringifyState& state, Object& object)
 {
+    auto& builder = state.builder;
+
     if (state.seen_objects.contains(&object))
         return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
 
     state.seen_objects.set(&object);
-    String previous_indent = state.indent;
-    state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
-    Vector<String> property_strings;
+    ++state.indent_level;
+    builder.append('[');
 
     auto length = TRY(length_of_array_like(vm, object));
 
-    // Optimization
-    property_strings.ensure_capacity(length);
+    // OPTIMIZATION: Elements of ordinary arrays that are stored as data properties can be read without going through [[Get]].
+    bool can_read_indexed_storage = is<Array>(object) && !object.may_interfere_with_indexed_property_access();
 
     for (size_t i = 0; i < length; ++i) {
-        auto serialized_property_string = TRY(serialize_json_property(vm, state, i, &object));
-        if (!serialized_property_string.has_value()) {
-            property_strings.append("null"_string);
-        } else {
-            property_strings.append(serialized_property_string.release_value());
+        if (i > 0)
+            builder.append(',');
+        if (!state.gap.is_empty())
+            append_line_break_and_indent(state);
+
+        Optional<Value> value;
+        if (can_read_indexed_storage) {
+            if (auto element = object.indexed_properties().get(i); element.has_value() && !element->value.is_accessor())
+                value = element->value;
         }
-    }
 
-    StringBuilder builder;
-    if (property_strings.is_empty()) {
-        builder.append("[]"sv);
-    } else {
-        if (state.gap.is_empty()) {
-            builder.append('[');
-            bool first = true;
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(',');
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append(']');
-        } else {
-            builder.append("[\n"sv);
-            builder.append(state.indent);
-            auto separator = MUST(String::formatted(",\n{}", state.indent));
-            bool first = true;
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(separator);
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append('\n');
-            builder.append(previous_indent);
-            builder.append(']');
-        }
+        auto did_serialize = value.has_value()
+            ? TRY(serialize_json_property_value(vm, state, i, &object, *value))
+            : TRY(serialize_json_property(vm, state, i, &object));
+        if (!did_serialize)
+            builder.append("null"sv);
     }
 
+    --state.indent_level;
+    if (length > 0 && !state.gap.is_empty())
+        append_line_break_and_indent(state);
+    builder.append(']');
+
     state.seen_objects.remove(&object);
-    state.indent = previous_indent;
-    return builder.to_string_without_validation();
+    return {};
 }
 
 // 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
-String JSONObject::quote_json_string(Utf16View const& string)
+void JSONObject::quote_json_string(StringBuilder& builder, Utf16View const& string)
 {
     // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
-    StringBuilder builder;
     builder.append('"');
 
     // 2. For each code point C of StringToCodePoints(value), do
@@ -409,9 +465,53 @@ String JSONObject::quote_json_string(Utf16View const& string)
 
     // 3. Set product to the string-concatenation of product and the code unit 0x0022 (QUOTATION MARK).
     builder.append('"');
+}
 
-    // 4. Return product.
-    return builder.to_string_without_validation();
+// Same as above, for strings that are stored as UTF-8. These can't contain surrogates, and every code point that needs
+// escaping is ASCII, so everything in between can be copied over in runs.
+void JSONObject::quote_json_string(StringBuilder& builder, StringView string)
+{
+    builder.append('"');
+
+    size_t run_start = 0;
+    for (size_t i = 0; i < string.length(); ++i) {
+        auto ch = static_cast<u8>(string[i]);
+        if (ch >= 0x20 && ch != '"' && ch != '\\')
+            continue;
+
+        builder.append(string.substring_view(run_start, i - run_start));
+        run_start = i + 1;
+
+        switch (ch) {
+        case '\b':
+            builder.append("\\b"sv);
+            break;
+        case '\t':
+            builder.append("\\t"sv);
+            break;
+        case '\n':
+            builder.append("\\n"sv);
+            break;
+        case '\f':
+            builder.append("\\f"sv);
+            break;
+        case '\r':
+            builder.append("\\r"sv);
+            break;
+        case '"':
+            builder.append("\\\""sv);
+            break;
+        case '\\':
+            builder.append("\\\\"sv);
+            break;
+        default:
+            builder.appendff("\\u{:04x}", ch);
+            break;
+        }
+    }
+    builder.append(string.substring_view(run_start));
+
+    builder.append('"');
 }
 
 // 25.5.1 JSON.parse ( text [ , reviver ] ), https://tc39.es/ecma262/#sec-json.parse
@@ -447,10 +547,372 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     return unfiltered;
 }
 
+// Parses JSON text straight into JS values, accepting exactly the same grammar as AK::JsonParser, but without
+// building an intermediate JsonValue tree first.
+class JSONTextParser : public GenericLexer {
+public:
+    JSONTextParser(VM& vm, StringView input)
+        : GenericLexer(input)
+        , m_vm(vm)
+        , m_realm(*vm.current_realm())
+    {
+    }
+
+    ErrorOr<Value> parse()
+    {
+        LayoutCache root_cache;
+        auto result = TRY(parse_value(root_cache));
+        ignore_while(is_space);
+        if (!is_eof())
+            return AK::Error::from_string_literal("JSON: Didn't consume all input");
+        return result;
+    }
+
+private:
+    // Objects found at the same position in a document (the elements of one array, the values of one key in those
+    // elements, and so on) usually have the same keys in the same order. We remember the keys and the resulting shape
+    // of the last such object, so the next one can be created with that shape right away, instead of going through
+    // a shape transition and a property lookup for every key.
+    struct LayoutCache {
+        Vector<String> keys;
+        GC::Root<Shape> shape;
+        Vector<OwnPtr<LayoutCache>> property_caches;
+        OwnPtr<LayoutCache> element_cache;
+
+        LayoutCache& property_cache(size_t index)
+        {
+            if (index >= property_caches.size())
+                property_caches.resize(index + 1);
+            if (!property_caches[index])
+                property_caches[index] = make<LayoutCache>();
+            return *property_caches[index];
+        }
+
+        LayoutCache& elements()
+        {
+            if (!element_cache)
+                element_cache = make<LayoutCache>();
+            return *element_cache;
+        }
+    };
+
+    static constexpr bool is_space(char ch)
+    {
+        return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+    }
+
+    // Returns how many bytes at the start of `input` can be copied into a string as they are, i.e. up to the first
+    // quotation mark, reverse solidus or control character.
+    static size_t count_literal_string_bytes(StringView input)
+    {
+        auto const* bytes = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+        size_t index = 0;
+
+        for (; index + sizeof(AK::SIMD::u8x16) <= input.length(); index += sizeof(AK::SIMD::u8x16)) {
+            auto chunk = AK::SIMD::load_unaligned<AK::SIMD::u8x16>(bytes + index);
+            auto special = (chunk == static_cast<u8>('"')) | (chunk == static_cast<u8>('\\')) | (chunk < static_cast<u8>(0x20));
+            auto special_bits = bit_cast<AK::SIMD::u64x2>(special);
+            if ((special_bits[0] | special_bits[1]) != 0)
+                break;
+        }
+
+        for (; index < input.length(); ++index) {
+            auto ch = bytes[index];
+            if (ch == '"' || ch == '\\' || ch < 0x20)
+                break;
+        }
+        return index;
+    }
+
+    // Returns a view into the input if the string has no escapes, or into `buffer` otherwise.
+    ErrorOr<StringView> consume_string(StringBuilder& buffer)
+    {
+        if (!consume_specific('"'))
+            return AK::Error::from_string_literal("JSON: Expected '\"'");
+
+        bool has_escapes = false;
+        for (;;) {
+            auto literal_length = count_literal_string_bytes(m_input.substring_view(m_index));
+            auto literal = consume(literal_length);
+
+            char ch = peek();
+            if (ch == '"' && !has_escapes) {
+                ignore();
+                return literal;
+            }
+            if (!has_escapes) {
+                buffer.clear();
+                has_escapes = true;
+            }
+            buffer.append(literal);
+
+            // Note: We get a 0 byte when we hit EOF.
+            if (ch == '\0')
+                return AK::Error::from_string_literal("JSON: EOF while parsing String");
+            if (is_ascii_c0_control(ch))
+                return AK::Error::from_string_literal("JSON: ASCII control sequence encountered");
+            if (ch == '"') {
+                ignore();
+                return buffer.string_view();
+            }
+
+            ignore(); // '\'
+
+            switch (peek()) {
+            case '"':
+            case '\\':
+            case '/':
+                buffer.append(consume());
+                break;
+            case 'b':
+                ignore();
+                buffer.append('\b');
+                break;
+            case 'f':
+                ignore();
+                buffer.append('\f');
+                break;
+            case 'n':
+                ignore();
+                buffer.append('\n');
+                break;
+            case 'r':
+                ignore();
+                buffer.append('\r');
+                break;
+            case 't':
+                ignore();
+                buffer.append('\t');
+                break;
+            case 'u': {
+                ignore(); // 'u'
+                auto code_point = decode_single_or_paired_surrogate();
+                if (code_point.is_error())
+                    return AK::Error::from_string_literal("JSON: Error while parsing Unicode escape");
+                buffer.append_code_point(code_point.value());
+                break;
+            }
+            default:
+                return AK::Error::from_string_literal("JSON: Invalid escaped character");
+            }
+        }
+    }
+
+    ErrorOr<Value> parse_value(LayoutCache& cache)
+    {
+        ignore_while(is_space);
+        switch (peek()) {
+        case '{':
+            return parse_object(cache);
+        case '[':
+            return parse_array(cache);
+        case '"': {
+            auto string = TRY(consume_string(m_string_buffer));
+            return PrimitiveString::create(m_vm, String::from_utf8_without_validation(string.bytes()));
+        }
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            return parse_number();
+        case 'f':
+            if (!consume_specific("false"sv))
+                return AK::Error::from_string_literal("JSON: Expected 'false'");
+            return Value(false);
+        case 't':
+            if (!consume_specific("true"sv))
+                return AK::Error::from_string_literal("JSON: Expected 'true'");
+            return Value(true);
+        case 'n':
+            if (!consume_specific("null"sv))
+                return AK::Error::from_string_literal("JSON: Expected 'null'");
+            return js_null();
+        }
+        return AK::Error::from_string_literal("JSON: Unexpected character");
+    }
+
+    ErrorOr<Value> parse_number()
+    {
+        auto start_index = tell();
+
+        bool negative = false;
+        if (peek() == '-') {
+            ignore();
+            negative = true;
+            if (!is_ascii_digit(peek()))
+                return AK::Error::from_string_literal("JSON: Unexpected '-' without further digits");
+        }
+
+        if (peek() == '0' && is_ascii_digit(peek(1)))
+            return AK::Error::from_string_literal("JSON: Cannot have leading zeros");
+
+        auto parse_as_double = [&]() -> ErrorOr<Value> {
+            auto parse_result = parse_first_number<double>(m_input.substring_view(start_index), TrimWhitespace::No);
+            if (!parse_result.has_value())
+                return AK::Error::from_string_literal("JSON: Invalid floating point");
+            m_index = start_index + parse_result->characters_parsed;
+            return Value(parse_result->value);
+        };
+
+        // Integers with up to 15 digits are exactly representable as doubles, so they can be accumulated directly.
+        static constexpr size_t max_exact_integer_digits = 15;
+        u64 integer = 0;
+        size_t digit_count = 0;
+        while (is_ascii_digit(peek())) {
+            integer = integer * 10 + parse_ascii_digit(consume());
+            ++digit_count;
+        }
+
+        char ch = peek();
+        if (ch == '.') {
+            if (!is_ascii_digit(peek(1)))
+                return AK::Error::from_string_literal("JSON: Must have digits after decimal point");
+            return parse_as_double();
+        }
+        if (ch == 'e' || ch == 'E') {
+            char next = peek(1);
+            if (!is_ascii_digit(next) && ((next != '+' && next != '-') || !is_ascii_digit(peek(2))))
+                return AK::Error::from_string_literal("JSON: Must have digits after exponent with an optional sign inbetween");
+            return parse_as_double();
+        }
+
+        if (digit_count > max_exact_integer_digits)
+            return parse_as_double();
+
+        auto value = static_cast<double>(integer);
+        return Value(negative ? -value : value);
+    }
+
+    ErrorOr<Value> parse_object(LayoutCache& cache)
+    {
+        if (!consume_specific('{'))
+            return AK::Error::from_string_literal("JSON: Expected '{'");
+
+        auto* cached_shape = cache.shape.ptr();
+        GC::Ref<Object> object = cached_shape ? Object::create_with_premade_shape(*cached_shape) : Object::create(m_realm, m_realm.intrinsics().object_prototype());
+
+        // While the keys match the cached layout, values are stored directly into the slots of the cached shape.
+        bool follows_cached_layout = cached_shape != nullptr;
+        size_t matched_key_count = 0;
+
+        // Keys of this object, collected once it no longer follows the cached layout, to replace that layout with.
+        Vector<String> keys;
+        bool can_cache_layout = true;
+
+        // Moves the properties parsed so far into a new object built with ordinary shape transitions.
+        auto leave_cached_layout = [&] {
+            auto cached_layout_object = object;
+            object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+            for (size_t i = 0; i < matched_key_count; ++i) {
+                object->define_direct_property(Utf16String::from_utf8(cache.keys[i]), cached_layout_object->get_direct(i), default_attributes);
+                keys.append(cache.keys[i]);
+            }
+            follows_cached_layout = false;
+        };
+
+        StringBuilder key_buffer;
+        for (;;) {
+            ignore_while(is_space);
+            if (peek() == '}')
+                break;
+            auto key = TRY(consume_string(key_buffer));
+            ignore_while(is_space);
+            if (!consume_specific(':'))
+                return AK::Error::from_string_literal("JSON: Expected ':'");
+            ignore_while(is_space);
+
+            if (follows_cached_layout && matched_key_count < cache.keys.size() && cache.keys[matched_key_count].bytes_as_string_view() == key) {
+                auto value = TRY(parse_value(cache.property_cache(matched_key_count)));
+                object->put_direct(matched_key_count, value);
+                ++matched_key_count;
+            } else {
+                if (follows_cached_layout)
+                    leave_cached_layout();
+
+                auto key_string = String::from_utf8_without_validation(key.bytes());
+                auto value = TRY(parse_value(cache.property_cache(keys.size())));
+
+                PropertyKey property_key { Utf16String::from_utf8(key_string) };
+                auto property_count_before = object->shape().property_count();
+                object->define_direct_property(property_key, value, default_attributes);
+
+                // Duplicate keys, integer keys, and objects too large for a cacheable shape can't be described by a
+                // list of keys and the shape they end up with.
+                if (property_key.is_number() || object->shape().is_dictionary() || object->shape().property_count() != property_count_before + 1)
+                    can_cache_layout = false;
+                keys.append(move(key_string));
+            }
+
+            ignore_while(is_space);
+            if (peek() == '}')
+                break;
+            if (!consume_specific(','))
+                return AK::Error::from_string_literal("JSON: Expected ','");
+            ignore_while(is_space);
+            if (peek() == '}')
+                return AK::Error::from_string_literal("JSON: Unexpected '}'");
+        }
+        if (!consume_specific('}'))
+            return AK::Error::from_string_literal("JSON: Expected '}'");
+
+        if (follows_cached_layout && matched_key_count != cache.keys.size())
+            leave_cached_layout();
+
+        if (!follows_cached_layout && can_cache_layout && !keys.is_empty()) {
+            cache.keys = move(keys);
+            cache.shape = GC::make_root(object->shape());
+        }
+
+        return object;
+    }
+
+    ErrorOr<Value> parse_array(LayoutCache& cache)
+    {
+        if (!consume_specific('['))
+            return AK::Error::from_string_literal("JSON: Expected '['");
+
+        auto array = MUST(Array::create(m_realm, 0));
+        auto& element_cache = cache.elements();
+
+        for (;;) {
+            ignore_while(is_space);
+            if (peek() == ']')
+                break;
+            auto element = TRY(parse_value(element_cache));
+            array->indexed_properties().append(element);
+            ignore_while(is_space);
+            if (peek() == ']')
+                break;
+            if (!consume_specific(','))
+                return AK::Error::from_string_literal("JSON: Expected ','");
+            ignore_while(is_space);
+            if (peek() == ']')
+                return AK::Error::from_string_literal("JSON: Unexpected ']'");
+        }
+        ignore_while(is_space);
+        if (!consume_specific(']'))
+            return AK::Error::from_string_literal("JSON: Expected ']'");
+
+        return array;
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    StringBuilder m_string_buffer;
+};
+
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
+    JSONTextParser parser { vm, text };
+    auto json = parser.parse();
 
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
     if (json.is_error())
@@ -461,7 +923,8 @@ ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    // NOTE: The parser above has already created the resulting values while validating the text.
+    auto result = json.release_value();
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/StringBuilder.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/Object.h>
 
@@ -32,16 +33,20 @@ private:
     struct StringifyState {
         GC::Ptr<FunctionObject> replacer_function;
         HashTable<GC::Ptr<Object>> seen_objects;
-        String indent;
+        size_t indent_level { 0 };
         String gap;
         Optional<Vector<Utf16String>> property_list;
+        StringBuilder builder;
     };
 
     // Stringify helpers
-    static ThrowCompletionOr<Optional<String>> serialize_json_property(VM&, StringifyState&, PropertyKey const& key, Object* holder);
-    static ThrowCompletionOr<String> serialize_json_object(VM&, StringifyState&, Object&);
-    static ThrowCompletionOr<String> serialize_json_array(VM&, StringifyState&, Object&);
-    static String quote_json_string(Utf16View const&);
+    static ThrowCompletionOr<bool> serialize_json_property(VM&, StringifyState&, PropertyKey const& key, Object* holder);
+    static ThrowCompletionOr<bool> serialize_json_property_value(VM&, StringifyState&, PropertyKey const& key, Object* holder, Value);
+    static ThrowCompletionOr<void> serialize_json_object(VM&, StringifyState&, Object&);
+    static ThrowCompletionOr<void> serialize_json_array(VM&, StringifyState&, Object&);
+    static void append_line_break_and_indent(StringifyState&);
+    static void quote_json_string(StringBuilder&, Utf16View const&);
+    static void quote_json_string(StringBuilder&, StringView);
 
     // Parse helpers
     static Object* parse_json_object(VM&, JsonObject const&);
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <LibJS/Runtime/Map.h>
 
 namespace JS {
@@ -23,71 +24,99 @@ Map::Map(Object& prototype)
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
-    m_entries.clear();
+    m_entries.clear_with_capacity();
+    m_indices.clear_with_capacity();
+    m_deleted_entry_count = 0;
+
+    // NOTE: Iterators continue with entries that are added after this.
+    for (auto& iterator : m_iterators)
+        iterator.m_index = 0;
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
+    auto index = m_indices.take(key);
     if (!index.has_value())
         return false;
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
+    m_entries[*index] = { js_special_empty_value(), js_undefined() };
+    ++m_deleted_entry_count;
+
+    if (m_deleted_entry_count >= 16 && m_deleted_entry_count * 2 >= m_entries.size())
+        remove_deleted_entries();
     return true;
 }
 
+void Map::remove_deleted_entries()
+{
+    // Iterators are moved to the number of live entries before their position, which is where the entry they were
+    // going to visit next ends up. Visiting them in order of position lets us do this in the same pass.
+    Vector<IteratorBase*, 4> iterators;
+    for (auto& iterator : m_iterators)
+        iterators.append(&iterator);
+    quick_sort(iterators, [](auto const* a, auto const* b) { return a->m_index < b->m_index; });
+
+    size_t next_iterator = 0;
+    size_t live_entry_count = 0;
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        while (next_iterator < iterators.size() && iterators[next_iterator]->m_index <= i)
+            iterators[next_iterator++]->m_index = live_entry_count;
+
+        auto const& entry = m_entries[i];
+        if (entry.key.is_special_empty_value())
+            continue;
+        if (live_entry_count != i) {
+            m_entries[live_entry_count] = entry;
+            m_indices.find(entry.key)->value = live_entry_count;
+        }
+        ++live_entry_count;
+    }
+    for (; next_iterator < iterators.size(); ++next_iterator)
+        iterators[next_iterator]->m_index = live_entry_count;
+
+    m_entries.shrink(live_entry_count, true);
+    m_deleted_entry_count = 0;
+}
+
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto index = m_indices.get(key); index.has_value())
+        return m_entries[*index].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return m_indices.contains(key);
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
-    }
+    auto result = m_indices.ensure(key, [&] {
+        m_entries.append({ key, value });
+        return m_entries.size() - 1;
+    });
+    m_entries[result].value = value;
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_indices.size();
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& entry : m_entries) {
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
+    // NOTE: The keys in m_indices are already visited by the walk over m_entries above.
+    visitor.ignore(m_indices);
 }
 
 }
@@ -7,7 +7,8 @@
 #pragma once
 
 #include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/IntrusiveList.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -35,69 +36,105 @@ public:
     struct EndIterator {
     };
 
-    template<bool IsConst>
-    struct IteratorImpl {
+    struct Entry {
+        Value key;
+        Value value;
+    };
+
+private:
+    // Iterators register themselves with the map, so that their positions can be adjusted when the map removes the
+    // slots left behind by deleted entries.
+    class IteratorBase {
+    public:
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            skip_deleted_entries();
+            return m_index >= m_map->m_entries.size();
         }
 
-        IteratorImpl& operator++()
+    protected:
+        explicit IteratorBase(Map const& map)
+            : m_map(map)
         {
-            ++m_index;
+            m_map->m_iterators.append(*this);
+        }
+
+        IteratorBase(IteratorBase const& other)
+            : m_map(other.m_map)
+            , m_index(other.m_index)
+        {
+            m_map->m_iterators.append(*this);
+        }
+
+        IteratorBase& operator=(IteratorBase const& other)
+        {
+            if (this == &other)
+                return *this;
+            m_map = other.m_map;
+            m_index = other.m_index;
+            m_map->m_iterators.append(*this);
             return *this;
         }
 
-        decltype(auto) operator*()
+        ~IteratorBase()
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            if (m_list_node.is_in_list())
+                m_list_node.remove();
         }
 
-        decltype(auto) operator*() const
+        void skip_deleted_entries() const
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            auto const& entries = m_map->m_entries;
+            while (m_index < entries.size() && entries[m_index].key.is_special_empty_value())
+                ++m_index;
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
-        bool operator==(EndIterator const&) const { return is_end(); }
+        GC::Ref<Map const> m_map;
+        mutable size_t m_index { 0 };
 
     private:
         friend class Map;
-        IteratorImpl(Map const& map)
-        requires(IsConst)
-            : m_map(map)
+
+        IntrusiveListNode<IteratorBase> m_list_node;
+    };
+
+public:
+    template<bool IsConst>
+    struct IteratorImpl : public IteratorBase {
+        IteratorImpl& operator++()
         {
-            ensure_index();
+            ++m_index;
+            return *this;
         }
 
-        IteratorImpl(Map& map)
-        requires(!IsConst)
-            : m_map(map)
+        Conditional<IsConst, Entry const&, Entry&> operator*()
         {
-            ensure_index();
+            skip_deleted_entries();
+            return const_cast<Conditional<IsConst, Entry const&, Entry&>>(m_map->m_entries[m_index]);
         }
 
-        void ensure_index() const
+        Entry const& operator*() const
         {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
+            skip_deleted_entries();
+            return m_map->m_entries[m_index];
         }
 
-        void ensure_next_element() const
+        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && m_map.ptr() == other.m_map.ptr(); }
+        bool operator==(EndIterator const&) const { return is_end(); }
+
+    private:
+        friend class Map;
+        IteratorImpl(Map const& map)
+        requires(IsConst)
+            : IteratorBase(map)
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
         }
 
-        Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
-        mutable size_t m_index { 0 };
+        IteratorImpl(Map& map)
+        requires(!IsConst)
+            : IteratorBase(map)
+        {
+        }
     };
 
     using Iterator = IteratorImpl<false>;
@@ -111,9 +148,15 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
-    size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    void remove_deleted_entries();
+
+    // Entries are kept in insertion order, with deleted entries left in place (with an empty key) until there are
+    // enough of them to be worth compacting. m_indices maps each key to the position of its entry.
+    Vector<Entry> m_entries;
+    HashMap<Value, size_t, ValueTraits> m_indices;
+    size_t m_deleted_entry_count { 0 };
+
+    mutable IntrusiveList<&IteratorBase::m_list_node> m_iterators;
 };
 
 }
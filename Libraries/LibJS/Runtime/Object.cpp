@@ -29,16 +29,45 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(Object);
 
+// Most objects created by scripts only have a handful of named properties, so plain objects keep the values of their
+// first properties inside themselves, rather than in a separate allocation. Other kinds of objects don't pay for these
+// slots, as they are only part of this cell type.
+// NOTE: To scripts these are just ordinary objects, so PlainObject reports its class name as "Object".
+class PlainObject final : public Object {
+    JS_OBJECT(Object, Object);
+    GC_DECLARE_ALLOCATOR(PlainObject);
+
+public:
+    static constexpr size_t inline_storage_capacity = 4;
+
+    virtual bool is_plain_object() const override { return true; }
+
+private:
+    explicit PlainObject(Shape& shape)
+        : Object(shape, m_inline_storage_slots)
+    {
+    }
+
+    PlainObject(ConstructWithPrototypeTag tag, Object& prototype)
+        : Object(tag, prototype, m_inline_storage_slots)
+    {
+    }
+
+    Value m_inline_storage_slots[inline_storage_capacity];
+};
+
+GC_DEFINE_ALLOCATOR(PlainObject);
+
 static HashMap<GC::Ptr<Object const>, HashMap<Utf16FlyString, Object::IntrinsicAccessor>> s_intrinsics;
 
 // 10.1.12 OrdinaryObjectCreate ( proto [ , additionalInternalSlotsList ] ), https://tc39.es/ecma262/#sec-ordinaryobjectcreate
 GC::Ref<Object> Object::create(Realm& realm, Object* prototype)
 {
     if (!prototype)
-        return realm.create<Object>(realm.intrinsics().empty_object_shape());
+        return realm.create<PlainObject>(realm.intrinsics().empty_object_shape());
     if (prototype == realm.intrinsics().object_prototype())
-        return realm.create<Object>(realm.intrinsics().new_object_shape());
-    return realm.create<Object>(ConstructWithPrototypeTag::Tag, *prototype);
+        return realm.create<PlainObject>(realm.intrinsics().new_object_shape());
+    return realm.create<PlainObject>(ConstructWithPrototypeTag::Tag, *prototype);
 }
 
 GC::Ref<Object> Object::create_prototype(Realm& realm, Object* prototype)
@@ -51,7 +80,7 @@ GC::Ref<Object> Object::create_prototype(Realm& realm, Object* prototype)
 
 GC::Ref<Object> Object::create_with_premade_shape(Shape& shape)
 {
-    return shape.realm().create<Object>(shape);
+    return shape.realm().create<PlainObject>(shape);
 }
 
 Object::Object(GlobalObjectTag, Realm& realm, MayInterfereWithIndexedPropertyAccess may_interfere_with_indexed_property_access)
@@ -91,6 +120,22 @@ Object::Object(Shape& shape, MayInterfereWithIndexedPropertyAccess may_interfere
     m_storage.resize(shape.property_count());
 }
 
+Object::Object(Shape& shape, Span<Value> inline_storage)
+    : m_inline_storage_capacity(static_cast<u8>(inline_storage.size()))
+    , m_shape(&shape)
+    , m_inline_storage(inline_storage.data())
+{
+    if (shape.property_count() > m_inline_storage_capacity)
+        m_storage.resize(shape.property_count() - m_inline_storage_capacity);
+}
+
+Object::Object(ConstructWithPrototypeTag tag, Object& prototype, Span<Value> inline_storage)
+    : Object(tag, prototype)
+{
+    m_inline_storage_capacity = static_cast<u8>(inline_storage.size());
+    m_inline_storage = inline_storage.data();
+}
+
 Object::~Object()
 {
     if (m_has_intrinsic_accessors)
@@ -104,7 +149,37 @@ void Object::initialize(Realm&)
 void Object::unsafe_set_shape(Shape& shape)
 {
     m_shape = shape;
-    m_storage.resize(shape.property_count());
+    resize_storage(shape.property_count());
+}
+
+void Object::resize_storage(size_t property_count)
+{
+    for (size_t i = property_count; i < m_inline_storage_capacity; ++i)
+        m_inline_storage[i] = {};
+    m_storage.resize(property_count > m_inline_storage_capacity ? property_count - m_inline_storage_capacity : 0);
+}
+
+void Object::append_to_storage(size_t offset, Value value)
+{
+    if (offset < m_inline_storage_capacity) {
+        m_inline_storage[offset] = value;
+        return;
+    }
+    VERIFY(offset - m_inline_storage_capacity == m_storage.size());
+    m_storage.append(value);
+}
+
+void Object::remove_from_storage(size_t offset)
+{
+    if (offset >= m_inline_storage_capacity) {
+        m_storage.remove(offset - m_inline_storage_capacity);
+        return;
+    }
+
+    // The values after the removed one move down a slot, so the first out-of-line value moves into the inline storage.
+    for (size_t i = offset; i + 1 < m_inline_storage_capacity; ++i)
+        m_inline_storage[i] = m_inline_storage[i + 1];
+    m_inline_storage[m_inline_storage_capacity - 1] = m_storage.is_empty() ? Value {} : m_storage.take_first();
 }
 
 // 7.2 Testing and Comparison Operations, https://tc39.es/ecma262/#sec-testing-and-comparison-operations
@@ -1193,10 +1268,10 @@ Optional<ValueAndAttributes> Object::storage_get(PropertyKey const& property_key
 
         if (m_has_intrinsic_accessors) {
             if (auto accessor = find_intrinsic_accessor(this, property_key); accessor.has_value())
-                const_cast<Object&>(*this).m_storage[metadata->offset] = (*accessor)(shape().realm());
+                const_cast<Object&>(*this).storage_slot(metadata->offset) = (*accessor)(shape().realm());
         }
 
-        value = m_storage[metadata->offset];
+        value = storage_slot(metadata->offset);
         attributes = metadata->attributes;
         property_offset = metadata->offset;
     }
@@ -1237,7 +1312,7 @@ void Object::storage_set(PropertyKey const& property_key, ValueAndAttributes con
             m_shape->add_property_without_transition(property_key, attributes);
         else
             set_shape(*m_shape->create_put_transition(property_key, attributes));
-        m_storage.append(value);
+        append_to_storage(m_shape->property_count() - 1, value);
         return;
     }
 
@@ -1248,7 +1323,7 @@ void Object::storage_set(PropertyKey const& property_key, ValueAndAttributes con
             set_shape(*m_shape->create_configure_transition(property_key, attributes));
     }
 
-    m_storage[metadata->offset] = value;
+    storage_slot(metadata->offset) = value;
 }
 
 void Object::storage_delete(PropertyKey const& property_key)
@@ -1271,11 +1346,11 @@ void Object::storage_delete(PropertyKey const& property_key)
     }
     if (m_shape->is_uncacheable_dictionary()) {
         m_shape->remove_property_without_transition(property_key, metadata->offset);
-        m_storage.remove(metadata->offset);
+        remove_from_storage(metadata->offset);
         return;
     }
     m_shape = m_shape->create_delete_transition(property_key);
-    m_storage.remove(metadata->offset);
+    remove_from_storage(metadata->offset);
 }
 
 void Object::set_prototype(Object* new_prototype)
@@ -1438,11 +1513,17 @@ void Object::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_shape);
+    for (size_t i = 0; i < m_inline_storage_capacity; ++i)
+        visitor.visit(m_inline_storage[i]);
     visitor.visit(m_storage);
 
-    m_indexed_properties.for_each_value([&visitor](auto& value) {
-        visitor.visit(value);
-    });
+    // NOTE: Storage that only holds numbers has no cells to visit.
+    auto const* indexed_storage = m_indexed_properties.storage();
+    if (!indexed_storage || !indexed_storage->is_simple_storage() || !static_cast<SimpleIndexedPropertyStorage const&>(*indexed_storage).holds_only_numbers()) {
+        m_indexed_properties.for_each_value([&visitor](auto& value) {
+            visitor.visit(value);
+        });
+    }
 
     if (m_private_elements) {
         for (auto& private_element : *m_private_elements)
@@ -156,6 +156,11 @@ public:
     //       might not hold when property access behaves differently.
     bool may_interfere_with_indexed_property_access() const { return m_may_interfere_with_indexed_property_access; }
 
+    // NOTE: Any subclass of Object that overrides [[GetPrototypeOf]], [[GetOwnProperty]] or [[HasProperty]] in a way
+    //       that affects properties other than indexed properties must set this, to opt out of caches that assume
+    //       these lookups are fully determined by the shapes of the object and its prototype chain.
+    bool has_exotic_named_property_lookup() const { return m_has_exotic_named_property_lookup; }
+
     ThrowCompletionOr<bool> ordinary_set_with_own_descriptor(PropertyKey const&, Value, Value, Optional<PropertyDescriptor>, CacheablePropertyMetadata* = nullptr, PropertyLookupPhase = PropertyLookupPhase::OwnProperty);
 
     // 10.4.7 Immutable Prototype Exotic Objects, https://tc39.es/ecma262/#sec-immutable-prototype-exotic-objects
@@ -212,6 +217,7 @@ public:
     virtual bool is_ecmascript_function_object() const { return false; }
     virtual bool is_array_iterator() const { return false; }
     virtual bool is_raw_json_object() const { return false; }
+    virtual bool is_plain_object() const { return false; }
 
     virtual BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const&) { return nullptr; }
 
@@ -228,8 +234,8 @@ public:
 
     virtual void visit_edges(Cell::Visitor&) override;
 
-    Value get_direct(size_t index) const { return m_storage[index]; }
-    void put_direct(size_t index, Value value) { m_storage[index] = value; }
+    Value get_direct(size_t index) const { return storage_slot(index); }
+    void put_direct(size_t index, Value value) { storage_slot(index) = value; }
 
     IndexedProperties const& indexed_properties() const { return m_indexed_properties; }
     IndexedProperties& indexed_properties() { return m_indexed_properties; }
@@ -246,6 +252,7 @@ public:
     void set_prototype(Object*);
 
     [[nodiscard]] bool has_magical_length_property() const { return m_has_magical_length_property; }
+    [[nodiscard]] bool has_intrinsic_accessors() const { return m_has_intrinsic_accessors; }
 
     [[nodiscard]] bool is_typed_array() const { return m_is_typed_array; }
     void set_is_typed_array() { m_is_typed_array = true; }
@@ -263,6 +270,11 @@ protected:
     Object(ConstructWithPrototypeTag, Object& prototype, MayInterfereWithIndexedPropertyAccess = MayInterfereWithIndexedPropertyAccess::No);
     explicit Object(Shape&, MayInterfereWithIndexedPropertyAccess = MayInterfereWithIndexedPropertyAccess::No);
 
+    // For objects that keep the values of their first few named properties inside themselves. The inline storage is
+    // only remembered here, as it belongs to the subclass and hasn't been constructed yet.
+    Object(Shape&, Span<Value> inline_storage);
+    Object(ConstructWithPrototypeTag, Object& prototype, Span<Value> inline_storage);
+
     void unsafe_set_shape(Shape&);
 
     // [[Extensible]]
@@ -275,17 +287,33 @@ protected:
 
     bool m_is_typed_array { false };
 
+    bool m_has_exotic_named_property_lookup { false };
+
 private:
     void set_shape(Shape& shape) { m_shape = &shape; }
 
     Object* prototype() { return shape().prototype(); }
 
+    Value& storage_slot(size_t offset) { return offset < m_inline_storage_capacity ? m_inline_storage[offset] : m_storage[offset - m_inline_storage_capacity]; }
+    Value const& storage_slot(size_t offset) const { return offset < m_inline_storage_capacity ? m_inline_storage[offset] : m_storage[offset - m_inline_storage_capacity]; }
+
+    void resize_storage(size_t property_count);
+    void append_to_storage(size_t offset, Value);
+    void remove_from_storage(size_t offset);
+
     bool m_may_interfere_with_indexed_property_access { false };
 
     // True if this object has lazily allocated intrinsic properties.
     bool m_has_intrinsic_accessors { false };
 
+    // The number of named property values that are kept in m_inline_storage rather than m_storage.
+    u8 m_inline_storage_capacity { 0 };
+
     GC::Ptr<Shape> m_shape;
+
+    // The values of the first named properties of plain objects, which are kept inside the object itself (see
+    // PlainObject in Object.cpp). The values of all other named properties are kept in m_storage.
+    Value* m_inline_storage { nullptr };
     Vector<Value> m_storage;
     IndexedProperties m_indexed_properties;
     OwnPtr<Vector<PrivateElement>> m_private_elements; // [[PrivateElements]]
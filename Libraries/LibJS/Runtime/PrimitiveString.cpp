@@ -24,6 +24,38 @@ namespace JS {
 GC_DEFINE_ALLOCATOR(PrimitiveString);
 GC_DEFINE_ALLOCATOR(RopeString);
 
+// Appends a piece of UTF-8 that follows `previous` in the builder, combining a surrogate at the end of the previous
+// piece with one at the start of this one into a single code point.
+static void append_utf8_joining_surrogates(StringBuilder& builder, StringView previous, StringView current)
+{
+    // Surrogates encoded as UTF-8 are 3 bytes.
+    if (previous.length() < 3 || current.length() < 3) {
+        builder.append(current);
+        return;
+    }
+
+    // Might the previous string end with a UTF-8 encoded surrogate, and the current string begin with one?
+    if ((static_cast<u8>(previous[previous.length() - 3]) & 0xf0) != 0xe0 || (static_cast<u8>(current[0]) & 0xf0) != 0xe0) {
+        builder.append(current);
+        return;
+    }
+
+    auto high_surrogate = *Utf8View(previous.substring_view(previous.length() - 3)).begin();
+    auto low_surrogate = *Utf8View(current).begin();
+
+    if (!AK::UnicodeUtils::is_utf16_high_surrogate(high_surrogate) || !AK::UnicodeUtils::is_utf16_low_surrogate(low_surrogate)) {
+        builder.append(current);
+        return;
+    }
+
+    // Remove 3 bytes from the builder and replace them with the UTF-8 encoded code point.
+    builder.trim(3);
+    builder.append_code_point(AK::UnicodeUtils::decode_utf16_surrogate_pair(high_surrogate, low_surrogate));
+
+    // Append the remaining part of the current string.
+    builder.append(current.substring_view(3));
+}
+
 GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, Utf16String string)
 {
     if (string.is_empty())
@@ -97,6 +129,20 @@ GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, PrimitiveString& lhs, P
     if (rhs_empty)
         return lhs;
 
+    // OPTIMIZATION: Short concatenations of flat UTF-8 strings are done right away. A rope node would take about as much
+    //               memory as the result, and every one of them makes flattening the rope they end up in slower.
+    static constexpr size_t max_length_for_eager_concatenation = 32;
+    if (!lhs.m_is_rope && !rhs.m_is_rope && lhs.has_utf8_string() && rhs.has_utf8_string()) {
+        auto lhs_string = lhs.m_utf8_string->bytes_as_string_view();
+        auto rhs_string = rhs.m_utf8_string->bytes_as_string_view();
+        if (lhs_string.length() + rhs_string.length() <= max_length_for_eager_concatenation) {
+            StringBuilder builder(lhs_string.length() + rhs_string.length());
+            builder.append(lhs_string);
+            append_utf8_joining_surrogates(builder, lhs_string, rhs_string);
+            return create(vm, builder.to_string_without_validation());
+        }
+    }
+
     return vm.heap().allocate<RopeString>(lhs, rhs);
 }
 
@@ -217,11 +263,14 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
 
 void RopeString::resolve(EncodingPreference preference) const
 {
-
     // This vector will hold all the pieces of the rope that need to be assembled
     // into the resolved string.
     Vector<PrimitiveString const*> pieces;
-    size_t approximate_length = 0;
+
+    // Sizes of the result in both encodings, for the pieces where we know them without converting anything.
+    size_t utf8_length = 0;
+    size_t utf16_length = 0;
+    bool all_pieces_have_utf8 = true;
 
     // NOTE: We traverse the rope tree without using recursion, since we'd run out of
     //       stack space quickly when handling a long sequence of unresolved concatenations.
@@ -238,20 +287,28 @@ void RopeString::resolve(EncodingPreference preference) const
         }
 
         if (current->has_utf8_string())
-            approximate_length += current->utf8_string_view().length();
+            utf8_length += current->m_utf8_string->bytes_as_string_view().length();
+        else
+            all_pieces_have_utf8 = false;
+        if (current->has_utf16_string())
+            utf16_length += current->m_utf16_string->length_in_code_units();
+        else
+            utf16_length += current->m_utf8_string->bytes_as_string_view().length();
+
         pieces.append(current);
     }
 
-    if (preference == EncodingPreference::UTF16) {
-        // The caller wants a UTF-16 string, so we can simply concatenate all the pieces
-        // into a UTF-16 code unit buffer and create a Utf16String from it.
-        StringBuilder builder(StringBuilder::Mode::UTF16);
+    // We only build a UTF-8 string if every piece already has one. Otherwise we build a UTF-16 string, even if the
+    // caller prefers UTF-8: it can be converted once at the end, instead of converting (and keeping) every piece.
+    if (preference == EncodingPreference::UTF16 || !all_pieces_have_utf8) {
+        // NOTE: UTF-8 pieces never take more code units than they have bytes, so this is enough for the whole string.
+        StringBuilder builder(StringBuilder::Mode::UTF16, utf16_length);
 
         for (auto const* current : pieces) {
-            if (current->has_utf8_string())
-                builder.append(current->utf8_string_view());
+            if (current->has_utf16_string())
+                builder.append(*current->m_utf16_string);
             else
-                builder.append(current->utf16_string_view());
+                builder.append(current->m_utf8_string->bytes_as_string_view());
         }
 
         m_utf16_string = builder.to_utf16_string();
@@ -261,65 +318,14 @@ void RopeString::resolve(EncodingPreference preference) const
         return;
     }
 
-    // Now that we have all the pieces, we can concatenate them using a StringBuilder.
-    StringBuilder builder(approximate_length);
+    StringBuilder builder(utf8_length);
 
     // We keep track of the previous piece in order to handle surrogate pairs spread across two pieces.
-    PrimitiveString const* previous = nullptr;
+    StringView previous;
     for (auto const* current : pieces) {
-        if (!previous) {
-            // This is the very first piece, just append it and continue.
-            builder.append(current->utf8_string());
-            previous = current;
-            continue;
-        }
-
-        // Get the UTF-8 representations for both strings.
-        auto current_string_as_utf8 = current->utf8_string_view();
-        auto previous_string_as_utf8 = previous->utf8_string_view();
-
-        // NOTE: Now we need to look at the end of the previous string and the start
-        //       of the current string, to see if they should be combined into a surrogate.
-
-        // Surrogates encoded as UTF-8 are 3 bytes.
-        if ((previous_string_as_utf8.length() < 3) || (current_string_as_utf8.length() < 3)) {
-            builder.append(current_string_as_utf8);
-            previous = current;
-            continue;
-        }
-
-        // Might the previous string end with a UTF-8 encoded surrogate?
-        if ((static_cast<u8>(previous_string_as_utf8[previous_string_as_utf8.length() - 3]) & 0xf0) != 0xe0) {
-            // If not, just append the current string and continue.
-            builder.append(current_string_as_utf8);
-            previous = current;
-            continue;
-        }
-
-        // Might the current string begin with a UTF-8 encoded surrogate?
-        if ((static_cast<u8>(current_string_as_utf8[0]) & 0xf0) != 0xe0) {
-            // If not, just append the current string and continue.
-            builder.append(current_string_as_utf8);
-            previous = current;
-            continue;
-        }
-
-        auto high_surrogate = *Utf8View(previous_string_as_utf8.substring_view(previous_string_as_utf8.length() - 3)).begin();
-        auto low_surrogate = *Utf8View(current_string_as_utf8).begin();
-
-        if (!AK::UnicodeUtils::is_utf16_high_surrogate(high_surrogate) || !AK::UnicodeUtils::is_utf16_low_surrogate(low_surrogate)) {
-            builder.append(current_string_as_utf8);
-            previous = current;
-            continue;
-        }
-
-        // Remove 3 bytes from the builder and replace them with the UTF-8 encoded code point.
-        builder.trim(3);
-        builder.append_code_point(AK::UnicodeUtils::decode_utf16_surrogate_pair(high_surrogate, low_surrogate));
-
-        // Append the remaining part of the current string.
-        builder.append(current_string_as_utf8.substring_view(3));
-        previous = current;
+        auto current_string_as_utf8 = current->m_utf8_string->bytes_as_string_view();
+        append_utf8_joining_surrogates(builder, previous, current_string_as_utf8);
+        previous = current_string_as_utf8;
     }
 
     // NOTE: We've already produced valid UTF-8 above, so there's no need for additional validation.
@@ -46,6 +46,8 @@ ProxyObject::ProxyObject(Object& target, Object& handler, Object& prototype)
     , m_target(target)
     , m_handler(handler)
 {
+    m_has_exotic_named_property_lookup = true;
+
     if (target.is_array_exotic_object()) {
         auto& array = static_cast<Array&>(target);
         array.set_is_proxy_target(true);
@@ -290,6 +290,7 @@ void Shape::add_property_without_transition(PropertyKey const& property_key, Pro
         VERIFY(m_property_count < NumericLimits<u32>::max());
         ++m_property_count;
     }
+    invalidate_prototype_if_needed_for_change_without_transition();
 }
 
 void Shape::set_property_attributes_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
@@ -300,6 +301,7 @@ void Shape::set_property_attributes_without_transition(PropertyKey const& proper
     VERIFY(it != m_property_table->end());
     it->value.attributes = attributes;
     m_property_table->set(property_key, it->value);
+    invalidate_prototype_if_needed_for_change_without_transition();
 }
 
 void Shape::remove_property_without_transition(PropertyKey const& property_key, u32 offset)
@@ -313,6 +315,7 @@ void Shape::remove_property_without_transition(PropertyKey const& property_key,
         if (it.value.offset > offset)
             --it.value.offset;
     }
+    invalidate_prototype_if_needed_for_change_without_transition();
 }
 
 GC::Ref<Shape> Shape::clone_for_prototype()
@@ -356,6 +359,18 @@ void Shape::invalidate_prototype_if_needed_for_new_prototype(GC::Ref<Shape> new_
     invalidate_all_prototype_chains_leading_to_this();
 }
 
+void Shape::invalidate_prototype_if_needed_for_change_without_transition()
+{
+    // Dictionary shapes are changed in place, so prototype chains that go through them have to be invalidated as if
+    // they had transitioned to a new shape.
+    if (!m_is_prototype_shape)
+        return;
+    m_prototype_chain_validity->set_valid(false);
+    m_prototype_chain_validity = heap().allocate<PrototypeChainValidity>();
+
+    invalidate_all_prototype_chains_leading_to_this();
+}
+
 void Shape::invalidate_all_prototype_chains_leading_to_this()
 {
     HashTable<Shape*> shapes_to_invalidate;
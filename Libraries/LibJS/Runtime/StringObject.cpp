@@ -35,6 +35,8 @@ StringObject::StringObject(PrimitiveString& string, Object& prototype)
     : Object(ConstructWithPrototypeTag::Tag, prototype, MayInterfereWithIndexedPropertyAccess::Yes)
     , m_string(string)
 {
+    // NOTE: String keys that are numeric strings (but not array indices) may resolve to characters of the string.
+    m_has_exotic_named_property_lookup = true;
 }
 
 void StringObject::initialize(Realm& realm)
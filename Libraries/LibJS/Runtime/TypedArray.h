@@ -72,6 +72,9 @@ protected:
         , m_kind(kind)
     {
         set_is_typed_array();
+
+        // NOTE: Canonical numeric strings that aren't array indices, like "-0" or "1.5", are also handled specially.
+        m_has_exotic_named_property_lookup = true;
     }
 
     u32 m_element_size { 0 };
@@ -0,0 +1,70 @@
+describe("arrays that only hold numbers", () => {
+    test("searching for non-numbers", () => {
+        const array = [1, 2, 3];
+        expect(array.indexOf("1")).toBe(-1);
+        expect(array.lastIndexOf(undefined)).toBe(-1);
+        expect(array.includes(null)).toBeFalse();
+        expect(array.includes(2)).toBeTrue();
+        expect(array.indexOf(2.0)).toBe(1);
+        expect(array.lastIndexOf(3)).toBe(2);
+    });
+
+    test("int32 and double elements", () => {
+        const array = [1, 2, 3];
+        array.push(0.5);
+        array.push(NaN);
+        array.push(-0);
+        expect(array.indexOf(0.5)).toBe(3);
+        expect(array.indexOf(NaN)).toBe(-1);
+        expect(array.includes(NaN)).toBeTrue();
+        expect(array.indexOf(0)).toBe(5);
+        expect(array.includes(+0)).toBeTrue();
+    });
+
+    test("storing other values afterwards", () => {
+        const object = {};
+        const array = [1, 2, 3];
+        array[1] = object;
+        expect(array.indexOf(object)).toBe(1);
+        array.fill("x", 2);
+        expect(array).toEqual([1, object, "x"]);
+        expect(array.includes("x")).toBeTrue();
+    });
+
+    test("reusing an emptied array", () => {
+        const array = ["a", "b"];
+        array.length = 0;
+        array.push(1, 2);
+        expect(array.indexOf("a")).toBe(-1);
+        expect(array.indexOf(2)).toBe(1);
+    });
+
+    test("holes are looked up on the prototype chain", () => {
+        const array = [1, , 3];
+        Array.prototype[1] = 2;
+        try {
+            expect(array.indexOf(2)).toBe(1);
+            expect(array.map(x => x * 2)).toEqual([2, 4, 6]);
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+});
+
+test("default sort of int32 elements compares them as strings", () => {
+    expect([10, 9, -1, 100, -20, 0, 2147483647, -2147483648].sort()).toEqual([
+        -1, -20, -2147483648, 0, 10, 100, 2147483647, 9,
+    ]);
+});
+
+test("map callback that changes the array", () => {
+    const array = [1, 2, 3, 4];
+    const result = array.map((x, i) => {
+        if (i === 0) array.length = 2;
+        return x * 10;
+    });
+    expect(result).toHaveLength(4);
+    expect(result[0]).toBe(10);
+    expect(result[1]).toBe(20);
+    expect(2 in result).toBeFalse();
+});
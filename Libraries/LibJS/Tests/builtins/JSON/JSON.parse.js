@@ -74,3 +74,31 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("arrays of objects with the same and differing keys", () => {
+    const result = JSON.parse(
+        '[{"a":1,"b":{"c":2}},{"a":3,"b":{"c":4}},{"a":5},{"b":6,"a":7},{"a":8,"b":9,"d":10},{"a":11,"a":12},{"0":13,"a":14},{},{"a":15,"b":{"c":16,"e":17}}]'
+    );
+    expect(result).toEqual([
+        { a: 1, b: { c: 2 } },
+        { a: 3, b: { c: 4 } },
+        { a: 5 },
+        { b: 6, a: 7 },
+        { a: 8, b: 9, d: 10 },
+        { a: 12 },
+        { 0: 13, a: 14 },
+        {},
+        { a: 15, b: { c: 16, e: 17 } },
+    ]);
+    expect(Object.keys(result[3])).toEqual(["b", "a"]);
+    expect(Object.keys(result[4])).toEqual(["a", "b", "d"]);
+
+    result[0].a = 100;
+    expect(result[1].a).toBe(3);
+});
+
+test("strings with escapes", () => {
+    expect(JSON.parse('"abcdefghijklmnopqrstuvwxyz\\n\\"\\\\\\u0041"')).toBe('abcdefghijklmnopqrstuvwxyz\n"\\A');
+    expect(JSON.parse('{"k\\u0065y":1}')).toEqual({ key: 1 });
+    expect(() => JSON.parse('"abcdefghijklmnopqrstuvwxyz\tabc"')).toThrow(SyntaxError);
+});
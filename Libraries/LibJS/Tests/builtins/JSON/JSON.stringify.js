@@ -71,6 +71,85 @@ describe("correct behavior", () => {
         expect(JSON.stringify("\ud83d\ud83d\ude04\ud83d\ude04\ude04")).toBe('"\\ud83d😄😄\\ude04"');
         expect(JSON.stringify("\ude04\ud83d\ude04\ud83d\ude04\ud83d")).toBe('"\\ude04😄😄\\ud83d"');
     });
+    test("getters and objects changed during serialization", () => {
+        let o = {
+            a: 1,
+            get b() {
+                return 2;
+            },
+            c: {
+                toJSON() {
+                    delete o.d;
+                    o.e = 5;
+                    return 3;
+                },
+            },
+            d: 4,
+        };
+        expect(JSON.stringify(o)).toBe('{"a":1,"b":2,"c":3}');
+
+        let array = [1, , 3];
+        Object.defineProperty(array, 1, { get: () => 2, enumerable: true });
+        expect(JSON.stringify(array)).toBe("[1,2,3]");
+    });
+
+    test("dictionary-mode objects changed during serialization", () => {
+        // Enough properties to put the object's shape into dictionary mode.
+        let o = {};
+        for (let i = 0; i < 100; ++i) o[`p${i}`] = i;
+        o.p1 = {
+            toJSON() {
+                delete o.p50;
+                delete o.p2;
+                o.added = "nope";
+                return "x";
+            },
+        };
+
+        let expected = [];
+        for (let i = 0; i < 100; ++i) {
+            if (i === 2 || i === 50) continue;
+            expected.push(i === 1 ? '"p1":"x"' : `"p${i}":${i}`);
+        }
+        expect(JSON.stringify(o)).toBe(`{${expected.join(",")}}`);
+    });
+
+    test("plain objects read through their shape", () => {
+        // More properties than are stored inline in the object, so values come from both kinds of storage.
+        let o = { a: 1, b: "two", c: null, d: [4], e: { f: 5 }, g: undefined, h: () => {}, [Symbol("i")]: 9 };
+        Object.defineProperty(o, "hidden", { value: 10, enumerable: false });
+        expect(JSON.stringify(o)).toBe('{"a":1,"b":"two","c":null,"d":[4],"e":{"f":5}}');
+
+        let n = new Object();
+        n.x = 1;
+        n.y = 2;
+        expect(JSON.stringify(n)).toBe('{"x":1,"y":2}');
+
+        let bare = Object.create(null);
+        bare.z = 3;
+        expect(JSON.stringify(bare)).toBe('{"z":3}');
+
+        // A toJSON that replaces a later value without changing the object's shape.
+        let changed = {
+            a: {
+                toJSON() {
+                    changed.b = "new";
+                    return 1;
+                },
+            },
+            b: "old",
+            c: 3,
+            d: 4,
+            e: 5,
+        };
+        expect(JSON.stringify(changed)).toBe('{"a":1,"b":"new","c":3,"d":4,"e":5}');
+    });
+
+    test("nested indentation", () => {
+        expect(JSON.stringify({ a: [1, {}], b: { c: undefined }, d: [] }, null, 2)).toBe(
+            '{\n  "a": [\n    1,\n    {}\n  ],\n  "b": {},\n  "d": []\n}'
+        );
+    });
 });
 
 describe("errors", () => {
@@ -83,3 +83,34 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
     });
 });
+
+describe("many deletions", () => {
+    test("iterators keep their position when deleted entries are cleaned up", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+
+        const iterator = map.keys();
+        for (let i = 0; i < 50; ++i) expect(iterator.next()).toBeIteratorResultWithValue(i);
+
+        for (let i = 0; i < 100; i += 2) expect(map.delete(i)).toBeTrue();
+        for (let i = 1; i < 40; i += 2) expect(map.delete(i)).toBeTrue();
+        expect(map).toHaveSize(30);
+
+        for (let i = 51; i < 100; i += 2) expect(iterator.next()).toBeIteratorResultWithValue(i);
+        map.set(100, 100);
+        expect(iterator.next()).toBeIteratorResultWithValue(100);
+        expect(iterator.next()).toBeIteratorResultDone();
+
+        expect(Array.from(map.keys())).toEqual(Array.from({ length: 30 }, (_, i) => 41 + i * 2).concat([100]));
+    });
+
+    test("re-adding a deleted key moves it to the end", () => {
+        const map = new Map();
+        for (let i = 0; i < 40; ++i) map.set(i, i);
+        for (let i = 0; i < 30; ++i) map.delete(i);
+        map.set(5, "five");
+        expect(Array.from(map.keys())).toEqual([30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 5]);
+        expect(map.get(5)).toBe("five");
+        expect(map.get(35)).toBe(35);
+    });
+});
@@ -16,3 +16,112 @@ test("Inline cache invalidated by deleting property from unique shape", () => {
     expect(first).toBe(2);
     expect(second).toBeUndefined();
 });
+
+test("in operator cache invalidated by changes to the prototype chain", () => {
+    function has(o) {
+        return "foo" in o;
+    }
+
+    const grandparent = {};
+    const parent = Object.create(grandparent);
+    const o = Object.create(parent);
+
+    expect(has(o)).toBeFalse();
+    grandparent.foo = 1;
+    expect(has(o)).toBeTrue();
+    delete grandparent.foo;
+    expect(has(o)).toBeFalse();
+    Object.setPrototypeOf(parent, { foo: 1 });
+    expect(has(o)).toBeTrue();
+});
+
+test("in operator cache invalidated by changes to a dictionary prototype", () => {
+    function has(o) {
+        return "foo" in o;
+    }
+
+    const prototype = {};
+    for (let x = 0; x < 1000; ++x) {
+        prototype["prop" + x] = x;
+    }
+    const o = Object.create(prototype);
+
+    expect(has(o)).toBeFalse();
+    prototype.foo = 1;
+    expect(has(o)).toBeTrue();
+    delete prototype.foo;
+    expect(has(o)).toBeFalse();
+});
+
+test("in operator cache is not used for exotic objects", () => {
+    function has(o) {
+        return "1.5" in o;
+    }
+
+    const plain = {};
+    const typedArray = new Uint8Array(4);
+    const proxy = new Proxy({}, { has: () => true });
+
+    expect(has(plain)).toBeFalse();
+    expect(has(typedArray)).toBeFalse();
+    expect(has(proxy)).toBeTrue();
+    expect(has(plain)).toBeFalse();
+
+    function hasLength(o) {
+        return "length" in o;
+    }
+    expect(hasLength([])).toBeTrue();
+    expect(hasLength(Object.create(Array.prototype))).toBeTrue();
+    expect(hasLength({})).toBeFalse();
+});
+
+test("instanceof cache invalidated by changes to the constructor", () => {
+    function isInstance(o, C) {
+        return o instanceof C;
+    }
+
+    function C() {}
+    const o = new C();
+
+    expect(isInstance(o, C)).toBeTrue();
+    expect(isInstance({}, C)).toBeFalse();
+
+    const oldPrototype = C.prototype;
+    C.prototype = {};
+    expect(isInstance(o, C)).toBeFalse();
+    C.prototype = oldPrototype;
+    expect(isInstance(o, C)).toBeTrue();
+
+    Object.defineProperty(C, Symbol.hasInstance, { value: () => false, configurable: true });
+    expect(isInstance(o, C)).toBeFalse();
+    delete C[Symbol.hasInstance];
+    expect(isInstance(o, C)).toBeTrue();
+
+    const intermediate = Object.create(Function.prototype);
+    Object.setPrototypeOf(C, intermediate);
+    expect(isInstance(o, C)).toBeTrue();
+    Object.defineProperty(intermediate, Symbol.hasInstance, { value: () => false, configurable: true });
+    expect(isInstance(o, C)).toBeFalse();
+    delete intermediate[Symbol.hasInstance];
+    expect(isInstance(o, C)).toBeTrue();
+});
+
+test("instanceof cache invalidated by changes to the prototype chain of the value", () => {
+    function isInstance(o, C) {
+        return o instanceof C;
+    }
+
+    function C() {}
+    const parent = {};
+    const o = Object.create(parent);
+
+    expect(isInstance(o, C)).toBeFalse();
+    Object.setPrototypeOf(parent, C.prototype);
+    expect(isInstance(o, C)).toBeTrue();
+    Object.setPrototypeOf(parent, null);
+    expect(isInstance(o, C)).toBeFalse();
+
+    const proxy = new Proxy({}, { getPrototypeOf: () => C.prototype });
+    expect(isInstance(proxy, C)).toBeTrue();
+    expect(isInstance(1, C)).toBeFalse();
+});
@@ -0,0 +1,104 @@
+function* numbers(count) {
+    for (let i = 0; i < count; ++i) yield i;
+    return "done";
+}
+
+test("for..of over a generator", () => {
+    const values = [];
+    for (const value of numbers(4)) values.push(value);
+    expect(values).toEqual([0, 1, 2, 3]);
+});
+
+test("spread and destructuring of a generator", () => {
+    expect([...numbers(3)]).toEqual([0, 1, 2]);
+
+    const [a, b, ...rest] = numbers(5);
+    expect(a).toBe(0);
+    expect(b).toBe(1);
+    expect(rest).toEqual([2, 3, 4]);
+});
+
+test("breaking out of for..of calls return()", () => {
+    let finallyRan = false;
+    function* withFinally() {
+        try {
+            yield 1;
+            yield 2;
+        } finally {
+            finallyRan = true;
+        }
+    }
+
+    for (const value of withFinally()) {
+        expect(value).toBe(1);
+        break;
+    }
+    expect(finallyRan).toBeTrue();
+
+    finallyRan = false;
+    const [first] = withFinally();
+    expect(first).toBe(1);
+    expect(finallyRan).toBeTrue();
+});
+
+test("redefined next() is called", () => {
+    const generator = numbers(3);
+    let calls = 0;
+    const originalNext = generator.next;
+    generator.next = function () {
+        ++calls;
+        return originalNext.call(this);
+    };
+    expect([...generator]).toEqual([0, 1, 2]);
+    expect(calls).toBe(4);
+});
+
+test("redefined return() is called", () => {
+    const generator = numbers(3);
+    let returnCalled = false;
+    generator.return = function () {
+        returnCalled = true;
+        return { done: true };
+    };
+    for (const value of generator) break;
+    expect(returnCalled).toBeTrue();
+});
+
+test("exceptions thrown by the generator propagate", () => {
+    function* throwing() {
+        yield 1;
+        throw new Error("oops");
+    }
+    expect(() => {
+        for (const value of throwing());
+    }).toThrowWithMessage(Error, "oops");
+});
+
+test("running generator cannot be resumed from for..of", () => {
+    let generator;
+    function* reentrant() {
+        for (const value of generator);
+        yield 1;
+    }
+    generator = reentrant();
+    expect(() => {
+        generator.next();
+    }).toThrowWithMessage(TypeError, "Generator is already executing");
+});
+
+test("calling iterator next() builtins through a binding named after their prototype", () => {
+    const GeneratorPrototype = Object.getPrototypeOf(function* () {}).prototype;
+    const ArrayIteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+
+    function* generator() {
+        const received = yield 1;
+        yield received;
+    }
+
+    const iterator = generator();
+    const result = GeneratorPrototype.next.call(iterator);
+    expect(result.value).toBe(1);
+    expect(result.done).toBeFalse();
+    expect(() => GeneratorPrototype.next(2)).toThrow(TypeError);
+    expect(() => ArrayIteratorPrototype.next()).toThrow(TypeError);
+});
@@ -261,3 +261,18 @@ test("delete always evaluates the lhs", () => {
         delete new d();
     }).toThrowWithMessage(Error, "called");
 });
+
+test("deleting properties of objects with many properties keeps the other values", () => {
+    const o = {};
+    for (let i = 0; i < 8; ++i) o[`p${i}`] = i;
+
+    expect(delete o.p1).toBeTrue();
+    expect(delete o.p6).toBeTrue();
+    expect(Object.keys(o)).toEqual(["p0", "p2", "p3", "p4", "p5", "p7"]);
+    expect(Object.values(o)).toEqual([0, 2, 3, 4, 5, 7]);
+
+    o.p8 = 8;
+    expect(o.p4).toBe(4);
+    expect(o.p8).toBe(8);
+    expect(Object.values(o)).toEqual([0, 2, 3, 4, 5, 7, 8]);
+});
@@ -28,3 +28,22 @@ test("adding strings with dangling surrogates", () => {
     expect("\ud834a" + "\udf06").toBe("\ud834a\udf06");
     expect("\ud834" + "a\udf06").toBe("\ud834a\udf06");
 });
+
+test("long chains of concatenations", () => {
+    let string = "";
+    for (let i = 0; i < 1000; ++i) string += i % 10;
+    expect(string).toHaveLength(1000);
+    expect(string.substring(0, 12)).toBe("012345678901");
+
+    let mixed = "";
+    for (let i = 0; i < 100; ++i) mixed += i % 2 === 0 ? "a" : "é\ud834";
+    mixed += "\udf06";
+    expect(mixed).toHaveLength(151);
+    expect(mixed.endsWith("é𝌆")).toBeTrue();
+
+    let longPieces = "";
+    for (let i = 0; i < 10; ++i) longPieces += "x".repeat(40) + "\ud834";
+    longPieces += "\udf06";
+    expect(longPieces).toHaveLength(411);
+    expect(longPieces.codePointAt(409)).toBe(0x1d306);
+});
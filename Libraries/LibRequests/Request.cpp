@@ -110,6 +110,15 @@ void Request::did_request_certificates(Badge<RequestClient>)
     }
 }
 
+void Request::did_receive_body_data(Badge<RequestClient>, ReadonlyBytes data)
+{
+    // If the request was stopped while this IPC was in-flight, just bail.
+    if (!m_internal_stream_data)
+        return;
+
+    m_internal_stream_data->on_data_available(data);
+}
+
 void Request::set_up_internal_stream_data(DataReceived on_data_available)
 {
     VERIFY(!m_internal_stream_data);
@@ -143,7 +152,9 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
         }
     };
 
-    m_internal_stream_data->read_notifier->on_activation = [this, on_data_available = move(on_data_available)]() {
+    m_internal_stream_data->on_data_available = move(on_data_available);
+
+    m_internal_stream_data->read_notifier->on_activation = [this]() {
         static constexpr size_t buffer_size = 256 * KiB;
         static char buffer[buffer_size];
 
@@ -162,7 +173,7 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
             if (read_bytes.is_empty())
                 break;
 
-            on_data_available(read_bytes);
+            m_internal_stream_data->on_data_available(read_bytes);
         } while (true);
 
         if (m_internal_stream_data->read_stream->is_eof())
@@ -56,6 +56,7 @@ public:
     void did_finish(Badge<RequestClient>, u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error);
     void did_receive_headers(Badge<RequestClient>, HTTP::HeaderMap const& response_headers, Optional<u32> response_code, Optional<String> const& reason_phrase);
     void did_request_certificates(Badge<RequestClient>);
+    void did_receive_body_data(Badge<RequestClient>, ReadonlyBytes data);
 
     RefPtr<Core::Notifier>& write_notifier(Badge<RequestClient>) { return m_write_notifier; }
     void set_request_fd(Badge<RequestClient>, int fd);
@@ -97,6 +98,7 @@ private:
         bool request_done { false };
         RequestTimingInfo timing_info;
         Function<void()> on_finish {};
+        DataReceived on_data_available {};
         bool user_finish_called { false };
     };
 
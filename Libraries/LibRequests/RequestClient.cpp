@@ -32,7 +32,12 @@ void RequestClient::ensure_connection(URL::URL const& url, ::RequestServer::Cach
     async_ensure_connection(url, cache_level);
 }
 
-RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data)
+void RequestClient::will_navigate(URL::URL const& url)
+{
+    async_will_navigate(url);
+}
+
+RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data, ::RequestServer::RequestPriority priority)
 {
     auto body_result = ByteBuffer::copy(request_body);
     if (body_result.is_error())
@@ -41,7 +46,7 @@ RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL
     static i32 s_next_request_id = 0;
     auto request_id = s_next_request_id++;
 
-    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data);
+    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data, priority);
     auto request = Request::create_from_id({}, *this, request_id);
     m_requests.set(request_id, request);
     return request;
@@ -92,6 +97,28 @@ void RequestClient::headers_became_available(i32 request_id, HTTP::HeaderMap res
     request->did_receive_headers({}, response_headers, status_code, reason_phrase);
 }
 
+void RequestClient::body_chunk_created(u32 chunk_id, Core::AnonymousBuffer chunk)
+{
+    m_body_chunks.set(chunk_id, move(chunk));
+}
+
+void RequestClient::request_body_received(i32 request_id, u32 chunk_id, u32 size)
+{
+    auto chunk = m_body_chunks.get(chunk_id);
+    if (!chunk.has_value()) {
+        warnln("Received body data in non-existent chunk {}", chunk_id);
+        return;
+    }
+
+    if (auto request = m_requests.get(request_id).value_or(nullptr)) {
+        VERIFY(size <= chunk->size());
+        request->did_receive_body_data({}, { chunk->data<u8>(), size });
+    }
+
+    // NOTE: The chunk must be released even if the request is gone, otherwise RequestServer will never reuse it.
+    async_release_body_chunk(chunk_id);
+}
+
 void RequestClient::certificate_requested(i32 request_id)
 {
     if (auto request = const_cast<Request*>(m_requests.get(request_id).value_or(nullptr))) {
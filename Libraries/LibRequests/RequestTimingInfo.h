@@ -24,6 +24,13 @@ struct RequestTimingInfo {
     long response_end_microseconds { 0 };
     long encoded_body_size { 0 };
     ALPNHttpVersion http_version_alpn_identifier { ALPNHttpVersion::None };
+
+    // The time the request waited for RequestServer to start it, because requests of a higher priority came first. This
+    // is included in all of the times above.
+    long queueing_delay_microseconds { 0 };
+
+    // Whether the request was sent over a connection that was already open, rather than opening a new one.
+    bool connection_was_reused { false };
 };
 
 }
@@ -43,6 +50,8 @@ inline ErrorOr<void> encode(Encoder& encoder, Requests::RequestTimingInfo const&
     TRY(encoder.encode(timing_info.response_end_microseconds));
     TRY(encoder.encode(timing_info.encoded_body_size));
     TRY(encoder.encode(timing_info.http_version_alpn_identifier));
+    TRY(encoder.encode(timing_info.queueing_delay_microseconds));
+    TRY(encoder.encode(timing_info.connection_was_reused));
     return {};
 }
 
@@ -59,6 +68,8 @@ inline ErrorOr<Requests::RequestTimingInfo> decode(Decoder& decoder)
     auto response_end_microseconds = TRY(decoder.decode<long>());
     auto encoded_body_size = TRY(decoder.decode<long>());
     auto http_version_alpn_identifier = TRY(decoder.decode<Requests::ALPNHttpVersion>());
+    auto queueing_delay_microseconds = TRY(decoder.decode<long>());
+    auto connection_was_reused = TRY(decoder.decode<bool>());
 
     return Requests::RequestTimingInfo {
         .domain_lookup_start_microseconds = domain_lookup_start_microseconds,
@@ -71,6 +82,8 @@ inline ErrorOr<Requests::RequestTimingInfo> decode(Decoder& decoder)
         .response_end_microseconds = response_end_microseconds,
         .encoded_body_size = encoded_body_size,
         .http_version_alpn_identifier = http_version_alpn_identifier,
+        .queueing_delay_microseconds = queueing_delay_microseconds,
+        .connection_was_reused = connection_was_reused,
     };
 }
 
@@ -25,6 +25,15 @@ PlatformObject::PlatformObject(JS::Object& prototype, MayInterfereWithIndexedPro
 
 PlatformObject::~PlatformObject() = default;
 
+void PlatformObject::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+
+    // NOTE: Named properties are looked up outside the shape of the object, see internal_get_own_property().
+    if (m_legacy_platform_object_flags.has_value() && m_legacy_platform_object_flags->supports_named_properties && !m_legacy_platform_object_flags->has_global_interface_extended_attribute)
+        m_has_exotic_named_property_lookup = true;
+}
+
 JS::Realm& PlatformObject::realm() const
 {
     return shape().realm();
@@ -133,6 +133,60 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     collect_ancestor_hashes();
 
     m_can_use_fast_matches = can_selector_use_fast_matches(*this);
+    if (m_can_use_fast_matches)
+        compile_fast_match_program();
+}
+
+void Selector::compile_fast_match_program()
+{
+    m_fast_match_compounds.ensure_capacity(m_compound_selectors.size());
+
+    for (ssize_t compound_selector_index = static_cast<ssize_t>(m_compound_selectors.size()) - 1; compound_selector_index >= 0; --compound_selector_index) {
+        auto const& compound_selector = m_compound_selectors[compound_selector_index];
+        FastMatchCompound compound {
+            .first_instruction = static_cast<u32>(m_fast_match_instructions.size()),
+            .instruction_count = 0,
+            .combinator = compound_selector.combinator,
+        };
+
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            FastMatchInstruction instruction { .simple_selector = &simple_selector };
+            switch (simple_selector.type) {
+            case SimpleSelector::Type::TagName: {
+                auto const& qualified_name = simple_selector.qualified_name();
+                instruction.type = FastMatchInstruction::Type::TagName;
+                instruction.name = qualified_name.name.name;
+                instruction.lowercase_name = qualified_name.name.lowercase_name;
+                instruction.needs_namespace_check = qualified_name.namespace_type != SimpleSelector::QualifiedName::NamespaceType::Any;
+                break;
+            }
+            case SimpleSelector::Type::Class:
+                instruction.type = FastMatchInstruction::Type::Class;
+                instruction.name = simple_selector.name();
+                break;
+            case SimpleSelector::Type::Id:
+                instruction.type = FastMatchInstruction::Type::Id;
+                instruction.name = simple_selector.name();
+                break;
+            case SimpleSelector::Type::Attribute: {
+                auto const& attribute = simple_selector.attribute();
+                auto namespace_type = attribute.qualified_name.namespace_type;
+                if (attribute.match_type == SimpleSelector::Attribute::MatchType::HasAttribute
+                    && (namespace_type == SimpleSelector::QualifiedName::NamespaceType::Default || namespace_type == SimpleSelector::QualifiedName::NamespaceType::None)) {
+                    instruction.type = FastMatchInstruction::Type::AttributeExists;
+                    instruction.name = attribute.qualified_name.name.name;
+                }
+                break;
+            }
+            default:
+                break;
+            }
+            m_fast_match_instructions.append(move(instruction));
+            ++compound.instruction_count;
+        }
+
+        m_fast_match_compounds.append(compound);
+    }
 }
 
 void Selector::collect_ancestor_hashes()
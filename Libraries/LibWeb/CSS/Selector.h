@@ -201,6 +201,31 @@ public:
         Optional<CompoundSelector> absolutized(SimpleSelector const& selector_for_nesting) const;
     };
 
+    // Selectors that can use fast matching are also compiled into a flat list of instructions when they are created,
+    // so matching doesn't have to look into the variants of each SimpleSelector on every attempt.
+    struct FastMatchInstruction {
+        enum class Type : u8 {
+            TagName,
+            Class,
+            Id,
+            AttributeExists,
+            Generic,
+        };
+
+        Type type { Type::Generic };
+        bool needs_namespace_check { false };
+        FlyString name;
+        FlyString lowercase_name;
+        SimpleSelector const* simple_selector { nullptr };
+    };
+
+    // Compounds are stored from the subject to the leftmost compound.
+    struct FastMatchCompound {
+        u32 first_instruction { 0 };
+        u32 instruction_count { 0 };
+        Combinator combinator { Combinator::None };
+    };
+
     static NonnullRefPtr<Selector> create(Vector<CompoundSelector>&& compound_selectors)
     {
         return adopt_ref(*new Selector(move(compound_selectors)));
@@ -221,6 +246,8 @@ public:
     auto const& ancestor_hashes() const { return m_ancestor_hashes; }
 
     bool can_use_fast_matches() const { return m_can_use_fast_matches; }
+    Vector<FastMatchInstruction> const& fast_match_instructions() const { return m_fast_match_instructions; }
+    Vector<FastMatchCompound> const& fast_match_compounds() const { return m_fast_match_compounds; }
     bool can_use_ancestor_filter() const { return m_can_use_ancestor_filter; }
 
     size_t sibling_invalidation_distance() const;
@@ -239,8 +266,12 @@ private:
     PseudoClassBitmap m_contained_pseudo_classes;
 
     void collect_ancestor_hashes();
+    void compile_fast_match_program();
 
     Array<u32, 8> m_ancestor_hashes;
+
+    Vector<FastMatchInstruction> m_fast_match_instructions;
+    Vector<FastMatchCompound> m_fast_match_compounds;
 };
 
 String serialize_a_group_of_selectors(SelectorList const& selectors);
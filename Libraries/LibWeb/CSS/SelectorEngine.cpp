@@ -211,7 +211,34 @@ static inline bool matches_relative_selector(CSS::Selector const& selector, size
 // https://drafts.csswg.org/selectors-4/#relational
 static inline bool matches_has_pseudo_class(CSS::Selector const& selector, DOM::Element const& anchor, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    return matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+    if (!context.has_result_cache)
+        return matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+
+    // NOTE: A cached result has to leave the same metadata behind as matching would have, so we record which
+    //       pseudo-classes were attempted and whether the anchor was flagged while matching it the first time.
+    HasResultCache::Key key { &selector, &anchor, shadow_host.ptr() };
+    if (auto result = context.has_result_cache->get(key); result.has_value()) {
+        if (result->anchor_affected_by_sibling_combinator && context.collect_per_element_selector_involvement_metadata)
+            const_cast<DOM::Element&>(anchor).set_affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator(true);
+        context.attempted_pseudo_class_matches |= result->attempted_pseudo_class_matches;
+        return result->matches;
+    }
+
+    auto& mutable_anchor = const_cast<DOM::Element&>(anchor);
+    auto was_affected_by_sibling_combinator = anchor.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator();
+    mutable_anchor.set_affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator(false);
+    auto attempted_pseudo_class_matches = context.attempted_pseudo_class_matches;
+    context.attempted_pseudo_class_matches = {};
+
+    HasResultCache::Result result;
+    result.matches = matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+    result.anchor_affected_by_sibling_combinator = anchor.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator();
+    result.attempted_pseudo_class_matches = context.attempted_pseudo_class_matches;
+    context.has_result_cache->set(key, result);
+
+    mutable_anchor.set_affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator(was_affected_by_sibling_combinator || result.anchor_affected_by_sibling_combinator);
+    context.attempted_pseudo_class_matches |= attempted_pseudo_class_matches;
+    return result.matches;
 }
 
 static bool matches_hover_pseudo_class(DOM::Element const& element)
@@ -1272,10 +1299,45 @@ static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& si
     }
 }
 
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+static ALWAYS_INLINE bool fast_matches_instruction(CSS::Selector::FastMatchInstruction const& instruction, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, element, shadow_host, context))
+    using Type = CSS::Selector::FastMatchInstruction::Type;
+
+    if (instruction.type == Type::Generic)
+        return fast_matches_simple_selector(*instruction.simple_selector, element, shadow_host, context);
+
+    // NOTE: None of the specialized instructions are pseudo-classes, so they never match the shadow host from within its shadow tree.
+    if (shadow_host && &element == shadow_host.ptr())
+        return false;
+
+    switch (instruction.type) {
+    case Type::TagName:
+        if (element.namespace_uri() == Namespace::HTML && element.document().document_type() == DOM::Document::Type::HTML) {
+            if (instruction.lowercase_name != element.local_name())
+                return false;
+        } else if (instruction.name != element.local_name()) {
+            return false;
+        }
+        return !instruction.needs_namespace_check || matches_namespace(instruction.simple_selector->qualified_name(), element, context.style_sheet_for_rule);
+    case Type::Class: {
+        auto case_sensitivity = element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
+        return element.has_class(instruction.name, case_sensitivity);
+    }
+    case Type::Id:
+        return instruction.name == element.id();
+    case Type::AttributeExists:
+        return element.attributes()->get_attribute(instruction.name) != nullptr;
+    case Type::Generic:
+        break;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static bool fast_matches_compound_selector(CSS::Selector const& selector, CSS::Selector::FastMatchCompound const& compound, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+{
+    auto const* instruction = selector.fast_match_instructions().data() + compound.first_instruction;
+    for (u32 i = 0; i < compound.instruction_count; ++i) {
+        if (!fast_matches_instruction(instruction[i], element, shadow_host, context))
             return false;
     }
     return true;
@@ -1283,48 +1345,53 @@ static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const
 
 bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_match, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    DOM::Element const* current = &element_to_match;
-
-    ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
+    auto const& compounds = selector.fast_match_compounds();
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), *current, shadow_host, context))
+    if (!fast_matches_compound_selector(selector, compounds.first(), element_to_match, shadow_host, context))
         return false;
 
-    // NOTE: If we fail after following a child combinator, we may need to backtrack
-    //       to the last matched descendant. We store the state here.
+    // Selectors with a single compound (".foo", "div#bar", "[hidden]") are by far the most common, and are done here.
+    if (compounds.size() == 1)
+        return true;
+
+    DOM::Element const* current = &element_to_match;
+    size_t compound_index = 0;
+
+    // NOTE: If we fail after following a child combinator, we may need to backtrack to the last element that
+    //       matched through a descendant combinator, and continue searching from its parent. We store the state here.
     struct {
         GC::Ptr<DOM::Element const> element;
-        ssize_t compound_selector_index = 0;
+        size_t compound_index = 0;
     } backtrack_state;
 
     for (;;) {
         // NOTE: There should always be a leftmost compound selector without combinator that kicks us out of this loop.
-        VERIFY(compound_selector_index >= 0);
-
-        auto const* compound_selector = &selector.compound_selectors()[compound_selector_index];
+        VERIFY(compound_index < compounds.size());
 
-        switch (compound_selector->combinator) {
+        switch (compounds[compound_index].combinator) {
         case CSS::Selector::Combinator::None:
             return true;
-        case CSS::Selector::Combinator::Descendant:
-            backtrack_state = { current->parent_element(), compound_selector_index };
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+        case CSS::Selector::Combinator::Descendant: {
+            auto const& compound = compounds[compound_index + 1];
             for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, *current, shadow_host, context))
+                if (fast_matches_compound_selector(selector, compound, *current, shadow_host, context))
                     break;
             }
             if (!current)
                 return false;
+            backtrack_state = { current, compound_index };
+            ++compound_index;
             break;
+        }
         case CSS::Selector::Combinator::ImmediateChild:
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
             current = current->parent_element();
             if (!current)
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, *current, shadow_host, context)) {
+            ++compound_index;
+            if (!fast_matches_compound_selector(selector, compounds[compound_index], *current, shadow_host, context)) {
                 if (backtrack_state.element) {
                     current = backtrack_state.element;
-                    compound_selector_index = backtrack_state.compound_selector_index;
+                    compound_index = backtrack_state.compound_index;
                     continue;
                 }
                 return false;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/DOM/Element.h>
 
@@ -16,11 +17,46 @@ enum class SelectorKind {
     Relative,
 };
 
+// Results of matching :has() arguments against an anchor, kept for the duration of a single style update so that
+// the descendants and siblings of an anchor are walked once per argument selector instead of once per element
+// whose style depends on that anchor. Only valid while the DOM can't change.
+class HasResultCache {
+public:
+    struct Key {
+        CSS::Selector const* selector { nullptr };
+        DOM::Element const* anchor { nullptr };
+        DOM::Element const* shadow_host { nullptr };
+
+        bool operator==(Key const&) const = default;
+    };
+
+    struct Result {
+        bool matches { false };
+        bool anchor_affected_by_sibling_combinator { false };
+        CSS::PseudoClassBitmap attempted_pseudo_class_matches {};
+    };
+
+    Optional<Result const&> get(Key const& key) const { return m_results.get(key); }
+    void set(Key const& key, Result const& result) { m_results.set(key, result); }
+    void clear() { m_results.clear(); }
+
+private:
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key)
+        {
+            return pair_int_hash(pair_int_hash(ptr_hash(key.selector), ptr_hash(key.anchor)), ptr_hash(key.shadow_host));
+        }
+    };
+
+    HashMap<Key, Result, KeyTraits> m_results;
+};
+
 struct MatchContext {
     GC::Ptr<CSS::CSSStyleSheet const> style_sheet_for_rule {};
     GC::Ptr<DOM::Element const> subject {};
     bool collect_per_element_selector_involvement_metadata { false };
     CSS::PseudoClassBitmap attempted_pseudo_class_matches {};
+    HasResultCache* has_result_cache { nullptr };
 };
 
 bool matches(CSS::Selector const&, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, Optional<CSS::PseudoElement> = {}, GC::Ptr<DOM::ParentNode const> scope = {}, SelectorKind selector_kind = SelectorKind::Normal, GC::Ptr<DOM::Element const> anchor = nullptr);
@@ -598,6 +598,7 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element c
             .style_sheet_for_rule = *rule_to_run.sheet,
             .subject = element,
             .collect_per_element_selector_involvement_metadata = true,
+            .has_result_cache = m_has_result_cache.ptr(),
         };
         ScopeGuard guard = [&] {
             attempted_pseudo_class_matches |= context.attempted_pseudo_class_matches;
@@ -3306,6 +3307,17 @@ void StyleComputer::reset_ancestor_filter()
     m_ancestor_filter->clear();
 }
 
+void StyleComputer::enable_has_result_cache()
+{
+    if (!m_has_result_cache)
+        m_has_result_cache = make<SelectorEngine::HasResultCache>();
+}
+
+void StyleComputer::disable_has_result_cache()
+{
+    m_has_result_cache = nullptr;
+}
+
 void StyleComputer::push_ancestor(DOM::Element const& element)
 {
     for_each_element_hash(element, [&](u32 hash) {
@@ -23,6 +23,12 @@
 #include <LibWeb/Forward.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 
+namespace Web::SelectorEngine {
+
+class HasResultCache;
+
+}
+
 namespace Web::CSS {
 
 // A counting bloom filter with 2 hash functions.
@@ -147,6 +153,10 @@ public:
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
+    // While enabled, results of matching :has() are reused across elements. The DOM must not change in between.
+    void enable_has_result_cache();
+    void disable_has_result_cache();
+
     [[nodiscard]] GC::Ref<ComputedProperties> create_document_style() const;
 
     [[nodiscard]] GC::Ref<ComputedProperties> compute_style(DOM::Element&, Optional<CSS::PseudoElement> = {}, Optional<bool&> did_change_custom_properties = {}) const;
@@ -302,6 +312,7 @@ private:
     CSSPixelRect m_viewport_rect;
 
     OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
+    OwnPtr<SelectorEngine::HasResultCache> m_has_result_cache;
 };
 
 class FontLoader final : public GC::Cell {
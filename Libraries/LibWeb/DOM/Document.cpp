@@ -72,6 +72,7 @@
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/InputEventsTarget.h>
+#include <LibWeb/DOM/LiveCollection.h>
 #include <LibWeb/DOM/LiveNodeList.h>
 #include <LibWeb/DOM/NodeIterator.h>
 #include <LibWeb/DOM/Position.h>
@@ -1559,7 +1560,9 @@ void Document::update_style()
 
     style_computer().reset_ancestor_filter();
 
+    style_computer().enable_has_result_cache();
     auto invalidation = update_style_recursively(*this, style_computer(), false, false);
+    style_computer().disable_has_result_cache();
     if (!invalidation.is_none())
         invalidate_display_list();
     if (invalidation.rebuild_stacking_context_tree)
@@ -1764,12 +1767,13 @@ static Node* find_common_ancestor(Node* a, Node* b)
 
 void Document::invalidate_style_of_elements_affected_by_has()
 {
-    if (m_pending_nodes_for_style_invalidation_due_to_presence_of_has.is_empty()) {
+    if (m_pending_nodes_for_style_invalidation_due_to_presence_of_has.is_empty() && m_pending_parents_for_style_invalidation_of_children_due_to_presence_of_has.is_empty()) {
         return;
     }
 
     ScopeGuard clear_pending_nodes_guard = [&] {
         m_pending_nodes_for_style_invalidation_due_to_presence_of_has.clear();
+        m_pending_parents_for_style_invalidation_of_children_due_to_presence_of_has.clear();
     };
 
     // It's ok to call have_has_selectors() instead of may_have_has_selectors() here and force
@@ -1779,11 +1783,30 @@ void Document::invalidate_style_of_elements_affected_by_has()
         return;
     }
 
+    auto invalidate_children_affected_by_sibling_combinator = [](Node& parent) {
+        parent.for_each_child_of_type<Element>([&](auto& child) {
+            if (child.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+                child.invalidate_style_if_affected_by_has();
+            return IterationDecision::Continue;
+        });
+    };
+
+    auto parents = move(m_pending_parents_for_style_invalidation_of_children_due_to_presence_of_has);
+    for (auto const& parent : parents) {
+        if (!parent.is_null())
+            invalidate_children_affected_by_sibling_combinator(*parent);
+    }
+
+    // All mutations since the last style update are handled together here, and the ancestor chains of mutated nodes
+    // usually overlap, so every ancestor (and the siblings of every ancestor) is only visited once.
+    HashTable<Node*> visited_ancestors;
     auto nodes = move(m_pending_nodes_for_style_invalidation_due_to_presence_of_has);
     for (auto const& node : nodes) {
         if (node.is_null())
             continue;
         for (auto* ancestor = node.ptr(); ancestor; ancestor = ancestor->parent_or_shadow_host()) {
+            if (visited_ancestors.set(ancestor, AK::HashSetExistingEntryBehavior::Keep) == AK::HashSetResult::KeptExistingEntry)
+                break;
             if (!ancestor->is_element())
                 continue;
             auto& element = static_cast<Element&>(*ancestor);
@@ -1791,15 +1814,11 @@ void Document::invalidate_style_of_elements_affected_by_has()
 
             auto* parent = ancestor->parent_or_shadow_host();
             if (!parent)
-                return;
+                break;
 
             // If any ancestor's sibling was tested against selectors like ".a:has(+ .b)" or ".a:has(~ .b)"
             // its style might be affected by the change in descendant node.
-            parent->for_each_child_of_type<Element>([&](auto& ancestor_sibling_element) {
-                if (ancestor_sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
-                    ancestor_sibling_element.invalidate_style_if_affected_by_has();
-                return IterationDecision::Continue;
-            });
+            invalidate_children_affected_by_sibling_combinator(*parent);
         }
     }
 }
@@ -1954,7 +1973,7 @@ void Document::set_hovered_node(GC::Ptr<Node> node)
 // https://html.spec.whatwg.org/multipage/dom.html#dom-document-getelementsbyname
 GC::Ref<NodeList> Document::get_elements_by_name(FlyString const& name)
 {
-    return LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Descendants, [name](auto const& node) {
+    return LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Descendants, LiveNodeList::FilterDependencies::node_itself({ HTML::AttributeNames::name }), [name](auto const& node) {
         if (!is<HTML::HTMLElement>(node))
             return false;
         return as<HTML::HTMLElement>(node).name() == name;
@@ -1965,7 +1984,7 @@ GC::Ref<NodeList> Document::get_elements_by_name(FlyString const& name)
 GC::Ref<HTMLCollection> Document::applets()
 {
     if (!m_applets)
-        m_applets = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](auto&) { return false; });
+        m_applets = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [](auto&) { return false; });
     return *m_applets;
 }
 
@@ -1973,7 +1992,7 @@ GC::Ref<HTMLCollection> Document::applets()
 GC::Ref<HTMLCollection> Document::anchors()
 {
     if (!m_anchors) {
-        m_anchors = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
+        m_anchors = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself({ HTML::AttributeNames::name }), [](Element const& element) {
             return is<HTML::HTMLAnchorElement>(element) && element.name().has_value();
         });
     }
@@ -1984,7 +2003,7 @@ GC::Ref<HTMLCollection> Document::anchors()
 GC::Ref<HTMLCollection> Document::images()
 {
     if (!m_images) {
-        m_images = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
+        m_images = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [](Element const& element) {
             return is<HTML::HTMLImageElement>(element);
         });
     }
@@ -1995,7 +2014,7 @@ GC::Ref<HTMLCollection> Document::images()
 GC::Ref<HTMLCollection> Document::embeds()
 {
     if (!m_embeds) {
-        m_embeds = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
+        m_embeds = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [](Element const& element) {
             return is<HTML::HTMLEmbedElement>(element);
         });
     }
@@ -2012,7 +2031,7 @@ GC::Ref<HTMLCollection> Document::plugins()
 GC::Ref<HTMLCollection> Document::links()
 {
     if (!m_links) {
-        m_links = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
+        m_links = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself({ HTML::AttributeNames::href }), [](Element const& element) {
             return (is<HTML::HTMLAnchorElement>(element) || is<HTML::HTMLAreaElement>(element)) && element.has_attribute(HTML::AttributeNames::href);
         });
     }
@@ -2023,7 +2042,7 @@ GC::Ref<HTMLCollection> Document::links()
 GC::Ref<HTMLCollection> Document::forms()
 {
     if (!m_forms) {
-        m_forms = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
+        m_forms = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [](Element const& element) {
             return is<HTML::HTMLFormElement>(element);
         });
     }
@@ -2034,7 +2053,7 @@ GC::Ref<HTMLCollection> Document::forms()
 GC::Ref<HTMLCollection> Document::scripts()
 {
     if (!m_scripts) {
-        m_scripts = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
+        m_scripts = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [](Element const& element) {
             return is<HTML::HTMLScriptElement>(element);
         });
     }
@@ -2405,6 +2424,15 @@ void Document::adopt_node(Node& node)
             old_document.m_node_iterators.remove(&node_iterator);
             m_node_iterators.set(&node_iterator);
         }
+
+        // Transfer live collections rooted within `node` from old_document to this document.
+        if (!old_document.m_live_collections.is_empty()) {
+            node.for_each_shadow_including_inclusive_descendant([&](auto& inclusive_descendant) {
+                if (auto live_collections = old_document.m_live_collections.take(&inclusive_descendant); live_collections.has_value())
+                    m_live_collections.set(&inclusive_descendant, live_collections.release_value());
+                return TraversalDecision::Continue;
+            });
+        }
     }
 }
 
@@ -3634,6 +3662,58 @@ void Document::unregister_node_iterator(Badge<NodeIterator>, NodeIterator& node_
     VERIFY(was_removed);
 }
 
+void Document::register_live_collection(Badge<LiveCollection>, Node const& root, LiveCollection& live_collection)
+{
+    m_live_collections.ensure(&root).append(&live_collection);
+}
+
+void Document::unregister_live_collection(Badge<LiveCollection>, Node const& root, LiveCollection& live_collection)
+{
+    auto it = m_live_collections.find(&root);
+    VERIFY(it != m_live_collections.end());
+    bool was_removed = it->value.remove_first_matching([&](auto* registered) { return registered == &live_collection; });
+    VERIFY(was_removed);
+    if (it->value.is_empty())
+        m_live_collections.remove(it);
+}
+
+// Live collections are registered by their root, so the ones that may be affected by a mutation are those rooted at an
+// inclusive ancestor of the mutated node's parent.
+template<typename Callback>
+static void for_each_live_collection_rooted_at_inclusive_ancestor(HashMap<GC::RawPtr<Node const>, Vector<LiveCollection*>> const& live_collections, Node const* node, Callback callback)
+{
+    if (live_collections.is_empty())
+        return;
+    for (auto const* ancestor = node; ancestor; ancestor = ancestor->parent()) {
+        auto collections = live_collections.get(ancestor);
+        if (!collections.has_value())
+            continue;
+        for (auto* live_collection : *collections)
+            callback(*live_collection);
+    }
+}
+
+void Document::live_collections_did_insert_node(Badge<Node>, Node const& node)
+{
+    for_each_live_collection_rooted_at_inclusive_ancestor(m_live_collections, node.parent(), [&](LiveCollection& live_collection) {
+        live_collection.did_insert_node(node);
+    });
+}
+
+void Document::live_collections_did_remove_node(Badge<Node>, Node const& node, Node const& old_parent)
+{
+    for_each_live_collection_rooted_at_inclusive_ancestor(m_live_collections, &old_parent, [&](LiveCollection& live_collection) {
+        live_collection.did_remove_node(node, old_parent);
+    });
+}
+
+void Document::live_collections_did_change_attribute(Badge<Element>, Element const& element, FlyString const& local_name)
+{
+    for_each_live_collection_rooted_at_inclusive_ancestor(m_live_collections, element.parent(), [&](LiveCollection& live_collection) {
+        live_collection.did_change_attribute(element, local_name);
+    });
+}
+
 void Document::register_document_observer(Badge<DocumentObserver>, DocumentObserver& document_observer)
 {
     auto result = m_document_observers.set(document_observer);
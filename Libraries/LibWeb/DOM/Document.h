@@ -24,6 +24,7 @@
 #include <LibWeb/CSS/CSSPropertyRule.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
 #include <LibWeb/CSS/EnvironmentVariable.h>
+#include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/Cookie/Cookie.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -575,6 +576,13 @@ public:
     void register_node_iterator(Badge<NodeIterator>, NodeIterator&);
     void unregister_node_iterator(Badge<NodeIterator>, NodeIterator&);
 
+    void register_live_collection(Badge<LiveCollection>, Node const& root, LiveCollection&);
+    void unregister_live_collection(Badge<LiveCollection>, Node const& root, LiveCollection&);
+
+    void live_collections_did_insert_node(Badge<Node>, Node const&);
+    void live_collections_did_remove_node(Badge<Node>, Node const&, Node const& old_parent);
+    void live_collections_did_change_attribute(Badge<Element>, Element const&, FlyString const& local_name);
+
     void register_document_observer(Badge<DocumentObserver>, DocumentObserver&);
     void unregister_document_observer(Badge<DocumentObserver>, DocumentObserver&);
 
@@ -902,8 +910,17 @@ public:
         m_pending_nodes_for_style_invalidation_due_to_presence_of_has.set(node.make_weak_ptr<Node>());
     }
 
+    void schedule_children_style_invalidation_due_to_presence_of_has(Node& parent)
+    {
+        m_pending_parents_for_style_invalidation_of_children_due_to_presence_of_has.set(parent.make_weak_ptr<Node>());
+    }
+
     ElementByIdMap& element_by_id() const;
 
+    // Selector lists parsed by querySelector() and friends, keyed by their source text, and kept in least recently
+    // used order. An empty value means the text failed to parse.
+    auto& parsed_query_selectors() { return m_parsed_query_selectors; }
+
     auto& script_blocking_style_sheet_set() { return m_script_blocking_style_sheet_set; }
     auto const& script_blocking_style_sheet_set() const { return m_script_blocking_style_sheet_set; }
 
@@ -976,6 +993,7 @@ private:
     GC::Ptr<HTML::BrowsingContext> m_browsing_context;
     URL::URL m_url;
     mutable OwnPtr<ElementByIdMap> m_element_by_id;
+    OrderedHashMap<String, Optional<CSS::SelectorList>> m_parsed_query_selectors;
 
     GC::Ptr<HTML::Window> m_window;
 
@@ -1088,6 +1106,10 @@ private:
 
     HashTable<GC::Ptr<NodeIterator>> m_node_iterators;
 
+    // Live collections that want to be told about mutations within their root's subtree, by root.
+    // NOTE: These are not visited, the collections unregister themselves when they are finalized.
+    HashMap<GC::RawPtr<Node const>, Vector<LiveCollection*>> m_live_collections;
+
     // Document should not visit DocumentObserver to avoid leaks.
     // It's responsibility of object that requires DocumentObserver to keep it alive.
     HashTable<GC::RawRef<DocumentObserver>> m_document_observers;
@@ -1281,6 +1303,7 @@ private:
     HashTable<GC::Ref<Element>> m_render_blocking_elements;
 
     HashTable<WeakPtr<Node>> m_pending_nodes_for_style_invalidation_due_to_presence_of_has;
+    HashTable<WeakPtr<Node>> m_pending_parents_for_style_invalidation_of_children_due_to_presence_of_has;
 
     GC::Ref<StyleInvalidator> m_style_invalidator;
 
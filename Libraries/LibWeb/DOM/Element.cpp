@@ -664,6 +664,7 @@ void Element::run_attribute_change_steps(FlyString const& local_name, Optional<S
     if (old_value != value) {
         invalidate_style_after_attribute_change(local_name, old_value, value);
         document().bump_dom_tree_version();
+        document().live_collections_did_change_attribute({}, *this, local_name);
     }
 }
 
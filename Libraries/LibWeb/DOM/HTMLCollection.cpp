@@ -11,6 +11,7 @@
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/ParentNode.h>
+#include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/Namespace.h>
 
 namespace Web::DOM {
@@ -22,11 +23,16 @@ GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, Fu
     return root.realm().create<HTMLCollection>(root, scope, move(filter));
 }
 
-HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, Function<bool(Element const&)> filter)
+GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, FilterDependencies filter_dependencies, Function<bool(Element const&)> filter)
+{
+    return root.realm().create<HTMLCollection>(root, scope, move(filter), move(filter_dependencies));
+}
+
+HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, Function<bool(Element const&)> filter, FilterDependencies filter_dependencies)
     : PlatformObject(root.realm())
+    , LiveCollection(root, scope, move(filter_dependencies))
     , m_root(root)
     , m_filter(move(filter))
-    , m_scope(scope)
 {
     m_legacy_platform_object_flags = LegacyPlatformObjectFlags {
         .supports_indexed_properties = true,
@@ -43,67 +49,69 @@ void HTMLCollection::initialize(JS::Realm& realm)
     Base::initialize(realm);
 }
 
+void HTMLCollection::finalize()
+{
+    Base::finalize();
+    unregister_from_document();
+}
+
 void HTMLCollection::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
+    visit_live_collection_edges(visitor);
     visitor.visit(m_root);
-    visitor.visit(m_cached_elements);
     if (m_cached_name_to_element_mappings)
         visitor.visit(*m_cached_name_to_element_mappings);
 }
 
+bool HTMLCollection::node_matches_filter(Node const& node) const
+{
+    auto const* element = as_if<Element>(node);
+    return element && m_filter(*element);
+}
+
+void HTMLCollection::cached_nodes_did_change() const
+{
+    m_cached_name_to_element_mappings = nullptr;
+}
+
+void HTMLCollection::did_change_attribute(Element const& element, FlyString const& local_name)
+{
+    // The supported property names come from the IDs and names of the elements, whether or not the filter looks at them.
+    if (local_name == HTML::AttributeNames::id || local_name == HTML::AttributeNames::name)
+        m_cached_name_to_element_mappings = nullptr;
+    LiveCollection::did_change_attribute(element, local_name);
+}
+
 void HTMLCollection::update_name_to_element_mappings_if_needed() const
 {
-    update_cache_if_needed();
+    auto const& elements = cached_nodes();
     if (m_cached_name_to_element_mappings)
         return;
     m_cached_name_to_element_mappings = make<OrderedHashMap<FlyString, GC::Ref<Element>>>();
-    for (auto const& element : m_cached_elements) {
+    for (auto const& node : elements) {
+        auto& element = static_cast<Element&>(*node);
+
         // 1. If element has an ID which is not in result, append element’s ID to result.
-        if (auto const& id = element->id(); id.has_value()) {
+        if (auto const& id = element.id(); id.has_value()) {
             if (!id.value().is_empty() && !m_cached_name_to_element_mappings->contains(id.value()))
                 m_cached_name_to_element_mappings->set(id.value(), element);
         }
 
         // 2. If element is in the HTML namespace and has a name attribute whose value is neither the empty string nor is in result, append element’s name attribute value to result.
-        if (element->namespace_uri() == Namespace::HTML && element->name().has_value()) {
-            auto element_name = element->name().value();
+        if (element.namespace_uri() == Namespace::HTML && element.name().has_value()) {
+            auto element_name = element.name().value();
             if (!element_name.is_empty() && !m_cached_name_to_element_mappings->contains(element_name))
                 m_cached_name_to_element_mappings->set(move(element_name), element);
         }
     }
 }
 
-void HTMLCollection::update_cache_if_needed() const
-{
-    // Nothing to do, the DOM hasn't updated since we last built the cache.
-    if (m_cached_dom_tree_version == root()->document().dom_tree_version())
-        return;
-
-    m_cached_elements.clear();
-    m_cached_name_to_element_mappings = nullptr;
-    if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree_of_type<Element>([&](auto& element) {
-            if (m_filter(element))
-                m_cached_elements.append(element);
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child_of_type<Element>([&](auto& element) {
-            if (m_filter(element))
-                m_cached_elements.append(element);
-            return IterationDecision::Continue;
-        });
-    }
-    m_cached_dom_tree_version = root()->document().dom_tree_version();
-}
-
 GC::RootVector<GC::Ref<Element>> HTMLCollection::collect_matching_elements() const
 {
-    update_cache_if_needed();
     GC::RootVector<GC::Ref<Element>> elements(heap());
-    for (auto& element : m_cached_elements)
-        elements.append(element);
+    for (auto const& node : cached_nodes())
+        elements.append(static_cast<Element&>(*node));
     return elements;
 }
 
@@ -111,18 +119,17 @@ GC::RootVector<GC::Ref<Element>> HTMLCollection::collect_matching_elements() con
 size_t HTMLCollection::length() const
 {
     // The length getter steps are to return the number of nodes represented by the collection.
-    update_cache_if_needed();
-    return m_cached_elements.size();
+    return cached_nodes().size();
 }
 
 // https://dom.spec.whatwg.org/#dom-htmlcollection-item
 Element* HTMLCollection::item(size_t index) const
 {
     // The item(index) method steps are to return the indexth element in the collection. If there is no indexth element in the collection, then the method must return null.
-    update_cache_if_needed();
-    if (index >= m_cached_elements.size())
+    auto const& elements = cached_nodes();
+    if (index >= elements.size())
         return nullptr;
-    return m_cached_elements[index];
+    return static_cast<Element*>(elements[index].ptr());
 }
 
 // https://dom.spec.whatwg.org/#dom-htmlcollection-nameditem-key
@@ -10,6 +10,7 @@
 #include <AK/Function.h>
 #include <LibGC/Ptr.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/DOM/LiveCollection.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::DOM {
@@ -21,16 +22,15 @@ namespace Web::DOM {
 // The filter is a simple Function object that answers the question
 // "is this Element part of the collection?"
 
-class HTMLCollection : public Bindings::PlatformObject {
+class HTMLCollection
+    : public Bindings::PlatformObject
+    , public LiveCollection {
     WEB_PLATFORM_OBJECT(HTMLCollection, Bindings::PlatformObject);
     GC_DECLARE_ALLOCATOR(HTMLCollection);
 
 public:
-    enum class Scope {
-        Children,
-        Descendants,
-    };
     [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+    [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, FilterDependencies, ESCAPING Function<bool(Element const&)> filter);
 
     virtual ~HTMLCollection() override;
 
@@ -46,7 +46,7 @@ public:
     virtual bool is_supported_property_name(FlyString const&) const override;
 
 protected:
-    HTMLCollection(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+    HTMLCollection(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter, FilterDependencies = FilterDependencies::document());
 
     virtual void initialize(JS::Realm&) override;
 
@@ -55,18 +55,19 @@ protected:
 
 private:
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    // ^LiveCollection
+    virtual bool node_matches_filter(Node const&) const override;
+    virtual void cached_nodes_did_change() const override;
+    virtual void did_change_attribute(Element const&, FlyString const& local_name) override;
 
-    void update_cache_if_needed() const;
     void update_name_to_element_mappings_if_needed() const;
 
-    mutable u64 m_cached_dom_tree_version { 0 };
-    mutable Vector<GC::Ref<Element>> m_cached_elements;
     mutable OwnPtr<OrderedHashMap<FlyString, GC::Ref<Element>>> m_cached_name_to_element_mappings;
 
     GC::Ref<ParentNode> m_root;
     Function<bool(Element const&)> m_filter;
-
-    Scope m_scope { Scope::Descendants };
 };
 
 }
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/LiveCollection.h>
+
+namespace Web::DOM {
+
+LiveCollection::LiveCollection(Node const& root, Scope scope, FilterDependencies filter_dependencies)
+    : m_live_collection_root(root)
+    , m_scope(scope)
+    , m_filter_dependencies(move(filter_dependencies))
+{
+    if (is_registered_with_document())
+        root.document().register_live_collection({}, root, *this);
+}
+
+LiveCollection::~LiveCollection() = default;
+
+void LiveCollection::unregister_from_document()
+{
+    if (is_registered_with_document())
+        m_live_collection_root->document().unregister_live_collection({}, *m_live_collection_root, *this);
+}
+
+void LiveCollection::visit_live_collection_edges(GC::Cell::Visitor& visitor)
+{
+    visitor.visit(m_live_collection_root);
+    visitor.visit(m_cached_nodes);
+}
+
+Vector<GC::Ref<Node>> const& LiveCollection::cached_nodes() const
+{
+    auto const& document = live_collection_root().document();
+
+    // Registered collections are told about every mutation that may affect them, everything else has to assume that
+    // any mutation in the document did.
+    if (m_cache_is_valid && (is_registered_with_document() || m_cached_dom_tree_version == document.dom_tree_version()))
+        return m_cached_nodes;
+
+    m_cached_nodes.clear();
+    if (m_scope == Scope::Descendants) {
+        live_collection_root().for_each_in_subtree([&](auto& node) {
+            if (node_matches_filter(node))
+                m_cached_nodes.append(const_cast<Node&>(node));
+            return TraversalDecision::Continue;
+        });
+    } else {
+        live_collection_root().for_each_child([&](auto& node) {
+            if (node_matches_filter(node))
+                m_cached_nodes.append(const_cast<Node&>(node));
+            return IterationDecision::Continue;
+        });
+    }
+
+    m_cache_is_valid = true;
+    m_cached_dom_tree_version = document.dom_tree_version();
+    cached_nodes_did_change();
+    return m_cached_nodes;
+}
+
+void LiveCollection::invalidate_cache()
+{
+    m_cache_is_valid = false;
+    m_cached_nodes.clear();
+    cached_nodes_did_change();
+}
+
+void LiveCollection::did_insert_node(Node const& node)
+{
+    if (!m_cache_is_valid)
+        return;
+
+    if (m_filter_dependencies.kind != FilterDependencies::Kind::NodeItself) {
+        invalidate_cache();
+        return;
+    }
+
+    auto const& root = live_collection_root();
+    if (m_scope == Scope::Children && node.parent() != &root)
+        return;
+
+    Vector<GC::Ref<Node>> inserted_nodes;
+    if (m_scope == Scope::Descendants) {
+        node.for_each_in_inclusive_subtree([&](auto& inclusive_descendant) {
+            if (node_matches_filter(inclusive_descendant))
+                inserted_nodes.append(const_cast<Node&>(inclusive_descendant));
+            return TraversalDecision::Continue;
+        });
+    } else if (node_matches_filter(node)) {
+        inserted_nodes.append(const_cast<Node&>(node));
+    }
+
+    if (inserted_nodes.is_empty())
+        return;
+
+    // If nothing in the root's subtree follows the inserted node, its matching nodes simply go to the end of the cache.
+    // Anything else would require finding their position in tree order, so we rebuild the cache instead.
+    for (auto const* ancestor = &node; ancestor && ancestor != &root; ancestor = ancestor->parent()) {
+        if (ancestor->next_sibling()) {
+            invalidate_cache();
+            return;
+        }
+    }
+
+    m_cached_nodes.extend(move(inserted_nodes));
+    cached_nodes_did_change();
+}
+
+void LiveCollection::did_remove_node(Node const& node, Node const& old_parent)
+{
+    if (!m_cache_is_valid)
+        return;
+
+    if (m_filter_dependencies.kind != FilterDependencies::Kind::NodeItself) {
+        invalidate_cache();
+        return;
+    }
+
+    if (m_scope == Scope::Children && &old_parent != &live_collection_root())
+        return;
+
+    // The removed nodes that were part of the collection are next to each other in the cache, in tree order.
+    GC::Ptr<Node const> first_removed_node;
+    size_t removed_node_count = 0;
+    auto count_if_matching = [&](Node const& removed_node) {
+        if (!node_matches_filter(removed_node))
+            return;
+        if (!first_removed_node)
+            first_removed_node = removed_node;
+        ++removed_node_count;
+    };
+
+    if (m_scope == Scope::Descendants) {
+        node.for_each_in_inclusive_subtree([&](auto& inclusive_descendant) {
+            count_if_matching(inclusive_descendant);
+            return TraversalDecision::Continue;
+        });
+    } else {
+        count_if_matching(node);
+    }
+
+    if (removed_node_count == 0)
+        return;
+
+    auto index = m_cached_nodes.find_first_index_if([&](auto const& cached_node) { return cached_node.ptr() == first_removed_node.ptr(); });
+    if (!index.has_value() || *index + removed_node_count > m_cached_nodes.size()) {
+        invalidate_cache();
+        return;
+    }
+
+    m_cached_nodes.remove(*index, removed_node_count);
+    cached_nodes_did_change();
+}
+
+void LiveCollection::did_change_attribute(Element const& element, FlyString const& local_name)
+{
+    if (!m_cache_is_valid)
+        return;
+
+    if (m_filter_dependencies.kind == FilterDependencies::Kind::NodeItself) {
+        if (m_scope == Scope::Children && element.parent() != &live_collection_root())
+            return;
+        if (!m_filter_dependencies.attributes.contains_slow(local_name))
+            return;
+    }
+
+    invalidate_cache();
+}
+
+}
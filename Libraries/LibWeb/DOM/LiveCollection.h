@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/Ptr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::DOM {
+
+// The shared caching logic of HTMLCollection and LiveNodeList, which represent a live, filtered view of a DOM subtree.
+//
+// The nodes represented by the collection are cached until a DOM mutation may have changed them. How eagerly the cache
+// is thrown away depends on what the filter looks at:
+// - By default, the filter may look at anything, and the cache is rebuilt after any mutation in the document.
+// - Collections whose filter only looks at nodes within the root's subtree are registered with their root's node
+//   document, which tells them about mutations within that subtree. Mutations elsewhere leave the cache alone.
+// - Collections whose filter only looks at the node itself, and at a known set of its attributes, are additionally
+//   updated in place when nodes are appended to or removed from the subtree, and ignore changes to other attributes.
+class LiveCollection {
+public:
+    enum class Scope {
+        Children,
+        Descendants,
+    };
+
+    struct FilterDependencies {
+        enum class Kind {
+            Document,
+            Subtree,
+            NodeItself,
+        };
+
+        static FilterDependencies document() { return {}; }
+        static FilterDependencies subtree() { return { .kind = Kind::Subtree, .attributes = {} }; }
+        static FilterDependencies node_itself(Vector<FlyString> attributes = {}) { return { .kind = Kind::NodeItself, .attributes = move(attributes) }; }
+
+        Kind kind { Kind::Document };
+
+        // For Kind::NodeItself, the attributes of the node that the filter looks at.
+        Vector<FlyString> attributes;
+    };
+
+    virtual ~LiveCollection();
+
+    // Called by the root's node document after the given node was inserted into the root's subtree.
+    void did_insert_node(Node const&);
+
+    // Called by the root's node document after the given node was removed from old_parent, within the root's subtree.
+    void did_remove_node(Node const&, Node const& old_parent);
+
+    // Called by the root's node document after an attribute of an element within the root's subtree has changed.
+    virtual void did_change_attribute(Element const&, FlyString const& local_name);
+
+protected:
+    LiveCollection(Node const& root, Scope, FilterDependencies);
+
+    virtual bool node_matches_filter(Node const&) const = 0;
+
+    // Called whenever the cached nodes have changed, so that caches derived from them can be thrown away.
+    virtual void cached_nodes_did_change() const { }
+
+    Vector<GC::Ref<Node>> const& cached_nodes() const;
+
+    void visit_live_collection_edges(GC::Cell::Visitor&);
+    void unregister_from_document();
+
+private:
+    Node const& live_collection_root() const { return *m_live_collection_root; }
+    bool is_registered_with_document() const { return m_filter_dependencies.kind != FilterDependencies::Kind::Document; }
+
+    void invalidate_cache();
+
+    GC::Ref<Node const> m_live_collection_root;
+    Scope m_scope { Scope::Descendants };
+    FilterDependencies m_filter_dependencies;
+
+    mutable Vector<GC::Ref<Node>> m_cached_nodes;
+    mutable bool m_cache_is_valid { false };
+    mutable u64 m_cached_dom_tree_version { 0 };
+};
+
+}
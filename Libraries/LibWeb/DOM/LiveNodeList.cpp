@@ -5,8 +5,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <LibGC/Heap.h>
-#include <LibJS/Runtime/Error.h>
 #include <LibWeb/DOM/LiveNodeList.h>
 #include <LibWeb/DOM/Node.h>
 
@@ -19,78 +17,62 @@ GC::Ref<NodeList> LiveNodeList::create(JS::Realm& realm, Node const& root, Scope
     return realm.create<LiveNodeList>(realm, root, scope, move(filter));
 }
 
-LiveNodeList::LiveNodeList(JS::Realm& realm, Node const& root, Scope scope, Function<bool(Node const&)> filter)
+GC::Ref<NodeList> LiveNodeList::create(JS::Realm& realm, Node const& root, Scope scope, FilterDependencies filter_dependencies, Function<bool(Node const&)> filter)
+{
+    return realm.create<LiveNodeList>(realm, root, scope, move(filter), move(filter_dependencies));
+}
+
+LiveNodeList::LiveNodeList(JS::Realm& realm, Node const& root, Scope scope, Function<bool(Node const&)> filter, FilterDependencies filter_dependencies)
     : NodeList(realm)
+    , LiveCollection(root, scope, move(filter_dependencies))
     , m_root(root)
     , m_filter(move(filter))
-    , m_scope(scope)
 {
 }
 
 LiveNodeList::~LiveNodeList() = default;
 
+void LiveNodeList::finalize()
+{
+    Base::finalize();
+    unregister_from_document();
+}
+
 void LiveNodeList::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
+    visit_live_collection_edges(visitor);
     visitor.visit(m_root);
 }
 
-GC::RootVector<Node*> LiveNodeList::collection() const
+bool LiveNodeList::node_matches_filter(Node const& node) const
 {
-    GC::RootVector<Node*> nodes(heap());
-    if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree([&](auto& node) {
-            if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child([&](auto& node) {
-            if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
-            return IterationDecision::Continue;
-        });
-    }
-    return nodes;
+    return m_filter(node);
 }
 
 Node* LiveNodeList::first_matching(Function<bool(Node const&)> const& filter) const
 {
-    Node* matched_node = nullptr;
-    if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree([&](auto& node) {
-            if (m_filter(node) && filter(node)) {
-                matched_node = const_cast<Node*>(&node);
-                return TraversalDecision::Break;
-            }
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child([&](auto& node) {
-            if (m_filter(node) && filter(node)) {
-                matched_node = const_cast<Node*>(&node);
-                return IterationDecision::Break;
-            }
-            return IterationDecision::Continue;
-        });
+    for (auto const& node : cached_nodes()) {
+        if (filter(*node))
+            return node.ptr();
     }
-    return matched_node;
+    return nullptr;
 }
 
 // https://dom.spec.whatwg.org/#dom-nodelist-length
 u32 LiveNodeList::length() const
 {
-    return collection().size();
+    return cached_nodes().size();
 }
 
 // https://dom.spec.whatwg.org/#dom-nodelist-item
 Node const* LiveNodeList::item(u32 index) const
 {
     // The item(index) method must return the indexth node in the collection. If there is no indexth node in the collection, then the method must return null.
-    auto nodes = collection();
+    auto const& nodes = cached_nodes();
     if (index >= nodes.size())
         return nullptr;
-    return nodes[index];
+    return nodes[index].ptr();
 }
 
 }
@@ -8,41 +8,39 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <LibWeb/DOM/LiveCollection.h>
 #include <LibWeb/DOM/NodeList.h>
 
 namespace Web::DOM {
 
-// FIXME: Just like HTMLCollection, LiveNodeList currently does no caching.
-
-class LiveNodeList : public NodeList {
+class LiveNodeList
+    : public NodeList
+    , public LiveCollection {
     WEB_PLATFORM_OBJECT(LiveNodeList, NodeList);
     GC_DECLARE_ALLOCATOR(LiveNodeList);
 
 public:
-    enum class Scope {
-        Children,
-        Descendants,
-    };
-
     [[nodiscard]] static GC::Ref<NodeList> create(JS::Realm&, Node const& root, Scope, ESCAPING Function<bool(Node const&)> filter);
+    [[nodiscard]] static GC::Ref<NodeList> create(JS::Realm&, Node const& root, Scope, FilterDependencies, ESCAPING Function<bool(Node const&)> filter);
     virtual ~LiveNodeList() override;
 
     virtual u32 length() const override;
     virtual Node const* item(u32 index) const override;
 
 protected:
-    LiveNodeList(JS::Realm&, Node const& root, Scope, ESCAPING Function<bool(Node const&)> filter);
+    LiveNodeList(JS::Realm&, Node const& root, Scope, ESCAPING Function<bool(Node const&)> filter, FilterDependencies = FilterDependencies::document());
 
     Node* first_matching(Function<bool(Node const&)> const& filter) const;
 
 private:
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
 
-    GC::RootVector<Node*> collection() const;
+    // ^LiveCollection
+    virtual bool node_matches_filter(Node const&) const override;
 
     GC::Ref<Node const> m_root;
     Function<bool(Node const&)> m_filter;
-    Scope m_scope { Scope::Descendants };
 };
 
 }
@@ -422,11 +422,7 @@ void Node::invalidate_style(StyleInvalidationReason reason)
         if (reason == StyleInvalidationReason::NodeRemove) {
             if (auto* parent = parent_or_shadow_host(); parent) {
                 document().schedule_ancestors_style_invalidation_due_to_presence_of_has(*parent);
-                parent->for_each_child_of_type<Element>([&](auto& element) {
-                    if (element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
-                        element.invalidate_style_if_affected_by_has();
-                    return IterationDecision::Continue;
-                });
+                document().schedule_children_style_invalidation_due_to_presence_of_has(*parent);
             }
         } else {
             document().schedule_ancestors_style_invalidation_due_to_presence_of_has(*this);
@@ -1743,7 +1739,7 @@ Slottable Node::as_slottable()
 GC::Ref<NodeList> Node::child_nodes()
 {
     if (!m_child_nodes) {
-        m_child_nodes = LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Children, [](auto&) {
+        m_child_nodes = LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Children, LiveNodeList::FilterDependencies::node_itself(), [](auto&) {
             return true;
         });
     }
@@ -2588,6 +2584,7 @@ void Node::append_child_impl(GC::Ref<Node> node)
         return;
 
     TreeNode::append_child(node);
+    document().live_collections_did_insert_node({}, node);
 }
 
 void Node::insert_before_impl(GC::Ref<Node> node, GC::Ptr<Node> child)
@@ -2595,11 +2592,13 @@ void Node::insert_before_impl(GC::Ref<Node> node, GC::Ptr<Node> child)
     if (!child)
         return append_child_impl(move(node));
     TreeNode::insert_before(node, child);
+    document().live_collections_did_insert_node({}, node);
 }
 
 void Node::remove_child_impl(GC::Ref<Node> node)
 {
     TreeNode::remove_child(node);
+    document().live_collections_did_remove_node({}, node, *this);
 }
 
 void Node::build_accessibility_tree(AccessibilityTreeNode& parent)
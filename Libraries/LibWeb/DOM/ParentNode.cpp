@@ -15,6 +15,7 @@
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/StaticNodeList.h>
 #include <LibWeb/Dump.h>
+#include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/Namespace.h>
@@ -47,28 +48,65 @@ enum class ReturnMatches {
     First,
     All,
 };
+
+// Scripts tend to query the same handful of selectors over and over, so each document keeps its most recently used ones.
+static constexpr size_t max_parsed_query_selectors = 64;
+
+static Optional<CSS::SelectorList> parse_selector_for_query(ParentNode& node, StringView selector_text)
+{
+    auto& parsed_selectors = node.document().parsed_query_selectors();
+    auto key = MUST(String::from_utf8(selector_text));
+
+    if (auto it = parsed_selectors.find(key); it != parsed_selectors.end()) {
+        auto selectors = it->value;
+        // Move the entry to the back, so that the front is always the least recently used one.
+        parsed_selectors.remove(it);
+        parsed_selectors.set(move(key), selectors);
+        return selectors;
+    }
+
+    auto selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+
+    // "Note: Support for namespaces within selectors is not planned and will not be added."
+    if (selectors.has_value() && contains_named_namespace(*selectors))
+        selectors = {};
+
+    if (parsed_selectors.size() >= max_parsed_query_selectors)
+        parsed_selectors.remove(parsed_selectors.begin());
+    parsed_selectors.set(move(key), selectors);
+    return selectors;
+}
+
+// If every element matching the selector must have a specific ID, returns that ID.
+static Optional<FlyString> id_required_by_subject(CSS::Selector const& selector)
+{
+    if (selector.pseudo_element().has_value())
+        return {};
+    for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id)
+            return simple_selector.name();
+    }
+    return {};
+}
+
 // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
 static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_match_a_selectors_string(ParentNode& node, StringView selector_text, ReturnMatches return_matches)
 {
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+    auto maybe_selectors = parse_selector_for_query(node, selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(node.realm(), "Failed to parse selector"_utf16);
 
-    auto selectors = maybe_selectors.value();
-
-    // "Note: Support for namespaces within selectors is not planned and will not be added."
-    if (contains_named_namespace(selectors))
-        return WebIDL::SyntaxError::create(node.realm(), "Failed to parse selector"_utf16);
+    auto const& selectors = maybe_selectors.value();
 
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     GC::Ptr<Element> single_result;
     Vector<GC::Root<Node>> results;
-    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
-    node.for_each_in_subtree_of_type<Element>([&](auto& element) {
+
+    auto try_match = [&](Element& element) {
         for (auto& selector : selectors) {
             SelectorEngine::MatchContext context;
             if (SelectorEngine::matches(selector, element, nullptr, context, {}, node)) {
@@ -81,7 +119,28 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
             }
         }
         return TraversalDecision::Continue;
-    });
+    };
+
+    // OPTIMIZATION: Connected documents and shadow roots keep their elements indexed by ID, in tree order. If the
+    //               selector can only match elements with a specific ID, only those elements need to be considered.
+    Optional<FlyString> required_id;
+    if (selectors.size() == 1 && node.is_connected())
+        required_id = id_required_by_subject(selectors.first());
+
+    if (required_id.has_value()) {
+        auto& root = node.root();
+        auto& element_by_id = is<ShadowRoot>(root) ? static_cast<ShadowRoot&>(root).element_by_id() : node.document().element_by_id();
+        element_by_id.for_each_element_with_id(*required_id, [&](Element& element) {
+            if (!element.is_descendant_of(node))
+                return IterationDecision::Continue;
+            if (try_match(element) == TraversalDecision::Break)
+                return IterationDecision::Break;
+            return IterationDecision::Continue;
+        });
+    } else {
+        // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
+        node.for_each_in_subtree_of_type<Element>(try_match);
+    }
 
     if (return_matches == ReturnMatches::First)
         return { single_result };
@@ -136,7 +195,7 @@ GC::Ref<HTMLCollection> ParentNode::children()
 {
     // The children getter steps are to return an HTMLCollection collection rooted at this matching only element children.
     if (!m_children) {
-        m_children = HTMLCollection::create(*this, HTMLCollection::Scope::Children, [](Element const&) {
+        m_children = HTMLCollection::create(*this, HTMLCollection::Scope::Children, HTMLCollection::FilterDependencies::node_itself(), [](Element const&) {
             return true;
         });
     }
@@ -149,7 +208,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
 {
     // 1. If qualifiedName is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches only descendant elements.
     if (qualified_name == "*") {
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [](Element const&) {
             return true;
         });
     }
@@ -157,7 +216,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
     // 2. Otherwise, if root’s node document is an HTML document, return a HTMLCollection rooted at root, whose filter matches the following descendant elements:
     if (root().document().document_type() == Document::Type::HTML) {
         FlyString qualified_name_in_ascii_lowercase = qualified_name.to_ascii_lowercase();
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name, qualified_name_in_ascii_lowercase](Element const& element) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [qualified_name, qualified_name_in_ascii_lowercase](Element const& element) {
             // - Whose namespace is the HTML namespace and whose qualified name is qualifiedName, in ASCII lowercase.
             if (element.namespace_uri() == Namespace::HTML)
                 return element.qualified_name() == qualified_name_in_ascii_lowercase;
@@ -168,7 +227,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
     }
 
     // 3. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose qualified name is qualifiedName.
-    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name](Element const& element) {
+    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [qualified_name](Element const& element) {
         return element.qualified_name() == qualified_name;
     });
 }
@@ -183,27 +242,27 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name_ns(Optional<FlyStri
 
     // 2. If both namespace and localName are "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements.
     if (namespace_ == "*" && local_name == "*") {
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [](Element const&) {
             return true;
         });
     }
 
     // 3. Otherwise, if namespace is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose local name is localName.
     if (namespace_ == "*") {
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [local_name](Element const& element) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [local_name](Element const& element) {
             return element.local_name() == local_name;
         });
     }
 
     // 4. Otherwise, if localName is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace.
     if (local_name == "*") {
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_](Element const& element) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [namespace_](Element const& element) {
             return element.namespace_uri() == namespace_;
         });
     }
 
     // 5. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace and local name is localName.
-    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_, local_name](Element const& element) {
+    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself(), [namespace_, local_name](Element const& element) {
         return element.namespace_uri() == namespace_ && element.local_name() == local_name;
     });
 }
@@ -267,7 +326,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_class_name(StringView class_
     for (auto& name : class_names.split_view_if(Infra::is_ascii_whitespace)) {
         list_of_class_names.append(FlyString::from_utf8(name).release_value_but_fixme_should_propagate_errors());
     }
-    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [list_of_class_names = move(list_of_class_names), quirks_mode = document().in_quirks_mode()](Element const& element) {
+    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::FilterDependencies::node_itself({ HTML::AttributeNames::class_ }), [list_of_class_names = move(list_of_class_names), quirks_mode = document().in_quirks_mode()](Element const& element) {
         for (auto& name : list_of_class_names) {
             if (!element.has_class(name, quirks_mode ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive))
                 return false;
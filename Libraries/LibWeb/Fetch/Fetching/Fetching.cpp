@@ -2291,6 +2291,60 @@ static void log_response(auto const& status_code, auto const& headers, auto cons
 }
 #endif
 
+// Non-standard: The order in which RequestServer sends requests, based on what they are for and their fetch priority.
+//              Render-blocking stylesheets and scripts come first, then fonts, then images, and prefetches come last.
+static RequestServer::RequestPriority request_server_priority(Infrastructure::Request const& request)
+{
+    using Priority = RequestServer::RequestPriority;
+
+    if (request.initiator().has_value() && request.initiator().value() == Infrastructure::Request::Initiator::Prefetch)
+        return Priority::Lowest;
+
+    auto priority = Priority::Medium;
+
+    if (request.destination().has_value()) {
+        switch (request.destination().value()) {
+        case Infrastructure::Request::Destination::Document:
+        case Infrastructure::Request::Destination::Frame:
+        case Infrastructure::Request::Destination::IFrame:
+        case Infrastructure::Request::Destination::Script:
+        case Infrastructure::Request::Destination::Style:
+        case Infrastructure::Request::Destination::XSLT:
+            priority = Priority::Highest;
+            break;
+        case Infrastructure::Request::Destination::Font:
+            priority = Priority::High;
+            break;
+        case Infrastructure::Request::Destination::Audio:
+        case Infrastructure::Request::Destination::Embed:
+        case Infrastructure::Request::Destination::Image:
+        case Infrastructure::Request::Destination::Object:
+        case Infrastructure::Request::Destination::Track:
+        case Infrastructure::Request::Destination::Video:
+            priority = Priority::Low;
+            break;
+        default:
+            break;
+        }
+    }
+
+    // A fetch priority hint moves the request up or down by one step.
+    switch (request.priority()) {
+    case Infrastructure::Request::Priority::High:
+        if (priority != Priority::Highest)
+            priority = static_cast<Priority>(to_underlying(priority) + 1);
+        break;
+    case Infrastructure::Request::Priority::Low:
+        if (priority != Priority::Lowest)
+            priority = static_cast<Priority>(to_underlying(priority) - 1);
+        break;
+    case Infrastructure::Request::Priority::Auto:
+        break;
+    }
+
+    return priority;
+}
+
 // https://fetch.spec.whatwg.org/#concept-http-network-fetch
 // Drop-in replacement for 'HTTP-network fetch', but obviously non-standard :^)
 // It also handles file:// URLs since those can also go through ResourceLoader.
@@ -2316,6 +2370,7 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     load_request.set_url(request->current_url());
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
+    load_request.set_priority(request_server_priority(*request));
 
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
@@ -417,6 +417,7 @@ class EventHandler;
 class EventTarget;
 class HTMLCollection;
 class IDLEventListener;
+class LiveCollection;
 class LiveNodeList;
 class MutationObserver;
 class MutationRecord;
@@ -771,6 +772,7 @@ class IDBRequest;
 class IDBTransaction;
 class IDBVersionChangeEvent;
 class Index;
+class Key;
 class ObjectStore;
 class RequestList;
 
@@ -37,7 +37,7 @@ GC::Ref<DOM::HTMLCollection> HTMLDataListElement::options()
 {
     // The options IDL attribute must return an HTMLCollection rooted at the datalist node, whose filter matches option elements.
     if (!m_options) {
-        m_options = DOM::HTMLCollection::create(*this, DOM::HTMLCollection::Scope::Descendants, [](Element const& element) {
+        m_options = DOM::HTMLCollection::create(*this, DOM::HTMLCollection::Scope::Descendants, DOM::HTMLCollection::FilterDependencies::node_itself(), [](Element const& element) {
             return is<HTML::HTMLOptionElement>(element);
         });
     }
@@ -94,14 +94,15 @@ void HTMLLinkElement::inserted()
             request.set_page(Bindings::principal_host_defined_page(HTML::principal_realm(realm())));
             set_resource(ResourceLoader::the().load_resource(Resource::Type::Generic, request));
         }
-    } else if (m_relationship & Relationship::DNSPrefetch) {
-        if (auto dns_prefetch_url = document().encoding_parse_url(get_attribute_value(HTML::AttributeNames::href)); dns_prefetch_url.has_value()) {
-            ResourceLoader::the().prefetch_dns(dns_prefetch_url.value());
-        }
     } else if (m_relationship & Relationship::Preconnect) {
+        // NOTE: Connecting also resolves the host, so this takes care of rel="dns-prefetch preconnect" as well.
         if (auto maybe_href = document().encoding_parse_url(get_attribute_value(HTML::AttributeNames::href)); maybe_href.has_value()) {
             ResourceLoader::the().preconnect(maybe_href.value());
         }
+    } else if (m_relationship & Relationship::DNSPrefetch) {
+        if (auto dns_prefetch_url = document().encoding_parse_url(get_attribute_value(HTML::AttributeNames::href)); dns_prefetch_url.has_value()) {
+            ResourceLoader::the().prefetch_dns(dns_prefetch_url.value());
+        }
     } else if (m_relationship & Relationship::Icon) {
         if (auto favicon_url = document().encoding_parse_url(href()); favicon_url.has_value()) {
             auto favicon_request = LoadRequest::create_for_url_on_page(favicon_url.value(), &document().page());
@@ -29,6 +29,7 @@ GC_DEFINE_ALLOCATOR(Location);
 Location::Location(JS::Realm& realm)
     : PlatformObject(realm, MayInterfereWithIndexedPropertyAccess::Yes)
 {
+    m_has_exotic_named_property_lookup = true;
 }
 
 Location::~Location() = default;
@@ -44,6 +44,7 @@
 #include <LibWeb/Layout/Node.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Loader/GeneratedPagesLoader.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
 #include <LibWeb/Painting/NavigableContainerViewportPaintable.h>
@@ -871,6 +872,11 @@ static WebIDL::ExceptionOr<Navigable::NavigationParamsVariant> create_navigation
     if (navigable->top_level_traversable()->parent() == nullptr)
         request->set_top_level_navigation_initiator_origin(entry->document_state()->origin());
 
+    // AD-HOC: Let the network process know that a top-level navigation is starting, so that it can start connecting
+    //         to the origins that it expects the new document to load subresources from.
+    if (navigable->is_top_level_traversable())
+        ResourceLoader::the().will_navigate(entry->url());
+
     // 5. If request's client is null:
     if (request->client() == nullptr) {
         // Note: This only occurs in the case of a browser UI-initiated navigation.
@@ -5,9 +5,11 @@
  */
 
 #include <LibCore/EventLoop.h>
+#include <LibGfx/PaintingSurface.h>
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TileRasterizer.h>
 
 namespace Web::HTML {
 
@@ -67,7 +69,7 @@ void RenderingThread::rendering_thread_loop()
             break;
         }
 
-        m_skia_player->execute(*task->display_list, move(task->scroll_state_snapshot_by_display_list), task->painting_surface);
+        rasterize(*task);
         if (m_exit)
             break;
         m_main_thread_event_loop.deferred_invoke([callback = move(task->callback)] {
@@ -76,6 +78,69 @@ void RenderingThread::rendering_thread_loop()
     }
 }
 
+void RenderingThread::rasterize(Task& task)
+{
+    if (!can_rasterize_in_tiles(task)) {
+        m_retained_frame.clear();
+        m_skia_player->execute(*task.display_list, move(task.scroll_state_snapshot_by_display_list), task.painting_surface);
+        return;
+    }
+
+    // NOTE: The only damage we know how to compute is that caused by scrolling. Any other change to the page comes with
+    //       a new display list, and is rasterized in full.
+    auto& surface = *task.painting_surface;
+    Vector<Gfx::IntRect> regions;
+    if (auto damage = compute_damage_since_retained_frame(task); damage.has_value() && surface.copy_pixels_from(*m_retained_frame->painting_surface, damage->offset))
+        regions = move(damage->rects);
+    else
+        regions.append(surface.rect());
+
+    m_retained_frame = RetainedFrame { task.display_list, task.scroll_state_snapshot_by_display_list, task.painting_surface };
+
+    if (!m_tile_rasterizer)
+        m_tile_rasterizer = make<Painting::TileRasterizer>();
+    m_tile_rasterizer->rasterize(*task.display_list, task.scroll_state_snapshot_by_display_list, surface, regions);
+}
+
+bool RenderingThread::can_rasterize_in_tiles(Task const& task) const
+{
+    // GPU-backed surfaces are rasterized by the GPU already, and the Skia context may only be used from one thread.
+    if (m_display_list_player_type != DisplayListPlayerType::SkiaCPU)
+        return false;
+    return task.display_list->can_be_rasterized_in_tiles();
+}
+
+Optional<Painting::DisplayList::ScrollDamage> RenderingThread::compute_damage_since_retained_frame(Task const& task) const
+{
+    if (!m_retained_frame.has_value())
+        return {};
+    auto const& retained_frame = m_retained_frame.value();
+    if (retained_frame.display_list.ptr() != task.display_list.ptr())
+        return {};
+    // Pixels can't be shifted in place, and a resized surface needs a full repaint anyway.
+    if (retained_frame.painting_surface.ptr() == task.painting_surface.ptr())
+        return {};
+    if (retained_frame.painting_surface->size() != task.painting_surface->size())
+        return {};
+
+    // Only the top-level display list is inspected for damage, so nested ones have to be scrolled exactly as before.
+    auto const& previous_snapshots = retained_frame.scroll_state_snapshot_by_display_list;
+    auto const& snapshots = task.scroll_state_snapshot_by_display_list;
+    if (previous_snapshots.size() != snapshots.size())
+        return {};
+    for (auto const& [display_list, snapshot] : snapshots) {
+        auto previous_snapshot = previous_snapshots.get(display_list);
+        if (!previous_snapshot.has_value())
+            return {};
+        if (display_list.ptr() != task.display_list.ptr() && previous_snapshot.value() != snapshot)
+            return {};
+    }
+
+    auto previous_snapshot = previous_snapshots.get(task.display_list).value_or({});
+    auto snapshot = snapshots.get(task.display_list).value_or({});
+    return task.display_list->compute_scroll_damage(previous_snapshot, snapshot, task.painting_surface->rect());
+}
+
 void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, NonnullRefPtr<Gfx::PaintingSurface> painting_surface, Function<void()>&& callback)
 {
     Threading::MutexLocker const locker { m_rendering_task_mutex };
@@ -14,6 +14,8 @@
 #include <LibThreading/Thread.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/TileRasterizer.h>
 
 namespace Web::HTML {
 
@@ -32,6 +34,11 @@ public:
 private:
     void rendering_thread_loop();
 
+    struct Task;
+    void rasterize(Task&);
+    bool can_rasterize_in_tiles(Task const&) const;
+    Optional<Painting::DisplayList::ScrollDamage> compute_damage_since_retained_frame(Task const&) const;
+
     Core::EventLoop& m_main_thread_event_loop;
     DisplayListPlayerType m_display_list_player_type;
 
@@ -52,6 +59,18 @@ private:
     Queue<Task> m_rendering_tasks;
     Threading::Mutex m_rendering_task_mutex;
     Threading::ConditionVariable m_rendering_task_ready_wake_condition { m_rendering_task_mutex };
+
+    // Rasterizes frames on CPU-backed surfaces. Created on first use, as GPU-backed surfaces never need it.
+    OwnPtr<Painting::TileRasterizer> m_tile_rasterizer;
+
+    // The most recent frame rasterized in tiles. If the next frame replays the same display list with different
+    // scroll offsets, its pixels are shifted into the new surface and only the damaged regions are rasterized.
+    struct RetainedFrame {
+        NonnullRefPtr<Painting::DisplayList> display_list;
+        Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot_by_display_list;
+        NonnullRefPtr<Gfx::PaintingSurface> painting_surface;
+    };
+    Optional<RetainedFrame> m_retained_frame;
 };
 
 }
@@ -26,6 +26,7 @@ GC_DEFINE_ALLOCATOR(WindowProxy);
 WindowProxy::WindowProxy(JS::Realm& realm)
     : JS::Object(realm, nullptr, MayInterfereWithIndexedPropertyAccess::Yes)
 {
+    m_has_exotic_named_property_lookup = true;
 }
 
 // 7.4.1 [[GetPrototypeOf]] ( ), https://html.spec.whatwg.org/multipage/window-object.html#windowproxy-getprototypeof
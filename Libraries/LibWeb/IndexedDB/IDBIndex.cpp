@@ -225,7 +225,7 @@ WebIDL::ExceptionOr<GC::Ref<IDBRequest>> IDBIndex::get_all(Optional<JS::Value> q
 
     // 6. Let operation be an algorithm to run retrieve multiple referenced values from an index with the current Realm record, index, range, and count if given.
     auto operation = GC::Function<WebIDL::ExceptionOr<JS::Value>()>::create(realm.heap(), [&realm, index, range, count] -> WebIDL::ExceptionOr<JS::Value> {
-        return retrieve_multiple_referenced_values_from_an_index(realm, index, range, count);
+        return TRY(retrieve_multiple_referenced_values_from_an_index(realm, index, range, count));
     });
 
     // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
@@ -48,6 +48,11 @@ public:
 
     bool is_unbound() const { return m_lower_bound == nullptr && m_upper_bound == nullptr; }
     bool is_in_range(GC::Ref<Key>) const;
+
+    // AD-HOC: The two halves of "in range", which ordered lists of records use to find where a range starts and ends.
+    bool is_below_lower_bound(GC::Ref<Key>) const;
+    bool is_above_upper_bound(GC::Ref<Key>) const;
+
     GC::Ptr<Key> lower_key() const { return m_lower_bound; }
     GC::Ptr<Key> upper_key() const { return m_upper_bound; }
 
@@ -581,7 +581,7 @@ WebIDL::ExceptionOr<GC::Ref<IDBRequest>> IDBObjectStore::get_all(Optional<JS::Va
 
     // 6. Let operation be an algorithm to run retrieve multiple values from an object store with the current Realm record, store, range, and count if given.
     auto operation = GC::Function<WebIDL::ExceptionOr<JS::Value>()>::create(realm.heap(), [&realm, store, range, count] -> WebIDL::ExceptionOr<JS::Value> {
-        return retrieve_multiple_values_from_an_object_store(realm, store, range, count);
+        return TRY(retrieve_multiple_values_from_an_object_store(realm, store, range, count));
     });
 
     // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
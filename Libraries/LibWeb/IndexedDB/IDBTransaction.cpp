@@ -11,6 +11,7 @@
 #include <LibWeb/IndexedDB/IDBObjectStore.h>
 #include <LibWeb/IndexedDB/IDBTransaction.h>
 #include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/IndexedDB/Internal/PersistentStorage.h>
 
 namespace Web::IndexedDB {
 
@@ -143,6 +144,9 @@ WebIDL::ExceptionOr<GC::Ref<IDBObjectStore>> IDBTransaction::object_store(String
     if (!store)
         return WebIDL::NotFoundError::create(realm, "Object store not found in transactions scope"_utf16);
 
+    // AD-HOC: The records of a persisted object store are loaded the first time that a transaction uses it.
+    load_persisted_records(realm, *store);
+
     // 3. Return an object store handle associated with store and this.
     return IDBObjectStore::create(realm, *store, *this);
 }
@@ -33,6 +33,7 @@
 #include <LibWeb/IndexedDB/Internal/Database.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/IndexedDB/Internal/PersistentStorage.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/StorageAPI/StorageKey.h>
@@ -71,6 +72,8 @@ WebIDL::ExceptionOr<GC::Ref<IDBDatabase>> open_a_database_connection(JS::Realm&
     }));
 
     // 4. Let db be the database named name in storageKey, or null otherwise.
+    // NOTE: A persisted database is loaded into memory, unless this process already has open connections to it.
+    load_persisted_database(realm, storage_key, name);
     GC::Ptr<Database> db;
     auto maybe_db = Database::for_key_and_name(storage_key, name);
     if (maybe_db.has_value()) {
@@ -456,6 +459,7 @@ WebIDL::ExceptionOr<u64> delete_a_database(JS::Realm& realm, StorageAPI::Storage
     }));
 
     // 4. Let db be the database named name in storageKey, if one exists. Otherwise, return 0 (zero).
+    load_persisted_database(realm, storage_key, name);
     auto maybe_db = Database::for_key_and_name(storage_key, name);
     if (!maybe_db.has_value())
         return 0;
@@ -526,6 +530,8 @@ WebIDL::ExceptionOr<u64> delete_a_database(JS::Realm& realm, StorageAPI::Storage
     if (maybe_deleted.is_error())
         return WebIDL::OperationError::create(realm, "Unable to delete database"_utf16);
 
+    delete_persisted_database(realm, storage_key, name);
+
     // 12. Return version.
     return version;
 }
@@ -769,7 +775,10 @@ void commit_a_transaction(JS::Realm& realm, GC::Ref<IDBTransaction> transaction)
         if (transaction->state() != IDBTransaction::TransactionState::Committing)
             return;
 
-        // FIXME: 3. Attempt to write any outstanding changes made by transaction to the database, considering transaction’s durability hint.
+        // 3. Attempt to write any outstanding changes made by transaction to the database, considering transaction’s durability hint.
+        // FIXME: Consider the transaction's durability hint. The changes are always written out without waiting for them to be flushed.
+        persist_changes_made_by_transaction(*transaction);
+
         // FIXME: 4. If an error occurs while writing the changes to the database, then run abort a transaction with transaction and an appropriate type for the error, for example "QuotaExceededError" or "UnknownError" DOMException, and terminate these steps.
 
         // 5. Queue a database task to run these steps:
@@ -1227,6 +1236,11 @@ ErrorOr<u64> generate_a_key(GC::Ref<ObjectStore> store)
     // 1. Let generator be store’s key generator.
     auto& generator = store->key_generator();
 
+    // AD-HOC: A persisted key generator is shared with other processes, so its current number is taken from persistent
+    //         storage, where it is increased at the same time.
+    if (auto number = advance_persisted_key_generator(store, generator.current_number(), 1); number.has_value())
+        generator.set(*number);
+
     // 2. Let key be generator’s current number.
     auto key = generator.current_number();
 
@@ -1261,8 +1275,12 @@ void possibly_update_the_key_generator(GC::Ref<ObjectStore> store, GC::Ref<Key>
     auto& generator = store->key_generator();
 
     // 6. If value is greater than or equal to generator’s current number, then set generator’s current number to value + 1.
-    if (value >= generator.current_number())
-        generator.set(value + 1);
+    // NOTE: The current number of a persisted key generator is at least that of its copy in this process, so it only
+    //       has to be updated in persistent storage if the copy is updated.
+    if (value >= generator.current_number()) {
+        auto number = advance_persisted_key_generator(store, value + 1, 0);
+        generator.set(number.value_or(value + 1));
+    }
 }
 
 // https://w3c.github.io/IndexedDB/#inject-a-key-into-a-value-using-a-key-path
@@ -1502,10 +1520,12 @@ WebIDL::ExceptionOr<JS::Value> retrieve_a_value_from_an_object_store(JS::Realm&
         return JS::js_undefined();
 
     // 3. Let serialized be record’s value. If an error occurs while reading the value from the underlying storage, return a newly created "NotReadableError" DOMException.
-    auto serialized = record->value;
+    auto serialized = store->value_of(*record);
+    if (serialized.is_error())
+        return WebIDL::NotReadableError::create(realm, "Unable to read the value of the record"_utf16);
 
     // 4. Return ! StructuredDeserialize(serialized, targetRealm).
-    return MUST(HTML::structured_deserialize(realm.vm(), serialized, realm));
+    return MUST(HTML::structured_deserialize(realm.vm(), serialized.value(), realm));
 }
 
 // https://w3c.github.io/IndexedDB/#iterate-a-cursor
@@ -1523,12 +1543,12 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         VERIFY(source.has<GC::Ref<Index>>() && direction_is_next_or_prev);
 
     // 4. Let records be the list of records in source.
-    Variant<ReadonlySpan<Record>, ReadonlySpan<IndexRecord>> records = source.visit(
-        [](GC::Ref<ObjectStore> object_store) -> Variant<ReadonlySpan<Record>, ReadonlySpan<IndexRecord>> {
-            return object_store->records();
+    Variant<RecordList*, IndexRecordList*> records = source.visit(
+        [](GC::Ref<ObjectStore> object_store) -> Variant<RecordList*, IndexRecordList*> {
+            return &object_store->records();
         },
-        [](GC::Ref<Index> index) -> Variant<ReadonlySpan<Record>, ReadonlySpan<IndexRecord>> {
-            return index->records();
+        [](GC::Ref<Index> index) -> Variant<RecordList*, IndexRecordList*> {
+            return &index->records();
         });
 
     // 5. Let range be cursor’s range.
@@ -1735,6 +1755,35 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         return is_in_range;
     };
 
+    // NOTE: Records satisfying any of the requirements above have a key in range, and not before key or position in
+    //       the direction of iteration. As records are sorted by key, we only check the requirements from where such
+    //       records start, up to where range ends.
+    auto first_matching_record = [&](auto& content, auto const& requirements) -> Variant<Empty, Record, IndexRecord> {
+        auto it = content.lower_bound_by_key([&](GC::Ref<Key> record_key) {
+            return (key && Key::less_than(record_key, *key))
+                || (position && Key::less_than(record_key, *position))
+                || range->is_below_lower_bound(record_key);
+        });
+        for (; !it.is_end() && !range->is_above_upper_bound(it->key); ++it) {
+            if (requirements(*it))
+                return *it;
+        }
+        return Empty {};
+    };
+
+    auto last_matching_record = [&](auto& content, auto const& requirements) -> Variant<Empty, Record, IndexRecord> {
+        auto it = content.lower_bound_by_key([&](GC::Ref<Key> record_key) {
+            return !(key && Key::greater_than(record_key, *key))
+                && !(position && Key::greater_than(record_key, *position))
+                && !range->is_above_upper_bound(record_key);
+        });
+        for (--it; !it.is_end() && !range->is_below_lower_bound(it->key); --it) {
+            if (requirements(*it))
+                return *it;
+        }
+        return Empty {};
+    };
+
     // 9. While count is greater than 0:
     Variant<Empty, Record, IndexRecord> found_record;
     while (count > 0) {
@@ -1742,46 +1791,30 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         switch (direction) {
         case Bindings::IDBCursorDirection::Next: {
             // Let found record be the first record in records which satisfy all of the following requirements:
-            found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.first_matching(next_requirements);
-                if (value.has_value())
-                    return *value;
-
-                return Empty {};
+            found_record = records.visit([&](auto* content) {
+                return first_matching_record(*content, next_requirements);
             });
             break;
         }
         case Bindings::IDBCursorDirection::Nextunique: {
             // Let found record be the first record in records which satisfy all of the following requirements:
-            found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.first_matching(next_unique_requirements);
-                if (value.has_value())
-                    return *value;
-
-                return Empty {};
+            found_record = records.visit([&](auto* content) {
+                return first_matching_record(*content, next_unique_requirements);
             });
             break;
         }
         case Bindings::IDBCursorDirection::Prev: {
             // Let found record be the last record in records which satisfy all of the following requirements:
-            found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.last_matching(prev_requirements);
-                if (value.has_value())
-                    return *value;
-
-                return Empty {};
+            found_record = records.visit([&](auto* content) {
+                return last_matching_record(*content, prev_requirements);
             });
             break;
         }
 
         case Bindings::IDBCursorDirection::Prevunique: {
             // Let temp record be the last record in records which satisfy all of the following requirements:
-            auto temp_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.last_matching(prev_unique_requirements);
-                if (value.has_value())
-                    return *value;
-
-                return Empty {};
+            auto temp_record = records.visit([&](auto* content) {
+                return last_matching_record(*content, prev_unique_requirements);
             });
 
             // If temp record is defined, let found record be the first record in records whose key is equal to temp record’s key.
@@ -1790,14 +1823,11 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
                     [](Empty) -> GC::Ref<Key> { VERIFY_NOT_REACHED(); },
                     [](auto const& record) { return record.key; });
 
-                found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                    auto value = content.first_matching([&](auto const& content_record) {
-                        return Key::equals(content_record.key, temp_record_key);
+                found_record = records.visit([&](auto* content) -> Variant<Empty, Record, IndexRecord> {
+                    auto it = content->lower_bound_by_key([&](GC::Ref<Key> record_key) {
+                        return Key::less_than(record_key, temp_record_key);
                     });
-                    if (value.has_value())
-                        return *value;
-
-                    return Empty {};
+                    return *it;
                 });
             }
 
@@ -1852,15 +1882,20 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
 
         // 1. Let serialized be found record’s value if source is an object store, or found record’s referenced value otherwise.
         auto serialized = source.visit(
-            [&](GC::Ref<ObjectStore>) {
-                return found_record.get<Record>().value;
+            [&](GC::Ref<ObjectStore> object_store) {
+                return object_store->value_of(found_record.get<Record>());
             },
             [&](GC::Ref<Index> index) {
                 return index->referenced_value(found_record.get<IndexRecord>());
             });
 
         // 2. Set cursor’s value to ! StructuredDeserialize(serialized, targetRealm)
-        cursor->set_value(MUST(HTML::structured_deserialize(realm.vm(), serialized, realm)));
+        // AD-HOC: Reading the value from the underlying storage may fail, which the spec doesn't account for here. The
+        //         cursor's value is then undefined.
+        if (serialized.is_error())
+            cursor->set_value(JS::js_undefined());
+        else
+            cursor->set_value(MUST(HTML::structured_deserialize(realm.vm(), serialized.value(), realm)));
     }
 
     // 14. Set cursor’s got value flag to true.
@@ -1900,7 +1935,7 @@ JS::Value retrieve_a_key_from_an_object_store(JS::Realm& realm, GC::Ref<ObjectSt
 }
 
 // https://w3c.github.io/IndexedDB/#retrieve-multiple-values-from-an-object-store
-GC::Ref<JS::Array> retrieve_multiple_values_from_an_object_store(JS::Realm& realm, GC::Ref<ObjectStore> store, GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
+WebIDL::ExceptionOr<GC::Ref<JS::Array>> retrieve_multiple_values_from_an_object_store(JS::Realm& realm, GC::Ref<ObjectStore> store, GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     // 1. If count is not given or is 0 (zero), let count be infinity.
     if (count.has_value() && *count == 0)
@@ -1909,15 +1944,18 @@ GC::Ref<JS::Array> retrieve_multiple_values_from_an_object_store(JS::Realm& real
     // 2. Let records be a list containing the first count records in store’s list of records whose key is in range.
     auto records = store->first_n_in_range(range, count);
 
+    // NOTE: The values that are not in memory are all read from the underlying storage at once.
+    auto serialized_values = store->values_of(records);
+    if (serialized_values.is_error())
+        return WebIDL::NotReadableError::create(realm, "Unable to read the values of the records"_utf16);
+
     // 3. Let list be an empty list.
     auto list = MUST(JS::Array::create(realm, records.size()));
 
     // 4. For each record of records:
     for (u32 i = 0; i < records.size(); ++i) {
-        auto& record = records[i];
-
         // 1. Let serialized be record’s value. If an error occurs while reading the value from the underlying storage, return a newly created "NotReadableError" DOMException.
-        auto serialized = record.value;
+        auto const& serialized = serialized_values.value()[i];
 
         // 2. Let entry be ! StructuredDeserialize(serialized, targetRealm).
         auto entry = MUST(HTML::structured_deserialize(realm.vm(), serialized, realm));
@@ -1959,7 +1997,7 @@ GC::Ref<JS::Array> retrieve_multiple_keys_from_an_object_store(JS::Realm& realm,
 }
 
 // https://w3c.github.io/IndexedDB/#retrieve-a-referenced-value-from-an-index
-JS::Value retrieve_a_referenced_value_from_an_index(JS::Realm& realm, GC::Ref<Index> index, GC::Ref<IDBKeyRange> range)
+WebIDL::ExceptionOr<JS::Value> retrieve_a_referenced_value_from_an_index(JS::Realm& realm, GC::Ref<Index> index, GC::Ref<IDBKeyRange> range)
 {
     // 1. Let record be the first record in index’s list of records whose key is in range, if any.
     auto record = index->first_in_range(range);
@@ -1969,10 +2007,14 @@ JS::Value retrieve_a_referenced_value_from_an_index(JS::Realm& realm, GC::Ref<In
         return JS::js_undefined();
 
     // 3. Let serialized be record’s referenced value.
+    // AD-HOC: Reading the referenced value from the underlying storage may fail, in which case a "NotReadableError"
+    //         DOMException is returned, like when retrieving a value from an object store.
     auto serialized = index->referenced_value(*record);
+    if (serialized.is_error())
+        return WebIDL::NotReadableError::create(realm, "Unable to read the referenced value of the record"_utf16);
 
     // 4. Return ! StructuredDeserialize(serialized, targetRealm).
-    return MUST(HTML::structured_deserialize(realm.vm(), serialized, realm));
+    return MUST(HTML::structured_deserialize(realm.vm(), serialized.value(), realm));
 }
 
 // https://w3c.github.io/IndexedDB/#retrieve-a-value-from-an-index
@@ -1990,7 +2032,7 @@ JS::Value retrieve_a_value_from_an_index(JS::Realm& realm, GC::Ref<Index> index,
 }
 
 // https://w3c.github.io/IndexedDB/#retrieve-multiple-referenced-values-from-an-index
-GC::Ref<JS::Array> retrieve_multiple_referenced_values_from_an_index(JS::Realm& realm, GC::Ref<Index> index, GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
+WebIDL::ExceptionOr<GC::Ref<JS::Array>> retrieve_multiple_referenced_values_from_an_index(JS::Realm& realm, GC::Ref<Index> index, GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     // 1. If count is not given or is 0 (zero), let count be infinity.
     if (count.has_value() && *count == 0)
@@ -1999,15 +2041,19 @@ GC::Ref<JS::Array> retrieve_multiple_referenced_values_from_an_index(JS::Realm&
     // 2. Let records be a list containing the first count records in index’s list of records whose key is in range.
     auto records = index->first_n_in_range(range, count);
 
+    // AD-HOC: The referenced values that are not in memory are all read from the underlying storage at once. If that
+    //         fails, a "NotReadableError" DOMException is returned, like when retrieving values from an object store.
+    auto serialized_values = index->referenced_values(records);
+    if (serialized_values.is_error())
+        return WebIDL::NotReadableError::create(realm, "Unable to read the referenced values of the records"_utf16);
+
     // 3. Let list be an empty list.
     auto list = MUST(JS::Array::create(realm, records.size()));
 
     // 4. For each record of records:
     for (u32 i = 0; i < records.size(); ++i) {
-        auto& record = records[i];
-
         // 1. Let serialized be record’s referenced value.
-        auto serialized = index->referenced_value(record);
+        auto const& serialized = serialized_values.value()[i];
 
         // 2. Let entry be ! StructuredDeserialize(serialized, targetRealm).
         auto entry = MUST(HTML::structured_deserialize(realm.vm(), serialized, realm));
@@ -27,9 +27,9 @@ GC_DEFINE_ALLOCATOR(Database);
 
 Database::~Database() = default;
 
-GC::Ref<Database> Database::create(JS::Realm& realm, String const& name)
+GC::Ref<Database> Database::create(JS::Realm& realm, StorageAPI::StorageKey const& storage_key, String const& name)
 {
-    return realm.create<Database>(realm, name);
+    return realm.create<Database>(realm, storage_key, name);
 }
 
 void Database::visit_edges(Visitor& visitor)
@@ -40,6 +40,12 @@ void Database::visit_edges(Visitor& visitor)
     visitor.visit(m_object_stores);
 }
 
+void Database::remove_object_store(GC::Ref<ObjectStore> object_store)
+{
+    m_object_stores.remove_first_matching([&](auto& entry) { return entry == object_store; });
+    m_ids_of_removed_object_stores.append(object_store->id());
+}
+
 GC::Ptr<ObjectStore> Database::object_store_with_name(String const& name) const
 {
     for (auto const& object_store : m_object_stores) {
@@ -70,7 +76,7 @@ RequestList& ConnectionQueueHandler::for_key_and_name(StorageAPI::StorageKey& ke
         });
 }
 
-Optional<GC::Root<Database> const&> Database::for_key_and_name(StorageAPI::StorageKey& key, String& name)
+Optional<GC::Root<Database> const&> Database::for_key_and_name(StorageAPI::StorageKey const& key, String const& name)
 {
     return m_databases.ensure(key, [] {
                           return HashMap<String, GC::Root<Database>>();
@@ -78,13 +84,13 @@ Optional<GC::Root<Database> const&> Database::for_key_and_name(StorageAPI::Stora
         .get(name);
 }
 
-ErrorOr<GC::Root<Database>> Database::create_for_key_and_name(JS::Realm& realm, StorageAPI::StorageKey& key, String& name)
+ErrorOr<GC::Root<Database>> Database::create_for_key_and_name(JS::Realm& realm, StorageAPI::StorageKey const& key, String const& name)
 {
     auto database_mapping = TRY(m_databases.try_ensure(key, [] {
         return HashMap<String, GC::Root<Database>>();
     }));
 
-    auto value = Database::create(realm, name);
+    auto value = Database::create(realm, key, name);
 
     database_mapping.set(name, value);
     m_databases.set(key, database_mapping);
@@ -92,7 +98,7 @@ ErrorOr<GC::Root<Database>> Database::create_for_key_and_name(JS::Realm& realm,
     return value;
 }
 
-ErrorOr<void> Database::delete_for_key_and_name(StorageAPI::StorageKey& key, String& name)
+ErrorOr<void> Database::delete_for_key_and_name(StorageAPI::StorageKey const& key, String const& name)
 {
     // FIXME: Is a missing entry a failure?
     auto maybe_database_mapping = m_databases.get(key);
@@ -24,6 +24,7 @@ public:
     void set_version(u64 version) { m_version = version; }
     u64 version() const { return m_version; }
     String name() const { return m_name; }
+    StorageAPI::StorageKey const& storage_key() const { return m_storage_key; }
 
     void set_upgrade_transaction(GC::Ptr<IDBTransaction> transaction) { m_upgrade_transaction = transaction; }
     [[nodiscard]] GC::Ptr<IDBTransaction> upgrade_transaction() { return m_upgrade_transaction; }
@@ -43,26 +44,29 @@ public:
     ReadonlySpan<GC::Ref<ObjectStore>> object_stores() { return m_object_stores; }
     GC::Ptr<ObjectStore> object_store_with_name(String const& name) const;
     void add_object_store(GC::Ref<ObjectStore> object_store) { m_object_stores.append(object_store); }
-    void remove_object_store(GC::Ref<ObjectStore> object_store)
-    {
-        m_object_stores.remove_first_matching([&](auto& entry) { return entry == object_store; });
-    }
+    void remove_object_store(GC::Ref<ObjectStore> object_store);
+
+    u64 allocate_object_store_id() { return m_next_object_store_id++; }
+    u64 next_object_store_id() const { return m_next_object_store_id; }
+    void set_next_object_store_id(u64 id) { m_next_object_store_id = id; }
+    Vector<u64> take_ids_of_removed_object_stores() { return exchange(m_ids_of_removed_object_stores, {}); }
 
     [[nodiscard]] static Vector<GC::Root<Database>> for_key(StorageAPI::StorageKey const&);
-    [[nodiscard]] static Optional<GC::Root<Database> const&> for_key_and_name(StorageAPI::StorageKey&, String&);
-    [[nodiscard]] static ErrorOr<GC::Root<Database>> create_for_key_and_name(JS::Realm&, StorageAPI::StorageKey&, String&);
-    [[nodiscard]] static ErrorOr<void> delete_for_key_and_name(StorageAPI::StorageKey&, String&);
+    [[nodiscard]] static Optional<GC::Root<Database> const&> for_key_and_name(StorageAPI::StorageKey const&, String const&);
+    [[nodiscard]] static ErrorOr<GC::Root<Database>> create_for_key_and_name(JS::Realm&, StorageAPI::StorageKey const&, String const&);
+    [[nodiscard]] static ErrorOr<void> delete_for_key_and_name(StorageAPI::StorageKey const&, String const&);
 
     static void for_each_database(AK::Function<void(GC::Root<Database> const&)> const& visitor);
 
-    [[nodiscard]] static GC::Ref<Database> create(JS::Realm&, String const&);
+    [[nodiscard]] static GC::Ref<Database> create(JS::Realm&, StorageAPI::StorageKey const&, String const&);
     virtual ~Database();
 
 protected:
     explicit Database(IDBDatabase& database);
 
-    explicit Database(JS::Realm& realm, String name)
+    explicit Database(JS::Realm& realm, StorageAPI::StorageKey storage_key, String name)
         : PlatformObject(realm)
+        , m_storage_key(move(storage_key))
         , m_name(move(name))
     {
     }
@@ -72,6 +76,9 @@ protected:
 private:
     Vector<GC::Ref<IDBDatabase>> m_associated_connections;
 
+    // AD-HOC: A database needs to know its storage key, so that it can be persisted.
+    StorageAPI::StorageKey m_storage_key;
+
     // A database has a name which identifies it within a specific storage key.
     String m_name;
 
@@ -83,6 +90,11 @@ private:
 
     // A database has zero or more object stores which hold the data stored in the database.
     Vector<GC::Ref<ObjectStore>> m_object_stores;
+
+    // AD-HOC: Object stores are persisted under an id that stays the same when they are renamed. The ids of the object
+    //         stores that were removed are kept until their records have been removed from persistent storage.
+    u64 m_next_object_store_id { 0 };
+    Vector<u64> m_ids_of_removed_object_stores;
 };
 
 }
@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -21,6 +20,7 @@ GC::Ref<Index> Index::create(JS::Realm& realm, GC::Ref<ObjectStore> store, Strin
 
 Index::Index(GC::Ref<ObjectStore> store, String const& name, KeyPath const& key_path, bool unique, bool multi_entry)
     : m_object_store(store)
+    , m_id(store->allocate_index_id())
     , m_name(name)
     , m_unique(unique)
     , m_multi_entry(multi_entry)
@@ -34,10 +34,10 @@ void Index::visit_edges(Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_object_store);
 
-    for (auto& record : m_records) {
+    m_records.for_each_sort_key([&](IndexRecord const& record) {
         visitor.visit(record.key);
         visitor.visit(record.value);
-    }
+    });
 }
 
 void Index::set_name(String name)
@@ -51,25 +51,29 @@ void Index::set_name(String name)
 
 bool Index::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
+    auto it = m_records.lower_bound([&](IndexRecord const& record) {
+        return Key::less_than(record.key, key);
     });
 
-    return index != m_records.end();
+    return !it.is_end() && Key::equals(it->key, key);
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
-HTML::SerializationRecord Index::referenced_value(IndexRecord const& index_record) const
+ErrorOr<HTML::SerializationRecord> Index::referenced_value(IndexRecord const& index_record) const
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return m_object_store
-        ->records()
-        .first_matching([&](auto const& store_record) {
-            return Key::equals(store_record.key, index_record.value);
-        })
-        .value()
-        .value;
+    return m_object_store->value_of(m_object_store->record_with_key(index_record.value).value());
+}
+
+ErrorOr<Vector<HTML::SerializationRecord>> Index::referenced_values(ReadonlySpan<IndexRecord> index_records) const
+{
+    Vector<Record> records;
+    TRY(records.try_ensure_capacity(index_records.size()));
+    for (auto const& index_record : index_records)
+        records.unchecked_append(m_object_store->record_with_key(index_record.value).value());
+
+    return m_object_store->values_of(records);
 }
 
 void Index::clear_records()
@@ -79,21 +83,22 @@ void Index::clear_records()
 
 Optional<IndexRecord&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto it = m_records.first_in_range(range);
+    if (it.is_end())
+        return {};
+    return *it;
 }
 
 GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    m_records.for_each_in_range(range, [&](auto const& record) {
+        records.append(record);
 
         if (count.has_value() && records.size() >= *count)
-            break;
-    }
+            return IterationDecision::Break;
+        return IterationDecision::Continue;
+    });
 
     return records;
 }
@@ -101,25 +106,17 @@ GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange>
 u64 Index::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
     u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
+    m_records.for_each_in_range(range, [&](auto const&) {
+        ++count;
+        return IterationDecision::Continue;
+    });
     return count;
 }
 
 void Index::store_a_record(IndexRecord const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in index’s list of records such that the list is sorted primarily on the records keys, and secondarily on the records values, in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        auto key_comparison = Key::compare_two_keys(a.key, b.key);
-        if (key_comparison != 0)
-            return key_comparison < 0;
-
-        return Key::compare_two_keys(a.value, b.value) < 0;
-    });
+    m_records.insert(record);
 }
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
@@ -11,6 +11,7 @@
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/RecordTree.h>
 
 namespace Web::IndexedDB {
 
@@ -22,6 +23,21 @@ struct IndexRecord {
     GC::Ref<Key> value;
 };
 
+struct IndexRecordTraits {
+    using SortKey = IndexRecord;
+    static SortKey sort_key(IndexRecord const& record) { return record; }
+    static GC::Ref<Key> key_of(IndexRecord const& record) { return record.key; }
+    static int compare(IndexRecord const& a, IndexRecord const& b)
+    {
+        // An index's list of records is sorted primarily on the records keys, and secondarily on the records values.
+        if (auto key_comparison = Key::compare_two_keys(a.key, b.key); key_comparison != 0)
+            return key_comparison;
+        return Key::compare_two_keys(a.value, b.value);
+    }
+};
+
+using IndexRecordList = RecordTree<IndexRecord, IndexRecordTraits>;
+
 // https://w3c.github.io/IndexedDB/#index-construct
 class Index : public JS::Cell {
     GC_CELL(Index, JS::Cell);
@@ -31,12 +47,13 @@ public:
     [[nodiscard]] static GC::Ref<Index> create(JS::Realm&, GC::Ref<ObjectStore>, String const&, KeyPath const&, bool, bool);
     virtual ~Index();
 
+    [[nodiscard]] u64 id() const { return m_id; }
     void set_name(String name);
     [[nodiscard]] String name() const { return m_name; }
     [[nodiscard]] bool unique() const { return m_unique; }
     [[nodiscard]] bool multi_entry() const { return m_multi_entry; }
     [[nodiscard]] GC::Ref<ObjectStore> object_store() const { return m_object_store; }
-    [[nodiscard]] AK::ReadonlySpan<IndexRecord> records() const { return m_records; }
+    [[nodiscard]] IndexRecordList& records() { return m_records; }
     [[nodiscard]] KeyPath const& key_path() const { return m_key_path; }
 
     [[nodiscard]] bool has_record_with_key(GC::Ref<Key> key);
@@ -47,7 +64,8 @@ public:
     void store_a_record(IndexRecord const& record);
     void remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range);
 
-    HTML::SerializationRecord referenced_value(IndexRecord const& index_record) const;
+    ErrorOr<HTML::SerializationRecord> referenced_value(IndexRecord const& index_record) const;
+    ErrorOr<Vector<HTML::SerializationRecord>> referenced_values(ReadonlySpan<IndexRecord> index_records) const;
 
 protected:
     virtual void visit_edges(Visitor&) override;
@@ -58,8 +76,11 @@ private:
     // An index [...] has a referenced object store.
     GC::Ref<ObjectStore> m_object_store;
 
+    // AD-HOC: The id under which the index's keys are persisted, which is unique within its object store.
+    u64 m_id { 0 };
+
     // The index has a list of records which hold the data stored in the index.
-    Vector<IndexRecord> m_records;
+    IndexRecordList m_records;
 
     // An index has a name, which is a name. At any one time, the name is unique within index’s referenced object store.
     String m_name;
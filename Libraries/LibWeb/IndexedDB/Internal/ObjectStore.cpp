@@ -4,9 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/PersistentStorage.h>
 
 namespace Web::IndexedDB {
 
@@ -21,6 +21,7 @@ GC::Ref<ObjectStore> ObjectStore::create(JS::Realm& realm, GC::Ref<Database> dat
 
 ObjectStore::ObjectStore(GC::Ref<Database> database, String name, bool auto_increment, Optional<KeyPath> const& key_path)
     : m_database(database)
+    , m_id(database->allocate_object_store_id())
     , m_name(move(name))
     , m_key_path(key_path)
 {
@@ -36,71 +37,124 @@ void ObjectStore::visit_edges(Visitor& visitor)
     visitor.visit(m_database);
     visitor.visit(m_indexes);
 
-    for (auto& record : m_records) {
-        visitor.visit(record.key);
-    }
+    visitor.visit(m_unpersisted_keys);
+
+    m_records.for_each_sort_key([&](GC::Ref<Key> key) {
+        visitor.visit(key);
+    });
 }
 
 void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    m_records.remove_all_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
+    Vector<GC::Ref<Key>> keys_in_range;
+    m_records.for_each_in_range(range, [&](auto const& record) {
+        keys_in_range.append(record.key);
+        return IterationDecision::Continue;
     });
+
+    for (auto key : keys_in_range)
+        m_records.remove(key);
+
+    m_unpersisted_keys.extend(move(keys_in_range));
 }
 
 bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(key, record.key);
-    });
+    return !m_records.find(key).is_end();
+}
 
-    return index != m_records.end();
+Optional<Record&> ObjectStore::record_with_key(GC::Ref<Key> key)
+{
+    auto it = m_records.find(key);
+    if (it.is_end())
+        return {};
+    return *it;
 }
 
 void ObjectStore::store_a_record(Record const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        return Key::compare_two_keys(a.key, b.key) < 0;
-    });
+    m_records.insert(record);
+    m_unpersisted_keys.append(record.key);
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
     u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
+    m_records.for_each_in_range(range, [&](auto const&) {
+        ++count;
+        return IterationDecision::Continue;
+    });
     return count;
 }
 
 Optional<Record&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto it = m_records.first_in_range(range);
+    if (it.is_end())
+        return {};
+    return *it;
 }
 
 void ObjectStore::clear_records()
 {
     m_records.clear();
+
+    // NOTE: None of the records stored before clearing are left, so there is no need to remember their keys.
+    m_unpersisted_keys.clear();
+    m_was_cleared_since_persisted = true;
+}
+
+void ObjectStore::did_persist()
+{
+    m_unpersisted_keys.clear();
+    m_was_cleared_since_persisted = false;
 }
 
 GC::ConservativeVector<Record> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<Record> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    m_records.for_each_in_range(range, [&](auto const& record) {
+        records.append(record);
 
         if (count.has_value() && records.size() >= *count)
-            break;
-    }
+            return IterationDecision::Break;
+        return IterationDecision::Continue;
+    });
 
     return records;
 }
 
+ErrorOr<HTML::SerializationRecord> ObjectStore::value_of(Record const& record)
+{
+    return TRY(values_of({ &record, 1 })).take_first();
+}
+
+// NOTE: The values that have to be read from persistent storage are read with a single request.
+ErrorOr<Vector<HTML::SerializationRecord>> ObjectStore::values_of(ReadonlySpan<Record> records)
+{
+    Vector<GC::Ref<Key>> unloaded_keys;
+    for (auto const& record : records) {
+        if (!record.value_is_loaded)
+            unloaded_keys.append(record.key);
+    }
+
+    Vector<HTML::SerializationRecord> loaded_values;
+    if (!unloaded_keys.is_empty())
+        loaded_values = TRY(load_persisted_values(*this, unloaded_keys));
+
+    Vector<HTML::SerializationRecord> values;
+    TRY(values.try_ensure_capacity(records.size()));
+
+    size_t loaded_value_index = 0;
+    for (auto const& record : records) {
+        if (record.value_is_loaded)
+            values.unchecked_append(record.value);
+        else
+            values.unchecked_append(move(loaded_values[loaded_value_index++]));
+    }
+
+    return values;
+}
+
 }
@@ -18,6 +18,7 @@
 #include <LibWeb/IndexedDB/Internal/Database.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/KeyGenerator.h>
+#include <LibWeb/IndexedDB/Internal/RecordTree.h>
 
 namespace Web::IndexedDB {
 
@@ -27,8 +28,21 @@ using KeyPath = Variant<String, Vector<String>>;
 struct Record {
     GC::Ref<Key> key;
     HTML::SerializationRecord value;
+
+    // AD-HOC: Whether value holds the record's value. The values of persisted records are only read from persistent
+    //         storage when they are needed, so that they don't all have to be kept in memory.
+    bool value_is_loaded { true };
+};
+
+struct RecordTraits {
+    using SortKey = GC::Ref<Key>;
+    static SortKey sort_key(Record const& record) { return record.key; }
+    static GC::Ref<Key> key_of(SortKey key) { return key; }
+    static int compare(SortKey a, SortKey b) { return Key::compare_two_keys(a, b); }
 };
 
+using RecordList = RecordTree<Record, RecordTraits>;
+
 // https://w3c.github.io/IndexedDB/#object-store-construct
 class ObjectStore : public JS::Cell {
     GC_CELL(ObjectStore, JS::Cell);
@@ -38,6 +52,7 @@ public:
     [[nodiscard]] static GC::Ref<ObjectStore> create(JS::Realm&, GC::Ref<Database>, String, bool, Optional<KeyPath> const&);
     virtual ~ObjectStore();
 
+    u64 id() const { return m_id; }
     String name() const { return m_name; }
     void set_name(String name) { m_name = move(name); }
     Optional<KeyPath> key_path() const { return m_key_path; }
@@ -48,16 +63,34 @@ public:
     AK::HashMap<String, GC::Ref<Index>>& index_set() { return m_indexes; }
 
     GC::Ref<Database> database() const { return m_database; }
-    ReadonlySpan<Record> records() const { return m_records; }
+    RecordList& records() { return m_records; }
 
     void remove_records_in_range(GC::Ref<IDBKeyRange> range);
     bool has_record_with_key(GC::Ref<Key> key);
+    Optional<Record&> record_with_key(GC::Ref<Key> key);
     void store_a_record(Record const& record);
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
     Optional<Record&> first_in_range(GC::Ref<IDBKeyRange> range);
     void clear_records();
     GC::ConservativeVector<Record> first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count);
 
+    ErrorOr<HTML::SerializationRecord> value_of(Record const&);
+    ErrorOr<Vector<HTML::SerializationRecord>> values_of(ReadonlySpan<Record>);
+
+    u64 allocate_index_id() { return m_next_index_id++; }
+    u64 next_index_id() const { return m_next_index_id; }
+    void set_next_index_id(u64 next_index_id) { m_next_index_id = next_index_id; }
+
+    ReadonlySpan<GC::Ref<Key>> unpersisted_keys() const { return m_unpersisted_keys; }
+    bool was_cleared_since_persisted() const { return m_was_cleared_since_persisted; }
+    void did_persist();
+
+    bool records_need_loading() const { return m_records_need_loading; }
+    void set_records_need_loading(bool records_need_loading) { m_records_need_loading = records_need_loading; }
+
+    bool key_generator_is_persisted() const { return m_key_generator_is_persisted; }
+    void set_key_generator_is_persisted(bool key_generator_is_persisted) { m_key_generator_is_persisted = key_generator_is_persisted; }
+
 protected:
     virtual void visit_edges(Visitor&) override;
 
@@ -67,9 +100,15 @@ private:
     // AD-HOC: An ObjectStore needs to know what Database it belongs to...
     GC::Ref<Database> m_database;
 
+    // AD-HOC: The id under which the object store's records are persisted, which is unique within its database.
+    u64 m_id { 0 };
+
     // AD-HOC: An Index has referenced ObjectStores, we also need the reverse mapping
     AK::HashMap<String, GC::Ref<Index>> m_indexes;
 
+    // AD-HOC: The id that is given to the next index created in the object store.
+    u64 m_next_index_id { 0 };
+
     // An object store has a name, which is a name. At any one time, the name is unique within the database to which it belongs.
     String m_name;
 
@@ -80,7 +119,21 @@ private:
     Optional<KeyGenerator> m_key_generator;
 
     // An object store has a list of records
-    Vector<Record> m_records;
+    // NOTE: The list is kept sorted by key in a B+-tree, so that records can be looked up, stored and removed without
+    //       going through the whole list.
+    RecordList m_records;
+
+    // AD-HOC: The keys of the records that were stored or removed since the object store was last persisted, so that
+    //         committing a transaction only has to write out the records it has changed.
+    Vector<GC::Ref<Key>> m_unpersisted_keys;
+    bool m_was_cleared_since_persisted { false };
+
+    // AD-HOC: Whether the records have yet to be (re)loaded from persistent storage.
+    bool m_records_need_loading { false };
+
+    // AD-HOC: Whether the key generator is kept in persistent storage, where its current number is the one that counts.
+    //         The current number of m_key_generator is then only the lowest number that it may have.
+    bool m_key_generator_is_persisted { false };
 };
 
 }
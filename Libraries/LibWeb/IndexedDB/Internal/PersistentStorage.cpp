@@ -0,0 +1,623 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/Base64.h>
+#include <AK/BitCast.h>
+#include <AK/ByteBuffer.h>
+#include <AK/Endian.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/ScopeGuard.h>
+#include <LibWeb/Bindings/PrincipalHostDefined.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/IndexedDB/Internal/Index.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/PersistentStorage.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/StorageAPI/StorageEndpoint.h>
+
+namespace Web::IndexedDB {
+
+static PageClient& page_client_for(JS::Realm& realm)
+{
+    return Bindings::principal_host_defined_page(HTML::principal_realm(realm)).client();
+}
+
+// NOTE: Databases of opaque origins can never be opened again once their origin is gone, and all opaque origins
+//       serialize to the same string, so there is nothing to be gained from persisting them.
+static bool can_be_persisted(StorageAPI::StorageKey const& storage_key)
+{
+    return !storage_key.origin.is_opaque();
+}
+
+// NOTE: Names are prefixed with their length, so that no name can be mistaken for the prefix of another.
+static String length_prefixed(String const& string)
+{
+    return MUST(String::formatted("{}:{}", string.bytes().size(), string));
+}
+
+static String database_prefix(String const& database_name)
+{
+    return length_prefixed(database_name);
+}
+
+static String metadata_item_key(String const& database_name)
+{
+    return MUST(String::formatted("{}D", database_prefix(database_name)));
+}
+
+static String records_prefix(String const& database_name)
+{
+    return MUST(String::formatted("{}R", database_prefix(database_name)));
+}
+
+static String object_store_records_prefix(String const& database_name, u64 object_store_id)
+{
+    return MUST(String::formatted("{}{}:", records_prefix(database_name), object_store_id));
+}
+
+static String object_store_index_keys_prefix(String const& database_name, u64 object_store_id)
+{
+    return MUST(String::formatted("{}I{}:", database_prefix(database_name), object_store_id));
+}
+
+static String key_generator_item_key(String const& database_name, u64 object_store_id)
+{
+    return MUST(String::formatted("{}G{}", database_prefix(database_name), object_store_id));
+}
+
+template<typename T>
+static void append_value(ByteBuffer& buffer, T value)
+{
+    LittleEndian<T> little_endian_value = value;
+    buffer.append(&little_endian_value, sizeof(little_endian_value));
+}
+
+template<typename T>
+static ErrorOr<T> read_value(ReadonlyBytes& bytes)
+{
+    if (bytes.size() < sizeof(T))
+        return Error::from_string_literal("Unexpected end of encoded key");
+
+    LittleEndian<T> little_endian_value;
+    __builtin_memcpy(&little_endian_value, bytes.data(), sizeof(little_endian_value));
+    bytes = bytes.slice(sizeof(T));
+    return static_cast<T>(little_endian_value);
+}
+
+static void encode_key(ByteBuffer& buffer, GC::Ref<Key> key)
+{
+    buffer.append(static_cast<u8>(key->type()));
+
+    switch (key->type()) {
+    case Key::KeyType::Number:
+    case Key::KeyType::Date:
+        append_value(buffer, bit_cast<u64>(key->value_as_double()));
+        break;
+    case Key::KeyType::String: {
+        auto string = key->value_as_string();
+        append_value(buffer, static_cast<u32>(string.bytes().size()));
+        buffer.append(string.bytes());
+        break;
+    }
+    case Key::KeyType::Binary: {
+        auto bytes = key->value_as_byte_buffer();
+        append_value(buffer, static_cast<u32>(bytes.size()));
+        buffer.append(bytes.bytes());
+        break;
+    }
+    case Key::KeyType::Array: {
+        auto subkeys = key->subkeys();
+        append_value(buffer, static_cast<u32>(subkeys.size()));
+        for (auto const& subkey : subkeys)
+            encode_key(buffer, *subkey);
+        break;
+    }
+    case Key::KeyType::Invalid:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+static ErrorOr<GC::Ref<Key>> decode_key(JS::Realm& realm, ReadonlyBytes& bytes)
+{
+    auto type = TRY(read_value<u8>(bytes));
+
+    auto read_bytes = [&]() -> ErrorOr<ReadonlyBytes> {
+        auto size = TRY(read_value<u32>(bytes));
+        if (bytes.size() < size)
+            return Error::from_string_literal("Unexpected end of encoded key");
+
+        auto result = bytes.slice(0, size);
+        bytes = bytes.slice(size);
+        return result;
+    };
+
+    switch (type) {
+    case Key::KeyType::Number:
+        return Key::create_number(realm, bit_cast<double>(TRY(read_value<u64>(bytes))));
+    case Key::KeyType::Date:
+        return Key::create_date(realm, bit_cast<double>(TRY(read_value<u64>(bytes))));
+    case Key::KeyType::String:
+        return Key::create_string(realm, TRY(String::from_utf8(StringView { TRY(read_bytes()) })));
+    case Key::KeyType::Binary:
+        return Key::create_binary(realm, TRY(ByteBuffer::copy(TRY(read_bytes()))));
+    case Key::KeyType::Array: {
+        auto count = TRY(read_value<u32>(bytes));
+
+        Vector<GC::Root<Key>> subkeys;
+        for (u32 i = 0; i < count; ++i)
+            subkeys.append(TRY(decode_key(realm, bytes)));
+
+        return Key::create_array(realm, subkeys);
+    }
+    default:
+        return Error::from_string_literal("Unknown type of encoded key");
+    }
+}
+
+static String item_key_for_key(String const& prefix, GC::Ref<Key> key)
+{
+    ByteBuffer encoded_key;
+    encode_key(encoded_key, key);
+
+    return MUST(String::formatted("{}{}", prefix, MUST(encode_base64(encoded_key))));
+}
+
+static String record_item_key(String const& database_name, ObjectStore const& object_store, GC::Ref<Key> key)
+{
+    return item_key_for_key(object_store_records_prefix(database_name, object_store.id()), key);
+}
+
+static String index_keys_item_key(String const& database_name, ObjectStore const& object_store, GC::Ref<Key> key)
+{
+    return item_key_for_key(object_store_index_keys_prefix(database_name, object_store.id()), key);
+}
+
+static ErrorOr<GC::Ref<Key>> key_from_item_key(JS::Realm& realm, String const& item_key, String const& prefix)
+{
+    auto encoded_key = TRY(decode_base64(item_key.bytes_as_string_view().substring_view(prefix.bytes().size())));
+    auto encoded_key_bytes = encoded_key.bytes();
+    return decode_key(realm, encoded_key_bytes);
+}
+
+static JsonValue key_path_to_json(Optional<KeyPath> const& key_path)
+{
+    if (!key_path.has_value())
+        return {};
+
+    return key_path->visit(
+        [](String const& path) -> JsonValue { return path; },
+        [](Vector<String> const& paths) -> JsonValue {
+            JsonArray array;
+            for (auto const& path : paths)
+                array.must_append(path);
+            return array;
+        });
+}
+
+static Optional<KeyPath> key_path_from_json(Optional<JsonValue const&> value)
+{
+    if (!value.has_value())
+        return {};
+
+    if (value->is_string())
+        return KeyPath { value->as_string() };
+
+    if (value->is_array()) {
+        Vector<String> paths;
+        for (auto const& path : value->as_array().values()) {
+            if (path.is_string())
+                paths.append(path.as_string());
+        }
+        return KeyPath { move(paths) };
+    }
+
+    return {};
+}
+
+static String serialize_metadata(Database& database)
+{
+    JsonArray object_stores;
+    for (auto const& object_store : database.object_stores()) {
+        JsonArray indexes;
+        for (auto const& [name, index] : object_store->index_set()) {
+            JsonObject index_object;
+            index_object.set("id"sv, index->id());
+            index_object.set("name"sv, name);
+            index_object.set("keyPath"sv, key_path_to_json(index->key_path()));
+            index_object.set("unique"sv, index->unique());
+            index_object.set("multiEntry"sv, index->multi_entry());
+            indexes.must_append(move(index_object));
+        }
+
+        JsonObject object_store_object;
+        object_store_object.set("id"sv, object_store->id());
+        object_store_object.set("name"sv, object_store->name());
+        object_store_object.set("keyPath"sv, key_path_to_json(object_store->key_path()));
+        object_store_object.set("autoIncrement"sv, object_store->uses_a_key_generator());
+        object_store_object.set("nextIndexId"sv, object_store->next_index_id());
+        object_store_object.set("indexes"sv, move(indexes));
+        object_stores.must_append(move(object_store_object));
+    }
+
+    JsonObject metadata;
+    metadata.set("version"sv, database.version());
+    metadata.set("nextObjectStoreId"sv, database.next_object_store_id());
+    metadata.set("objectStores"sv, move(object_stores));
+    return metadata.serialized();
+}
+
+static void load_object_stores(JS::Realm& realm, Database& database, JsonObject const& metadata)
+{
+    // NOTE: The ids of deleted object stores are never given out again.
+    auto next_object_store_id = metadata.get_u64("nextObjectStoreId"sv).value_or(0);
+    ScopeGuard set_next_object_store_id = [&] { database.set_next_object_store_id(next_object_store_id); };
+
+    auto object_stores = metadata.get_array("objectStores"sv);
+    if (!object_stores.has_value())
+        return;
+
+    for (auto const& object_store_value : object_stores->values()) {
+        if (!object_store_value.is_object())
+            continue;
+
+        auto const& object_store_object = object_store_value.as_object();
+        auto id = object_store_object.get_u64("id"sv);
+        auto name = object_store_object.get_string("name"sv);
+        if (!id.has_value() || !name.has_value())
+            continue;
+
+        // NOTE: The object store is given the id that it was persisted with.
+        database.set_next_object_store_id(*id);
+        next_object_store_id = max(next_object_store_id, *id + 1);
+
+        auto auto_increment = object_store_object.get_bool("autoIncrement"sv).value_or(false);
+        auto object_store = ObjectStore::create(realm, database, *name, auto_increment, key_path_from_json(object_store_object.get("keyPath"sv)));
+        object_store->set_records_need_loading(true);
+        if (auto_increment)
+            object_store->set_key_generator_is_persisted(true);
+
+        // NOTE: Like object stores, indexes are given the id that they were persisted with, and the ids of deleted
+        //       indexes are never given out again.
+        auto next_index_id = object_store_object.get_u64("nextIndexId"sv).value_or(0);
+        ScopeGuard set_next_index_id = [&] { object_store->set_next_index_id(next_index_id); };
+
+        auto indexes = object_store_object.get_array("indexes"sv);
+        if (!indexes.has_value())
+            continue;
+
+        for (auto const& index_value : indexes->values()) {
+            if (!index_value.is_object())
+                continue;
+
+            auto const& index_object = index_value.as_object();
+            auto index_name = index_object.get_string("name"sv);
+            auto index_key_path = key_path_from_json(index_object.get("keyPath"sv));
+            auto index_id = index_object.get_u64("id"sv);
+            if (!index_id.has_value() || !index_name.has_value() || !index_key_path.has_value())
+                continue;
+
+            object_store->set_next_index_id(*index_id);
+            next_index_id = max(next_index_id, *index_id + 1);
+
+            Index::create(realm, object_store, *index_name, *index_key_path, index_object.get_bool("unique"sv).value_or(false), index_object.get_bool("multiEntry"sv).value_or(false));
+        }
+    }
+}
+
+// NOTE: The keys of a record in the indexes of its object store are persisted along with it, so that the index records
+//       can be loaded without reading the values of all records. They are derived from the record's value in the same
+//       way as storing the record into the object store does. Returns nothing if the record has no keys in any index.
+static Optional<String> encode_index_keys(JS::Realm& realm, ObjectStore& object_store, Record const& record)
+{
+    if (object_store.index_set().is_empty())
+        return {};
+
+    auto value = HTML::structured_deserialize(realm.vm(), record.value, realm);
+    if (value.is_error())
+        return {};
+
+    ByteBuffer encoded_index_keys;
+    for (auto const& [name, index] : object_store.index_set()) {
+        auto completion_index_key = extract_a_key_from_a_value_using_a_key_path(realm, value.value(), index->key_path(), index->multi_entry());
+        if (completion_index_key.is_error())
+            continue;
+
+        auto failure_index_key = completion_index_key.release_value();
+        if (failure_index_key.is_error())
+            continue;
+
+        auto index_key = failure_index_key.release_value();
+        if (index_key->is_invalid())
+            continue;
+
+        append_value(encoded_index_keys, index->id());
+        if (index->multi_entry() && index_key->type() == Key::KeyType::Array) {
+            append_value(encoded_index_keys, static_cast<u32>(index_key->subkeys().size()));
+            for (auto const& subkey : index_key->subkeys())
+                encode_key(encoded_index_keys, *subkey);
+        } else {
+            append_value(encoded_index_keys, static_cast<u32>(1));
+            encode_key(encoded_index_keys, index_key);
+        }
+    }
+
+    if (encoded_index_keys.is_empty())
+        return {};
+    return MUST(encode_base64(encoded_index_keys));
+}
+
+static ErrorOr<void> load_index_keys(JS::Realm& realm, HashMap<u64, GC::Ref<Index>> const& indexes, GC::Ref<Key> record_key, StringView item_value)
+{
+    auto encoded_index_keys = TRY(decode_base64(item_value));
+    auto bytes = encoded_index_keys.bytes();
+
+    while (!bytes.is_empty()) {
+        auto index_id = TRY(read_value<u64>(bytes));
+        auto count = TRY(read_value<u32>(bytes));
+
+        // NOTE: Keys of indexes that have been deleted since the record was persisted are skipped.
+        auto index = indexes.get(index_id);
+        for (u32 i = 0; i < count; ++i) {
+            auto index_key = TRY(decode_key(realm, bytes));
+            if (index.has_value())
+                (*index)->store_a_record({ .key = index_key, .value = record_key });
+        }
+    }
+
+    return {};
+}
+
+static bool has_open_connections(Database& database)
+{
+    return any_of(database.associated_connections(), [](auto const& connection) {
+        return connection->state() != IDBDatabase::ConnectionState::Closed;
+    });
+}
+
+void load_persisted_database(JS::Realm& realm, StorageAPI::StorageKey const& storage_key, String const& name)
+{
+    if (!can_be_persisted(storage_key))
+        return;
+
+    if (auto database = Database::for_key_and_name(storage_key, name); database.has_value()) {
+        // NOTE: Open connections keep using the database that they were opened with. Otherwise, another process may have
+        //       upgraded or deleted the database since it was loaded, so it is loaded again.
+        if (has_open_connections(**database))
+            return;
+
+        MUST(Database::delete_for_key_and_name(storage_key, name));
+    }
+
+    auto metadata_json = page_client_for(realm).page_did_request_storage_item(StorageAPI::StorageEndpointType::IndexedDB, storage_key.to_string(), metadata_item_key(name));
+    if (!metadata_json.has_value())
+        return;
+
+    auto metadata = JsonValue::from_string(*metadata_json);
+    if (metadata.is_error() || !metadata.value().is_object()) {
+        dbgln("IndexedDB: Unable to parse the persisted metadata of database '{}'", name);
+        return;
+    }
+
+    auto maybe_database = Database::create_for_key_and_name(realm, storage_key, name);
+    if (maybe_database.is_error())
+        return;
+
+    auto database = maybe_database.release_value();
+    database->set_version(metadata.value().as_object().get_u64("version"sv).value_or(0));
+
+    // NOTE: The records of the object stores are only loaded once a transaction uses them.
+    load_object_stores(realm, *database, metadata.value().as_object());
+}
+
+void load_persisted_records(JS::Realm& realm, ObjectStore& object_store)
+{
+    if (!object_store.records_need_loading())
+        return;
+
+    // NOTE: Loading the records again would lose the changes that have yet to be persisted, so they are kept until the
+    //       transaction that made them has been committed.
+    if (object_store.was_cleared_since_persisted() || !object_store.unpersisted_keys().is_empty())
+        return;
+
+    auto database = object_store.database();
+    auto storage_key = database->storage_key().to_string();
+    auto& client = page_client_for(realm);
+
+    object_store.clear_records();
+    for (auto const& [name, index] : object_store.index_set())
+        index->clear_records();
+
+    auto records_prefix = object_store_records_prefix(database->name(), object_store.id());
+    for (auto const& item_key : client.page_did_request_storage_keys_with_prefix(StorageAPI::StorageEndpointType::IndexedDB, storage_key, records_prefix)) {
+        auto key = key_from_item_key(realm, item_key, records_prefix);
+        if (key.is_error()) {
+            dbgln("IndexedDB: Unable to load the key of a persisted record of object store '{}': {}", object_store.name(), key.error());
+            continue;
+        }
+
+        object_store.store_a_record({ .key = key.value(), .value = {}, .value_is_loaded = false });
+    }
+
+    if (!object_store.index_set().is_empty()) {
+        HashMap<u64, GC::Ref<Index>> indexes;
+        for (auto const& [name, index] : object_store.index_set())
+            indexes.set(index->id(), index);
+
+        auto index_keys_prefix = object_store_index_keys_prefix(database->name(), object_store.id());
+        for (auto const& [item_key, item_value] : client.page_did_request_storage_items_with_prefix(StorageAPI::StorageEndpointType::IndexedDB, storage_key, index_keys_prefix)) {
+            auto result = [&]() -> ErrorOr<void> {
+                auto record_key = TRY(key_from_item_key(realm, item_key, index_keys_prefix));
+                return load_index_keys(realm, indexes, record_key, item_value);
+            }();
+            if (result.is_error())
+                dbgln("IndexedDB: Unable to load the index keys of a persisted record of object store '{}': {}", object_store.name(), result.error());
+        }
+    }
+
+    // NOTE: The records that were just loaded are already persisted.
+    object_store.did_persist();
+    object_store.set_records_need_loading(false);
+}
+
+ErrorOr<Vector<HTML::SerializationRecord>> load_persisted_values(ObjectStore& object_store, ReadonlySpan<GC::Ref<Key>> keys)
+{
+    auto database = object_store.database();
+
+    Vector<String> item_keys;
+    TRY(item_keys.try_ensure_capacity(keys.size()));
+    for (auto key : keys)
+        item_keys.unchecked_append(record_item_key(database->name(), object_store, key));
+
+    auto item_values = page_client_for(database->realm()).page_did_request_storage_items(StorageAPI::StorageEndpointType::IndexedDB, database->storage_key().to_string(), item_keys);
+    if (item_values.size() != keys.size())
+        return Error::from_string_literal("Unable to read persisted values");
+
+    Vector<HTML::SerializationRecord> values;
+    TRY(values.try_ensure_capacity(keys.size()));
+    for (auto const& item_value : item_values) {
+        // NOTE: Another process may have removed the record, which this process has yet to be told about.
+        if (!item_value.has_value())
+            return Error::from_string_literal("Persisted value does not exist");
+
+        auto bytes = TRY(decode_base64(*item_value));
+
+        HTML::SerializationRecord value;
+        TRY(value.try_append(bytes.data(), bytes.size()));
+        values.unchecked_append(move(value));
+    }
+
+    return values;
+}
+
+void persist_changes_made_by_transaction(IDBTransaction const& transaction)
+{
+    if (transaction.mode() == Bindings::IDBTransactionMode::Readonly)
+        return;
+
+    auto database = transaction.connection()->associated_database();
+    if (!can_be_persisted(database->storage_key()))
+        return;
+
+    auto database_name = database->name();
+    Vector<String> removed_prefixes;
+    HashMap<String, Optional<String>> items;
+
+    auto add_changed_records = [&](ObjectStore& object_store) {
+        if (!object_store.was_cleared_since_persisted() && object_store.unpersisted_keys().is_empty())
+            return;
+
+        if (object_store.was_cleared_since_persisted()) {
+            removed_prefixes.append(object_store_records_prefix(database_name, object_store.id()));
+            removed_prefixes.append(object_store_index_keys_prefix(database_name, object_store.id()));
+        }
+
+        // NOTE: Records that were stored since the object store was last persisted always hold their value.
+        for (auto key : object_store.unpersisted_keys()) {
+            Optional<String> value;
+            Optional<String> index_keys;
+            if (auto record = object_store.record_with_key(key); record.has_value()) {
+                value = MUST(encode_base64(record->value.span()));
+                index_keys = encode_index_keys(transaction.realm(), object_store, *record);
+            }
+            items.set(record_item_key(database_name, object_store, key), move(value));
+            items.set(index_keys_item_key(database_name, object_store, key), move(index_keys));
+        }
+
+        // NOTE: Once they are persisted, the values are read from the storage jar again when they are needed. The storage
+        //       jar handles requests in order, so it will have written them by then.
+        for (auto key : object_store.unpersisted_keys()) {
+            if (auto record = object_store.record_with_key(key); record.has_value()) {
+                record->value = {};
+                record->value_is_loaded = false;
+            }
+        }
+
+        object_store.did_persist();
+    };
+
+    // NOTE: Only upgrade transactions can change the metadata, so it is not written otherwise. This way, a transaction
+    //       of a connection to an older version of the database can't undo an upgrade committed by another process.
+    if (transaction.is_upgrade_transaction()) {
+        // NOTE: An upgrade transaction may have created, renamed or deleted any object store or index, all of which is
+        //       part of the metadata. Only the records of the object stores that were deleted have to be removed, as
+        //       records are persisted under the id of their object store rather than its name.
+        items.set(metadata_item_key(database_name), serialize_metadata(*database));
+        for (auto id : database->take_ids_of_removed_object_stores()) {
+            removed_prefixes.append(object_store_records_prefix(database_name, id));
+            removed_prefixes.append(object_store_index_keys_prefix(database_name, id));
+            items.set(key_generator_item_key(database_name, id), {});
+        }
+
+        for (auto const& object_store : database->object_stores()) {
+            // NOTE: Until it is created in persistent storage, the key generator of a new object store is only used by
+            //       this process, as no other process can see the object store.
+            if (object_store->uses_a_key_generator() && !object_store->key_generator_is_persisted()) {
+                items.set(key_generator_item_key(database_name, object_store->id()), String::number(object_store->key_generator().current_number()));
+                object_store->set_key_generator_is_persisted(true);
+            }
+
+            add_changed_records(*object_store);
+        }
+    } else {
+        for (auto const& object_store : transaction.scope())
+            add_changed_records(*object_store);
+    }
+
+    if (removed_prefixes.is_empty() && items.is_empty())
+        return;
+
+    // NOTE: The storage jar writes the items in the background, in a single database transaction.
+    page_client_for(transaction.realm()).page_did_update_storage_items(StorageAPI::StorageEndpointType::IndexedDB, database->storage_key().to_string(), removed_prefixes, items);
+}
+
+void delete_persisted_database(JS::Realm& realm, StorageAPI::StorageKey const& storage_key, String const& name)
+{
+    if (!can_be_persisted(storage_key))
+        return;
+
+    // NOTE: Every item of the database starts with its prefix, and no other database's items do.
+    page_client_for(realm).page_did_update_storage_items(StorageAPI::StorageEndpointType::IndexedDB, storage_key.to_string(), { database_prefix(name) }, {});
+}
+
+Optional<u64> advance_persisted_key_generator(ObjectStore& object_store, u64 minimum, u64 increment)
+{
+    if (!object_store.key_generator_is_persisted())
+        return {};
+
+    auto database = object_store.database();
+    return page_client_for(database->realm()).page_did_advance_storage_counter(StorageAPI::StorageEndpointType::IndexedDB, database->storage_key().to_string(), key_generator_item_key(database->name(), object_store.id()), minimum, increment);
+}
+
+void did_change_persisted_items_in_other_process(String const& storage_key, Vector<String> const& removed_item_key_prefixes, Vector<String> const& changed_item_keys)
+{
+    Database::for_each_database([&](GC::Root<Database> const& database) {
+        if (database->storage_key().to_string() != storage_key)
+            return;
+
+        for (auto const& object_store : database->object_stores()) {
+            if (object_store->records_need_loading())
+                continue;
+
+            auto prefix = object_store_records_prefix(database->name(), object_store->id());
+            auto was_changed = any_of(removed_item_key_prefixes, [&](auto const& removed_prefix) { return prefix.starts_with_bytes(removed_prefix); })
+                || any_of(changed_item_keys, [&](auto const& item_key) { return item_key.starts_with_bytes(prefix); });
+
+            if (was_changed)
+                object_store->set_records_need_loading(true);
+        }
+    });
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HTML/StructuredSerializeTypes.h>
+#include <LibWeb/StorageAPI/StorageKey.h>
+
+namespace Web::IndexedDB {
+
+// Databases are persisted to the IndexedDB storage endpoint of the storage jar, which lives in the browser process.
+//
+// Each database is stored as a set of storage items whose keys start with the length-prefixed name of the database:
+// - One item holds the database's metadata (its version, object stores and indexes) as JSON.
+// - One item per object store with a key generator holds the current number of its key generator.
+// - Every record of an object store is one item, keyed by the id of its object store and its encoded key, and holding
+//   its serialized value. Object stores keep their id when they are renamed, so renaming one doesn't touch its records.
+// - Every record that has keys in any index of its object store has one more item, keyed the same way, which holds
+//   those keys along with the id of their index.
+//
+// Opening a database only loads its metadata. The first time a transaction uses an object store, the keys of its
+// records and its index records are loaded, but not the values of the records. Those are only read from the storage
+// jar when a request or cursor needs them, and are not kept afterwards. Committing a transaction only sends the records
+// that it has changed to the storage jar, without waiting for them to be written, and an upgrade transaction
+// additionally rewrites the metadata.
+//
+// Key generators are shared by all processes that use a database, so keys are generated by advancing the key generator
+// in the storage jar, which hands out each number only once.
+//
+// Other WebContent processes may change the same database. The browser process lets this process know which items they
+// changed, and the affected object stores are loaded again the next time they are used. A database without any open
+// connections is loaded again when it is next opened, as it may have been upgraded or deleted in the meantime.
+
+// Loads the metadata of the database named name in storage_key from the storage jar, unless it has already been loaded
+// and has open connections.
+void load_persisted_database(JS::Realm&, StorageAPI::StorageKey const&, String const& name);
+
+// Loads the keys of the records and the index records of object_store from the storage jar, if they haven't been loaded
+// yet or were changed by another process since.
+void load_persisted_records(JS::Realm&, ObjectStore&);
+
+// Reads the values of the records of object_store with the given keys from the storage jar, in the same order.
+ErrorOr<Vector<HTML::SerializationRecord>> load_persisted_values(ObjectStore&, ReadonlySpan<GC::Ref<Key>> keys);
+
+// Writes the changes made by transaction to the storage jar.
+void persist_changes_made_by_transaction(IDBTransaction const&);
+
+// Takes the larger of minimum and the current number of object_store's key generator in the storage jar, and sets that
+// current number to the taken number plus increment. Returns nothing if the key generator is not persisted, in which
+// case it is only used by this process.
+Optional<u64> advance_persisted_key_generator(ObjectStore&, u64 minimum, u64 increment);
+
+// Removes the database named name in storage_key from the storage jar.
+void delete_persisted_database(JS::Realm&, StorageAPI::StorageKey const&, String const& name);
+
+// Marks the object stores whose records were changed by another process as needing to be loaded again.
+void did_change_persisted_items_in_other_process(String const& storage_key, Vector<String> const& removed_item_key_prefixes, Vector<String> const& changed_item_keys);
+
+}
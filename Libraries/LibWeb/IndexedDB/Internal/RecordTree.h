@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/IterationDecision.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/OwnPtr.h>
+#include <AK/Vector.h>
+#include <LibWeb/IndexedDB/IDBKeyRange.h>
+
+namespace Web::IndexedDB {
+
+// A sorted list of records, stored as a B+-tree so that records can be found, stored and removed in logarithmic time.
+//
+// The order of the records is defined by the traits:
+// - Traits::SortKey is the part of a record that the list is sorted on. It is copied into the inner nodes of the tree,
+//   so it should be cheap to copy.
+// - Traits::sort_key(record) returns the sort key of a record.
+// - Traits::key_of(sort_key) returns the key of the record, which is what key ranges are matched against.
+// - Traits::compare(a, b) returns a negative number, zero or a positive number if a sorts before, equal to or after b.
+//
+// No two records in the list have equal sort keys. The leaves of the tree are linked to each other, so walking over a
+// range of records only descends the tree once.
+template<typename T, typename Traits>
+class RecordTree {
+    AK_MAKE_NONCOPYABLE(RecordTree);
+    AK_MAKE_NONMOVABLE(RecordTree);
+
+    struct Node;
+
+public:
+    using SortKey = typename Traits::SortKey;
+
+    class Iterator {
+    public:
+        [[nodiscard]] bool is_end() const { return !m_leaf; }
+
+        T& operator*() const { return m_leaf->records[m_index]; }
+        T* operator->() const { return &m_leaf->records[m_index]; }
+
+        bool operator==(Iterator const&) const = default;
+
+        Iterator& operator++()
+        {
+            VERIFY(m_leaf);
+            if (++m_index == m_leaf->records.size()) {
+                m_leaf = m_leaf->next_leaf;
+                m_index = 0;
+            }
+            return *this;
+        }
+
+        // Stepping back from the first record yields the end, and stepping back from the end yields the last record.
+        Iterator& operator--()
+        {
+            if (!m_leaf) {
+                if (m_tree->is_empty())
+                    return *this;
+                m_leaf = m_tree->m_last_leaf;
+                m_index = m_leaf->records.size() - 1;
+            } else if (m_index == 0) {
+                m_leaf = m_leaf->previous_leaf;
+                m_index = m_leaf ? m_leaf->records.size() - 1 : 0;
+            } else {
+                --m_index;
+            }
+            return *this;
+        }
+
+    private:
+        friend class RecordTree;
+
+        Iterator(RecordTree const& tree, Node* leaf, size_t index)
+            : m_tree(&tree)
+            , m_leaf(leaf)
+            , m_index(index)
+        {
+            if (m_leaf && m_index == m_leaf->records.size()) {
+                m_leaf = m_leaf->next_leaf;
+                m_index = 0;
+            }
+        }
+
+        RecordTree const* m_tree { nullptr };
+        Node* m_leaf { nullptr };
+        size_t m_index { 0 };
+    };
+
+    RecordTree() { clear(); }
+
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+
+    Iterator begin() { return Iterator(*this, m_first_leaf, 0); }
+    Iterator end() { return Iterator(*this, nullptr, 0); }
+
+    // Returns the first record for which is_before(sort key) returns false. is_before must return true for a (possibly
+    // empty) prefix of the possible sort keys, and false for everything after that.
+    template<typename IsBefore>
+    Iterator lower_bound(IsBefore is_before)
+    {
+        auto* node = m_root.ptr();
+        while (!node->is_leaf) {
+            auto child_index = partition_point(node->separators, is_before);
+            node = node->children[child_index].ptr();
+        }
+
+        auto index = partition_point(node->records, [&](T const& record) { return is_before(Traits::sort_key(record)); });
+        return Iterator(*this, node, index);
+    }
+
+    // Like lower_bound(), but is_before is given the keys of the records rather than their sort keys.
+    template<typename IsBefore>
+    Iterator lower_bound_by_key(IsBefore is_before)
+    {
+        return lower_bound([&](SortKey const& sort_key) { return is_before(Traits::key_of(sort_key)); });
+    }
+
+    Iterator find(SortKey const& sort_key)
+    {
+        auto it = lower_bound([&](SortKey const& other) { return Traits::compare(other, sort_key) < 0; });
+        if (it.is_end() || Traits::compare(Traits::sort_key(*it), sort_key) != 0)
+            return end();
+        return it;
+    }
+
+    // Returns the first record whose key is in range, if any.
+    Iterator first_in_range(IDBKeyRange const& range)
+    {
+        auto it = lower_bound_by_key([&](GC::Ref<Key> key) { return range.is_below_lower_bound(key); });
+        if (it.is_end() || range.is_above_upper_bound(Traits::key_of(Traits::sort_key(*it))))
+            return end();
+        return it;
+    }
+
+    template<typename Callback>
+    void for_each_in_range(IDBKeyRange const& range, Callback callback)
+    {
+        for (auto it = first_in_range(range); !it.is_end(); ++it) {
+            if (range.is_above_upper_bound(Traits::key_of(Traits::sort_key(*it))))
+                return;
+            if (callback(*it) == IterationDecision::Break)
+                return;
+        }
+    }
+
+    // Stores the record at its position in the list, replacing any record with an equal sort key.
+    void insert(T record)
+    {
+        auto split = insert_into(*m_root, move(record));
+        if (!split.has_value())
+            return;
+
+        auto new_root = make<Node>(false);
+        new_root->separators.append(move(split->separator));
+        new_root->children.append(m_root.release_nonnull());
+        new_root->children.append(move(split->right));
+        m_root = move(new_root);
+    }
+
+    bool remove(SortKey const& sort_key)
+    {
+        if (!remove_from(*m_root, sort_key))
+            return false;
+
+        --m_size;
+        if (!m_root->is_leaf && m_root->children.size() == 1)
+            m_root = m_root->children.take_first();
+        return true;
+    }
+
+    template<typename Predicate>
+    size_t remove_all_matching(Predicate predicate)
+    {
+        Vector<SortKey> sort_keys_to_remove;
+        for (auto it = begin(); !it.is_end(); ++it) {
+            if (predicate(*it))
+                sort_keys_to_remove.append(Traits::sort_key(*it));
+        }
+
+        for (auto const& sort_key : sort_keys_to_remove)
+            remove(sort_key);
+        return sort_keys_to_remove.size();
+    }
+
+    void clear()
+    {
+        m_root = make<Node>(true);
+        m_first_leaf = m_root.ptr();
+        m_last_leaf = m_root.ptr();
+        m_size = 0;
+    }
+
+    // Invokes the callback for the sort key of every record, and for the copies of sort keys held by the inner nodes,
+    // which may outlive the records they were taken from.
+    template<typename Callback>
+    void for_each_sort_key(Callback callback) const
+    {
+        for_each_sort_key_in(*m_root, callback);
+    }
+
+private:
+    static constexpr size_t max_node_size = 64;
+    static constexpr size_t min_node_size = max_node_size / 2;
+
+    struct Node {
+        explicit Node(bool is_leaf)
+            : is_leaf(is_leaf)
+        {
+        }
+
+        bool is_leaf { false };
+
+        // Leaves hold up to max_node_size records, and are linked to the leaves before and after them.
+        Vector<T> records;
+        Node* previous_leaf { nullptr };
+        Node* next_leaf { nullptr };
+
+        // Inner nodes hold up to max_node_size children. Every record in children[i] sorts before separators[i], and
+        // every record in children[i + 1] sorts equal to or after it.
+        Vector<SortKey> separators;
+        Vector<NonnullOwnPtr<Node>> children;
+    };
+
+    struct Split {
+        SortKey separator;
+        NonnullOwnPtr<Node> right;
+    };
+
+    template<typename Container, typename Predicate>
+    static size_t partition_point(Container const& items, Predicate const& predicate)
+    {
+        size_t low = 0;
+        size_t high = items.size();
+        while (low < high) {
+            auto middle = low + (high - low) / 2;
+            if (predicate(items[middle]))
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low;
+    }
+
+    static size_t child_index_for(Node const& node, SortKey const& sort_key)
+    {
+        return partition_point(node.separators, [&](SortKey const& separator) { return Traits::compare(separator, sort_key) <= 0; });
+    }
+
+    static size_t size_of(Node const& node) { return node.is_leaf ? node.records.size() : node.children.size(); }
+
+    Optional<Split> insert_into(Node& node, T&& record)
+    {
+        SortKey sort_key = Traits::sort_key(record);
+
+        if (node.is_leaf) {
+            auto index = partition_point(node.records, [&](T const& other) { return Traits::compare(Traits::sort_key(other), sort_key) < 0; });
+            if (index < node.records.size() && Traits::compare(Traits::sort_key(node.records[index]), sort_key) == 0) {
+                node.records[index] = move(record);
+                return {};
+            }
+
+            node.records.insert(index, move(record));
+            ++m_size;
+            if (node.records.size() <= max_node_size)
+                return {};
+            return split_leaf(node);
+        }
+
+        auto child_index = child_index_for(node, sort_key);
+        auto split = insert_into(*node.children[child_index], move(record));
+        if (!split.has_value())
+            return {};
+
+        node.separators.insert(child_index, move(split->separator));
+        node.children.insert(child_index + 1, move(split->right));
+        if (node.children.size() <= max_node_size)
+            return {};
+        return split_inner_node(node);
+    }
+
+    Split split_leaf(Node& leaf)
+    {
+        auto right = make<Node>(true);
+        auto middle = leaf.records.size() / 2;
+
+        right->records.ensure_capacity(leaf.records.size() - middle);
+        for (size_t i = middle; i < leaf.records.size(); ++i)
+            right->records.unchecked_append(move(leaf.records[i]));
+        leaf.records.shrink(middle, true);
+
+        right->previous_leaf = &leaf;
+        right->next_leaf = leaf.next_leaf;
+        if (leaf.next_leaf)
+            leaf.next_leaf->previous_leaf = right.ptr();
+        else
+            m_last_leaf = right.ptr();
+        leaf.next_leaf = right.ptr();
+
+        SortKey separator = Traits::sort_key(right->records.first());
+        return { move(separator), move(right) };
+    }
+
+    Split split_inner_node(Node& node)
+    {
+        auto right = make<Node>(false);
+        auto middle = node.children.size() / 2;
+
+        // The left node keeps the first `middle` children, and the separator between the two halves moves up.
+        SortKey separator = move(node.separators[middle - 1]);
+        for (size_t i = middle; i < node.separators.size(); ++i)
+            right->separators.append(move(node.separators[i]));
+        for (size_t i = middle; i < node.children.size(); ++i)
+            right->children.append(move(node.children[i]));
+        node.separators.shrink(middle - 1, true);
+        node.children.shrink(middle, true);
+
+        return { move(separator), move(right) };
+    }
+
+    bool remove_from(Node& node, SortKey const& sort_key)
+    {
+        if (node.is_leaf) {
+            auto index = partition_point(node.records, [&](T const& other) { return Traits::compare(Traits::sort_key(other), sort_key) < 0; });
+            if (index == node.records.size() || Traits::compare(Traits::sort_key(node.records[index]), sort_key) != 0)
+                return false;
+            node.records.remove(index);
+            return true;
+        }
+
+        auto child_index = child_index_for(node, sort_key);
+        if (!remove_from(*node.children[child_index], sort_key))
+            return false;
+
+        if (size_of(*node.children[child_index]) < min_node_size)
+            rebalance_child(node, child_index);
+        return true;
+    }
+
+    // Brings an underfull child back to at least min_node_size entries, by taking one from a sibling if it can spare
+    // one, or by merging it with a sibling otherwise.
+    void rebalance_child(Node& parent, size_t child_index)
+    {
+        auto& child = *parent.children[child_index];
+
+        if (child_index > 0) {
+            auto& left = *parent.children[child_index - 1];
+            if (size_of(left) > min_node_size) {
+                if (child.is_leaf) {
+                    child.records.prepend(left.records.take_last());
+                    parent.separators[child_index - 1] = Traits::sort_key(child.records.first());
+                } else {
+                    child.children.prepend(left.children.take_last());
+                    child.separators.prepend(move(parent.separators[child_index - 1]));
+                    parent.separators[child_index - 1] = left.separators.take_last();
+                }
+                return;
+            }
+        }
+
+        if (child_index + 1 < parent.children.size()) {
+            auto& right = *parent.children[child_index + 1];
+            if (size_of(right) > min_node_size) {
+                if (child.is_leaf) {
+                    child.records.append(right.records.take_first());
+                    parent.separators[child_index] = Traits::sort_key(right.records.first());
+                } else {
+                    child.children.append(right.children.take_first());
+                    child.separators.append(move(parent.separators[child_index]));
+                    parent.separators[child_index] = right.separators.take_first();
+                }
+                return;
+            }
+        }
+
+        merge_children(parent, child_index > 0 ? child_index - 1 : child_index);
+    }
+
+    void merge_children(Node& parent, size_t left_index)
+    {
+        auto& left = *parent.children[left_index];
+        auto right = parent.children.take(left_index + 1);
+        auto separator = parent.separators.take(left_index);
+
+        if (left.is_leaf) {
+            left.records.extend(move(right->records));
+            left.next_leaf = right->next_leaf;
+            if (right->next_leaf)
+                right->next_leaf->previous_leaf = &left;
+            else
+                m_last_leaf = &left;
+        } else {
+            left.separators.append(move(separator));
+            left.separators.extend(move(right->separators));
+            left.children.extend(move(right->children));
+        }
+    }
+
+    template<typename Callback>
+    static void for_each_sort_key_in(Node const& node, Callback& callback)
+    {
+        if (node.is_leaf) {
+            for (auto const& record : node.records)
+                callback(Traits::sort_key(record));
+            return;
+        }
+
+        for (auto const& separator : node.separators)
+            callback(separator);
+        for (auto const& child : node.children)
+            for_each_sort_key_in(*child, callback);
+    }
+
+    OwnPtr<Node> m_root;
+    Node* m_first_leaf { nullptr };
+    Node* m_last_leaf { nullptr };
+    size_t m_size { 0 };
+};
+
+}
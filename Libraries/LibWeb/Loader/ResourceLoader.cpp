@@ -96,6 +96,19 @@ void ResourceLoader::preconnect(URL::URL const& url)
         m_request_client->ensure_connection(url, RequestServer::CacheLevel::CreateConnection);
 }
 
+void ResourceLoader::will_navigate(URL::URL const& url)
+{
+    if (!url.scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    if (ContentFilter::the().is_filtered(url))
+        return;
+
+    // NOTE: This lets RequestServer connect to the origins that the site's pages are likely to load subresources from.
+    if (m_request_client)
+        m_request_client->will_navigate(url);
+}
+
 static HashMap<LoadRequest, NonnullRefPtr<Resource>> s_resource_cache;
 
 RefPtr<Resource> ResourceLoader::load_resource(Resource::Type type, LoadRequest& request)
@@ -552,7 +565,7 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
         return nullptr;
     }
 
-    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy);
+    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy, request.priority());
     if (!protocol_request) {
         log_failure(request, "Failed to initiate load"sv);
         return nullptr;
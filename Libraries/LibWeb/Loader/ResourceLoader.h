@@ -44,6 +44,7 @@ public:
 
     void prefetch_dns(URL::URL const&);
     void preconnect(URL::URL const&);
+    void will_navigate(URL::URL const&);
 
     Function<void()> on_load_counter_change;
 
@@ -364,6 +364,16 @@ public:
     virtual void page_did_remove_storage_item([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key, [[maybe_unused]] String const& bottle_key) { }
     virtual Vector<String> page_did_request_storage_keys([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key) { return {}; }
     virtual void page_did_clear_storage([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key) { }
+    virtual HashMap<String, String> page_did_request_storage_items_with_prefix([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key, [[maybe_unused]] String const& bottle_key_prefix) { return {}; }
+    virtual Vector<String> page_did_request_storage_keys_with_prefix([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key, [[maybe_unused]] String const& bottle_key_prefix) { return {}; }
+    virtual Vector<Optional<String>> page_did_request_storage_items([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key, Vector<String> const& bottle_keys)
+    {
+        Vector<Optional<String>> values;
+        values.resize(bottle_keys.size());
+        return values;
+    }
+    virtual void page_did_update_storage_items([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key, [[maybe_unused]] Vector<String> const& removed_bottle_key_prefixes, [[maybe_unused]] HashMap<String, Optional<String>> const& items) { }
+    virtual Optional<u64> page_did_advance_storage_counter([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key, [[maybe_unused]] String const& bottle_key, [[maybe_unused]] u64 minimum, [[maybe_unused]] u64 increment) { return {}; }
     virtual void page_did_update_resource_count(i32) { }
     struct NewWebViewResult {
         GC::Ptr<Page> page;
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashTable.h>
 #include <AK/TemporaryChange.h>
 #include <LibWeb/Painting/DevicePixelConverter.h>
 #include <LibWeb/Painting/DisplayList.h>
@@ -12,7 +13,185 @@ namespace Web::Painting {
 
 void DisplayList::append(DisplayListCommand&& command, Optional<i32> scroll_frame_id, RefPtr<ClipFrame const> clip_frame)
 {
+    command.visit(
+        [&](ApplyBackdropFilter const&) { m_can_be_rasterized_in_tiles = false; },
+        [&](DrawPaintingSurface const&) { m_can_be_rasterized_in_tiles = false; },
+        [&](PaintNestedDisplayList const& nested) {
+            if (nested.display_list && !nested.display_list->can_be_rasterized_in_tiles())
+                m_can_be_rasterized_in_tiles = false;
+        },
+        [&](AddMask const& mask) {
+            if (mask.display_list && !mask.display_list->can_be_rasterized_in_tiles())
+                m_can_be_rasterized_in_tiles = false;
+        },
+        [](auto const&) {});
     m_commands.append({ scroll_frame_id, clip_frame, move(command) });
+    update_skippable_ranges(m_commands.last().command, scroll_frame_id, clip_frame.ptr());
+}
+
+static constexpr size_t max_number_of_commands_in_skippable_run = 64;
+
+static Optional<Gfx::IntRect> command_bounding_rectangle(DisplayListCommand const&);
+
+static bool is_identity(Gfx::FloatMatrix4x4 const& matrix)
+{
+    auto identity = Gfx::FloatMatrix4x4::identity();
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            if (matrix[i, j] != identity[i, j])
+                return false;
+        }
+    }
+    return true;
+}
+
+// Whether a layer or state opened by this command, when nothing ends up drawn into it, leaves the pixels below
+// untouched, and bounding rects of its content are in the same coordinate space as the command itself.
+static bool opener_is_local(DisplayListCommand const& command)
+{
+    auto compositing_operator_is_local = [](Gfx::CompositingAndBlendingOperator compositing_and_blending_operator) {
+        switch (compositing_and_blending_operator) {
+        case Gfx::CompositingAndBlendingOperator::Clear:
+        case Gfx::CompositingAndBlendingOperator::Copy:
+        case Gfx::CompositingAndBlendingOperator::SourceIn:
+        case Gfx::CompositingAndBlendingOperator::DestinationIn:
+        case Gfx::CompositingAndBlendingOperator::SourceOut:
+        case Gfx::CompositingAndBlendingOperator::DestinationATop:
+        case Gfx::CompositingAndBlendingOperator::PlusDarker:
+            return false;
+        default:
+            return true;
+        }
+    };
+
+    return command.visit(
+        [&](PushStackingContext const& push_stacking_context) {
+            return compositing_operator_is_local(push_stacking_context.compositing_and_blending_operator)
+                && is_identity(push_stacking_context.transform.matrix);
+        },
+        [&](ApplyCompositeAndBlendingOperator const& apply_composite_and_blending_operator) {
+            return compositing_operator_is_local(apply_composite_and_blending_operator.compositing_and_blending_operator);
+        },
+        // Filters can draw outside of their input, or produce output from nothing at all.
+        [](ApplyFilter const&) { return false; },
+        [](auto const&) { return true; });
+}
+
+void DisplayList::RangeBuilder::add(Gfx::IntRect const& rect, Optional<i32> scroll_frame_id)
+{
+    if (command_count == 0) {
+        bounding_rect = rect;
+        this->scroll_frame_id = scroll_frame_id;
+    } else {
+        bounding_rect.unite(rect);
+        // Commands in different scroll frames move independently, so one rect can't describe all of them.
+        if (this->scroll_frame_id != scroll_frame_id)
+            is_bounded = false;
+    }
+    ++command_count;
+}
+
+void DisplayList::add_skippable_range(size_t start, size_t end, Gfx::IntRect bounding_rect, Optional<i32> scroll_frame_id)
+{
+    m_commands[start].skippable_range_index = static_cast<u32>(m_skippable_ranges.size());
+    m_skippable_ranges.append({ .end = end, .bounding_rect = bounding_rect, .scroll_frame_id = scroll_frame_id });
+}
+
+void DisplayList::close_open_run()
+{
+    if (!m_open_run.has_value())
+        return;
+    auto run = m_open_run.release_value();
+    if (run.command_count > 1)
+        add_skippable_range(run.start, run.end, run.bounding_rect, run.scroll_frame_id);
+}
+
+void DisplayList::update_skippable_ranges(DisplayListCommand const& command, Optional<i32> scroll_frame_id, ClipFrame const* clip_frame)
+{
+    auto index = m_commands.size() - 1;
+
+    if (m_open_nesting_levels.is_empty())
+        m_open_nesting_levels.append({});
+
+    auto nesting_level_change = command.visit([](auto const& command) {
+        if constexpr (requires { command.nesting_level_change; })
+            return command.nesting_level_change;
+        else
+            return 0;
+    });
+
+    // Players apply clip frames lazily, so skipping a range is only equivalent to replaying it if the clip frame
+    // that is current after the range is the same as the one it started with.
+    if (nesting_level_change > 0) {
+        close_open_run();
+        if (m_open_nesting_levels.last().clip_frame != clip_frame)
+            m_open_nesting_levels.last().is_bounded = false;
+        m_open_nesting_levels.append({ .start = index, .clip_frame = clip_frame, .opener_is_local = opener_is_local(command) });
+        return;
+    }
+
+    if (nesting_level_change < 0) {
+        close_open_run();
+        if (m_open_nesting_levels.size() <= 1)
+            return;
+        auto level = m_open_nesting_levels.take_last();
+        if (level.clip_frame != clip_frame)
+            level.is_bounded = false;
+        bool is_skippable = level.opener_is_local && level.is_bounded;
+        if (is_skippable && level.command_count > 0)
+            add_skippable_range(level.start, index + 1, level.bounding_rect, level.scroll_frame_id);
+
+        auto& parent = m_open_nesting_levels.last();
+        if (!is_skippable || parent.coordinate_space_changed)
+            parent.is_bounded = false;
+        else if (level.command_count > 0)
+            parent.add(level.bounding_rect, level.scroll_frame_id);
+        return;
+    }
+
+    auto& level = m_open_nesting_levels.last();
+    if (level.clip_frame != clip_frame)
+        level.is_bounded = false;
+
+    // Clips only ever reduce what gets drawn, and are undone when the enclosing nesting level ends.
+    if (command.has<AddClipRect>() || command.has<AddRoundedRectClip>() || command.has<AddMask>() || command.has<ApplyMaskBitmap>()) {
+        close_open_run();
+        return;
+    }
+
+    if (command.has<Translate>() || command.has<ApplyTransform>()) {
+        close_open_run();
+        level.coordinate_space_changed = true;
+        return;
+    }
+
+    auto bounding_rect = command_bounding_rectangle(command);
+
+    if (!bounding_rect.has_value()) {
+        close_open_run();
+        level.is_bounded = false;
+        return;
+    }
+
+    // Runs are checked against the canvas transform at the time they start, so they remain skippable after a
+    // translation, but the level as a whole is no longer described by a single rect.
+    if (level.coordinate_space_changed)
+        level.is_bounded = false;
+    else
+        level.add(*bounding_rect, scroll_frame_id);
+
+    if (m_open_run.has_value() && (m_open_run->scroll_frame_id != scroll_frame_id || m_open_run->clip_frame != clip_frame || m_open_run->command_count >= max_number_of_commands_in_skippable_run))
+        close_open_run();
+    if (!m_open_run.has_value())
+        m_open_run = RangeBuilder { .start = index, .clip_frame = clip_frame };
+    m_open_run->add(*bounding_rect, scroll_frame_id);
+    m_open_run->end = index + 1;
+
+    // Painting a nested display list translates the canvas for everything that follows it on this level.
+    if (command.has<PaintNestedDisplayList>()) {
+        close_open_run();
+        level.coordinate_space_changed = true;
+    }
 }
 
 String DisplayList::dump() const
@@ -66,6 +245,185 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
         });
 }
 
+static Gfx::IntPoint device_scroll_offset(ScrollStateSnapshot const& scroll_state, size_t scroll_frame_id, double device_pixels_per_css_pixel)
+{
+    auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id);
+    return cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
+}
+
+static void add_damage_rect(Vector<Gfx::IntRect>& rects, Gfx::IntRect rect, Gfx::IntRect const& surface_rect)
+{
+    static constexpr size_t max_number_of_damage_rects = 32;
+
+    rect.intersect(surface_rect);
+    if (rect.is_empty())
+        return;
+    for (size_t i = 0; i < rects.size();) {
+        if (rects[i].intersects(rect)) {
+            rect.unite(rects.take(i));
+            i = 0;
+            continue;
+        }
+        ++i;
+    }
+    rects.append(rect);
+
+    if (rects.size() > max_number_of_damage_rects) {
+        auto bounding_rect = rects.take_last();
+        for (auto const& other : rects)
+            bounding_rect.unite(other);
+        rects.clear();
+        rects.append(bounding_rect);
+    }
+}
+
+Optional<DisplayList::ScrollDamage> DisplayList::compute_scroll_damage(ScrollStateSnapshot const& previous_scroll_state, ScrollStateSnapshot const& scroll_state, Gfx::IntRect surface_rect) const
+{
+    if (!m_can_be_rasterized_in_tiles)
+        return {};
+
+    DevicePixelConverter device_pixel_converter { m_device_pixels_per_css_pixel };
+
+    // Scroll frame 0 always belongs to the viewport, so the bulk of the page moves along with it.
+    auto offset = device_scroll_offset(scroll_state, 0, m_device_pixels_per_css_pixel) - device_scroll_offset(previous_scroll_state, 0, m_device_pixels_per_css_pixel);
+    if (AK::abs(offset.x()) >= surface_rect.width() || AK::abs(offset.y()) >= surface_rect.height())
+        return {};
+
+    ScrollDamage damage { .offset = offset, .rects = {} };
+
+    // Newly exposed area along the edges the content moved away from.
+    if (offset.y() > 0)
+        add_damage_rect(damage.rects, { surface_rect.x(), surface_rect.y(), surface_rect.width(), offset.y() }, surface_rect);
+    else if (offset.y() < 0)
+        add_damage_rect(damage.rects, { surface_rect.x(), surface_rect.bottom() + offset.y(), surface_rect.width(), -offset.y() }, surface_rect);
+    if (offset.x() > 0)
+        add_damage_rect(damage.rects, { surface_rect.x(), surface_rect.y(), offset.x(), surface_rect.height() }, surface_rect);
+    else if (offset.x() < 0)
+        add_damage_rect(damage.rects, { surface_rect.right() + offset.x(), surface_rect.y(), -offset.x(), surface_rect.height() }, surface_rect);
+
+    // Adds both the place a rect was moved to by the shift and the place it has to be painted at now.
+    auto add_moved_rect = [&](Gfx::IntRect rect, Gfx::IntPoint previous_offset, Gfx::IntPoint current_offset) {
+        // Account for anti-aliasing bleeding into neighboring pixels.
+        rect.inflate(2, 2);
+        add_damage_rect(damage.rects, rect.translated(previous_offset + offset), surface_rect);
+        add_damage_rect(damage.rects, rect.translated(current_offset), surface_rect);
+    };
+
+    // Bounding rects are only meaningful in device space outside of transforms, and content under a filter may
+    // bleed outside of them.
+    struct NestingState {
+        bool bounding_rects_are_in_device_space { true };
+        bool is_inside_filter { false };
+    };
+    Vector<NestingState> nesting_stack;
+    nesting_stack.append({});
+
+    HashTable<ClipFrame const*> visited_clip_frames;
+
+    for (auto const& [scroll_frame_id, clip_frame, command, skippable_range_index] : m_commands) {
+        auto state = nesting_stack.last();
+
+        Gfx::IntPoint previous_offset;
+        Gfx::IntPoint current_offset;
+        if (scroll_frame_id.has_value()) {
+            previous_offset = device_scroll_offset(previous_scroll_state, scroll_frame_id.value(), m_device_pixels_per_css_pixel);
+            current_offset = device_scroll_offset(scroll_state, scroll_frame_id.value(), m_device_pixels_per_css_pixel);
+        }
+        bool moved_with_viewport = current_offset - previous_offset == offset;
+
+        if (clip_frame && !visited_clip_frames.contains(clip_frame.ptr())) {
+            visited_clip_frames.set(clip_frame.ptr());
+            for (auto const& clip_rect : clip_frame->clip_rects()) {
+                auto previous_css_rect = clip_rect.rect;
+                auto current_css_rect = clip_rect.rect;
+                if (auto id = clip_rect.enclosing_scroll_frame_id; id.has_value()) {
+                    previous_css_rect.translate_by(previous_scroll_state.cumulative_offset_for_frame_with_id(id.value()));
+                    current_css_rect.translate_by(scroll_state.cumulative_offset_for_frame_with_id(id.value()));
+                }
+                auto previous_device_rect = device_pixel_converter.rounded_device_rect(previous_css_rect).to_type<int>();
+                auto current_device_rect = device_pixel_converter.rounded_device_rect(current_css_rect).to_type<int>();
+                if (previous_device_rect.translated(offset) == current_device_rect)
+                    continue;
+                if (!state.bounding_rects_are_in_device_space)
+                    return {};
+                add_damage_rect(damage.rects, previous_device_rect.translated(offset).inflated(2, 2), surface_rect);
+                add_damage_rect(damage.rects, current_device_rect.inflated(2, 2), surface_rect);
+            }
+        }
+
+        auto bounding_rect = command_bounding_rectangle(command);
+
+        if (command.has<PaintScrollBar>()) {
+            // The thumb moves along the scrollbar axis with the frame's own scroll offset, so repaint the entire
+            // strip the scrollbar is in.
+            auto const& scroll_bar = command.get<PaintScrollBar>();
+            bool thumb_moved = previous_scroll_state.own_offset_for_frame_with_id(scroll_bar.scroll_frame_id) != scroll_state.own_offset_for_frame_with_id(scroll_bar.scroll_frame_id);
+            if (thumb_moved || !moved_with_viewport) {
+                if (!state.bounding_rects_are_in_device_space)
+                    return {};
+                auto extent = scroll_bar.gutter_rect.united(scroll_bar.thumb_rect);
+                for (auto translation : { previous_offset + offset, current_offset }) {
+                    auto strip = extent.translated(translation);
+                    if (scroll_bar.vertical)
+                        strip = { strip.x(), surface_rect.y(), strip.width(), surface_rect.height() };
+                    else
+                        strip = { surface_rect.x(), strip.y(), surface_rect.width(), strip.height() };
+                    add_damage_rect(damage.rects, strip.inflated(2, 2), surface_rect);
+                }
+            }
+        } else if (!moved_with_viewport) {
+            if (command.has<PushStackingContext>()) {
+                // A stacking context only affects where its content ends up if it is transformed or clipped.
+                auto const& push_stacking_context = command.get<PushStackingContext>();
+                if (!is_identity(push_stacking_context.transform.matrix) || push_stacking_context.clip_path.has_value())
+                    return {};
+            } else if (command.has<FillRect>() && bounding_rect->translated(previous_offset).contains(surface_rect) && bounding_rect->translated(current_offset).contains(surface_rect)) {
+                // A solid fill covering the whole surface looks the same no matter how far it is shifted.
+            } else if (bounding_rect.has_value()) {
+                if (!state.bounding_rects_are_in_device_space || state.is_inside_filter)
+                    return {};
+                add_moved_rect(*bounding_rect, previous_offset, current_offset);
+            } else if (command.visit([](auto const& command) {
+                           using CommandType = RemoveCVReference<decltype(command)>;
+                           return requires(CommandType& mutable_command) { mutable_command.translate_by(Gfx::IntPoint {}); };
+                       })) {
+                // Anything else that is positioned in device space but has no known extent.
+                return {};
+            }
+        }
+
+        command.visit(
+            [&](PushStackingContext const& push_stacking_context) {
+                nesting_stack.append(state);
+                if (!is_identity(push_stacking_context.transform.matrix))
+                    nesting_stack.last().bounding_rects_are_in_device_space = false;
+            },
+            [&](ApplyFilter const&) {
+                nesting_stack.append(state);
+                nesting_stack.last().is_inside_filter = true;
+            },
+            [&](Translate const&) { nesting_stack.last().bounding_rects_are_in_device_space = false; },
+            [&](ApplyTransform const&) { nesting_stack.last().bounding_rects_are_in_device_space = false; },
+            [&](auto const& command) {
+                if constexpr (requires { command.nesting_level_change; }) {
+                    if (command.nesting_level_change > 0)
+                        nesting_stack.append(state);
+                    else if (nesting_stack.size() > 1)
+                        nesting_stack.take_last();
+                }
+            });
+    }
+
+    size_t damaged_area = 0;
+    for (auto const& rect : damage.rects)
+        damaged_area += static_cast<size_t>(rect.width()) * rect.height();
+    // Past this point, shifting pixels around no longer pays off compared to rasterizing everything.
+    if (damaged_area * 2 > static_cast<size_t>(surface_rect.width()) * surface_rect.height())
+        return {};
+
+    return damage;
+}
+
 void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
 {
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
@@ -127,8 +485,10 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
     Vector<RefPtr<ClipFrame const>> clip_frames_stack;
     clip_frames_stack.append({});
+    auto const& skippable_ranges = display_list.skippable_ranges();
+
     for (size_t command_index = 0; command_index < commands.size(); command_index++) {
-        auto [scroll_frame_id, clip_frame, command] = commands[command_index];
+        auto const& [scroll_frame_id, clip_frame, recorded_command, skippable_range_index] = commands[command_index];
 
         if (clip_frames_stack.last() != clip_frame) {
             if (auto clip_frame = clip_frames_stack.take_last()) {
@@ -140,18 +500,35 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
             }
         }
 
+        // Every command in a skippable range shares the clip frame applied above and draws only inside the range's
+        // bounding rect, so if that is clipped away, none of them can affect the output.
+        if (skippable_range_index.has_value()) {
+            auto const& range = skippable_ranges[skippable_range_index.value()];
+            auto range_rect = range.bounding_rect;
+            if (range.scroll_frame_id.has_value())
+                range_rect.translate_by(device_scroll_offset(scroll_state, range.scroll_frame_id.value(), device_pixels_per_css_pixel));
+            if (range_rect.is_empty() || would_be_fully_clipped_by_painter(range_rect)) {
+                command_index = range.end - 1;
+                continue;
+            }
+        }
+
         // After entering a new stacking context, we keep the outer clip frame applied.
         // This is necessary when the stacking context has a CSS transform, and all
         // nested ClipFrames aggregate clip rectangles only up to the stacking context
         // node.
-        if (command.has<PushStackingContext>()) {
+        if (recorded_command.has<PushStackingContext>()) {
             clip_frames_stack.append({});
-        } else if (command.has<PopStackingContext>()) {
+        } else if (recorded_command.has<PopStackingContext>()) {
             if (auto clip_frame = clip_frames_stack.take_last()) {
                 remove_clip_frame(*clip_frame);
             }
         }
 
+        // NOTE: Commands are adjusted for the current scroll offsets below, so we work on a copy. The display list itself
+        //       is never modified, which allows several players to replay it at once (see TileRasterizer).
+        auto command = recorded_command;
+
         if (command.has<PaintScrollBar>()) {
             auto& paint_scroll_bar = command.get<PaintScrollBar>();
             auto scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
@@ -165,8 +542,7 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         }
 
         if (scroll_frame_id.has_value()) {
-            auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
-            auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
+            auto scroll_offset = device_scroll_offset(scroll_state, scroll_frame_id.value(), device_pixels_per_css_pixel);
             command.visit(
                 [&](auto& command) {
                     if constexpr (requires { command.translate_by(scroll_offset); }) {
@@ -92,11 +92,39 @@ public:
         Optional<i32> scroll_frame_id;
         RefPtr<ClipFrame const> clip_frame;
         DisplayListCommand command;
+        // Index into skippable_ranges() of the range starting at this command, if any.
+        Optional<u32> skippable_range_index {};
+    };
+
+    // A run of commands sharing one clip frame that draws only inside `bounding_rect` (before scroll offsets are
+    // applied) and leaves no state behind once it ends, so a player can jump straight to `end` if that rect is
+    // fully clipped.
+    struct SkippableRange {
+        size_t end { 0 };
+        Gfx::IntRect bounding_rect;
+        Optional<i32> scroll_frame_id;
     };
 
     AK::SegmentedVector<DisplayListCommandWithScrollAndClip, 512> const& commands() const { return m_commands; }
+    Vector<SkippableRange> const& skippable_ranges() const { return m_skippable_ranges; }
     double device_pixels_per_css_pixel() const { return m_device_pixels_per_css_pixel; }
 
+    // False if any command in this list (or in a list nested in it) reads back from the target surface or
+    // snapshots another surface. Such lists have to be replayed on a single canvas covering the whole target.
+    bool can_be_rasterized_in_tiles() const { return m_can_be_rasterized_in_tiles; }
+
+    struct ScrollDamage {
+        // Offset (in device pixels) by which previously rasterized pixels have to be shifted.
+        Gfx::IntPoint offset;
+        // Regions that have to be rasterized again after the shift, in device pixels.
+        Vector<Gfx::IntRect> rects;
+    };
+    // Determines how a frame rasterized from this list with `previous_scroll_state` can be turned into one for
+    // `scroll_state` by shifting its pixels and re-rasterizing only the regions whose content did not move along
+    // with the viewport (fixed-position content, scrollbars, other scroll containers) plus the newly exposed area.
+    // Returns an empty optional if the whole frame has to be rasterized again.
+    Optional<ScrollDamage> compute_scroll_damage(ScrollStateSnapshot const& previous_scroll_state, ScrollStateSnapshot const& scroll_state, Gfx::IntRect surface_rect) const;
+
     String dump() const;
 
 private:
@@ -105,8 +133,32 @@ private:
     {
     }
 
+    void update_skippable_ranges(DisplayListCommand const&, Optional<i32> scroll_frame_id, ClipFrame const*);
+    void add_skippable_range(size_t start, size_t end, Gfx::IntRect bounding_rect, Optional<i32> scroll_frame_id);
+    void close_open_run();
+
     AK::SegmentedVector<DisplayListCommandWithScrollAndClip, 512> m_commands;
+    Vector<SkippableRange> m_skippable_ranges;
     double m_device_pixels_per_css_pixel;
+    bool m_can_be_rasterized_in_tiles { true };
+
+    // Bookkeeping used while recording to find skippable ranges: one entry per open nesting level (the first one
+    // being the top level), and the run of consecutive drawing commands currently being collected.
+    struct RangeBuilder {
+        size_t start { 0 };
+        size_t end { 0 };
+        size_t command_count { 0 };
+        Gfx::IntRect bounding_rect;
+        Optional<i32> scroll_frame_id;
+        ClipFrame const* clip_frame { nullptr };
+        bool is_bounded { true };
+        bool opener_is_local { true };
+        bool coordinate_space_changed { false };
+
+        void add(Gfx::IntRect const&, Optional<i32> scroll_frame_id);
+    };
+    Vector<RangeBuilder> m_open_nesting_levels;
+    Optional<RangeBuilder> m_open_run;
 };
 
 }
@@ -12,6 +12,7 @@ namespace Web::Painting {
 void DrawGlyphRun::translate_by(Gfx::IntPoint const& offset)
 {
     rect.translate_by(offset);
+    ink_rect.translate_by(offset);
     translation.translate_by(offset.to_type<float>());
 }
 
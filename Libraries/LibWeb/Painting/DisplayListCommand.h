@@ -40,10 +40,13 @@ struct DrawGlyphRun {
     NonnullRefPtr<Gfx::GlyphRun const> glyph_run;
     double scale { 1 };
     Gfx::IntRect rect;
+    // The area the glyphs actually draw into, which may extend past the fragment rect (e.g. for italics or diacritics).
+    Gfx::IntRect ink_rect;
     Gfx::FloatPoint translation;
     Color color;
     Gfx::Orientation orientation { Gfx::Orientation::Horizontal };
 
+    [[nodiscard]] Gfx::IntRect bounding_rect() const { return ink_rect; }
     void translate_by(Gfx::IntPoint const& offset);
     void dump(StringBuilder&) const;
 };
@@ -239,10 +239,24 @@ void DisplayListRecorder::draw_glyph_run(Gfx::FloatPoint baseline_start, Gfx::Gl
 {
     if (color.alpha() == 0)
         return;
+
+    auto ink_rect = glyph_run.ink_bounding_rect(scale).translated(baseline_start);
+    if (orientation == Orientation::Vertical && !ink_rect.is_empty()) {
+        // Vertical runs are rotated by 90 degrees around the top left corner of the fragment rect, and then moved
+        // right by its width (see DisplayListPlayerSkia::draw_glyph_run()).
+        auto origin = rect.top_left().to_type<float>();
+        auto width = static_cast<float>(rect.width());
+        ink_rect = Gfx::FloatRect::from_two_points(
+            { origin.x() + width - (ink_rect.bottom() - origin.y()), origin.y() + (ink_rect.left() - origin.x()) },
+            { origin.x() + width - (ink_rect.top() - origin.y()), origin.y() + (ink_rect.right() - origin.x()) });
+    }
+
     APPEND(DrawGlyphRun {
         .glyph_run = glyph_run,
         .scale = scale,
         .rect = rect,
+        // Leave room for anti-aliasing, which may touch pixels just outside the glyph outlines.
+        .ink_rect = ink_rect.is_empty() ? Gfx::IntRect {} : enclosing_int_rect(ink_rect).inflated(2, 2),
         .translation = baseline_start,
         .color = color,
         .orientation = orientation,
@@ -13,8 +13,24 @@ namespace Web::Painting {
 
 class ScrollStateSnapshot {
 public:
+    struct Entry {
+        CSSPixelPoint cumulative_offset;
+        CSSPixelPoint own_offset;
+
+        bool operator==(Entry const&) const = default;
+    };
+
     static ScrollStateSnapshot create(Vector<NonnullRefPtr<ScrollFrame>> const& scroll_frames);
 
+    // Creates a snapshot from the offsets of each scroll frame, indexed by their ID. Useful for replaying a display list
+    // without the paintable tree it was recorded from.
+    static ScrollStateSnapshot create_from_entries(Vector<Entry> entries)
+    {
+        ScrollStateSnapshot snapshot;
+        snapshot.entries = move(entries);
+        return snapshot;
+    }
+
     CSSPixelPoint cumulative_offset_for_frame_with_id(size_t id) const
     {
         if (id >= entries.size())
@@ -29,11 +45,9 @@ public:
         return entries[id].own_offset;
     }
 
+    bool operator==(ScrollStateSnapshot const&) const = default;
+
 private:
-    struct Entry {
-        CSSPixelPoint cumulative_offset;
-        CSSPixelPoint own_offset;
-    };
     Vector<Entry> entries;
 };
 
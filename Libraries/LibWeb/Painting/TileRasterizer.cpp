@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibCore/System.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TileRasterizer.h>
+
+namespace Web::Painting {
+
+static constexpr size_t max_worker_count = 7;
+
+size_t TileRasterizer::default_worker_count()
+{
+    return min(static_cast<size_t>(max(Core::System::hardware_concurrency(), 1u)) - 1, max_worker_count);
+}
+
+TileRasterizer::TileRasterizer(size_t worker_count)
+    : m_worker_count(worker_count)
+    , m_player(make<DisplayListPlayerSkia>())
+{
+}
+
+TileRasterizer::~TileRasterizer() = default;
+
+void TileRasterizer::ensure_workers()
+{
+    if (m_workers_initialized)
+        return;
+    m_workers_initialized = true;
+
+    for (size_t i = 0; i < m_worker_count; ++i) {
+        auto thread_or_error = Threading::WorkerThread<Error>::create("Tile Rasterizer"sv);
+        if (thread_or_error.is_error()) {
+            dbgln("Failed to create tile rasterization thread: {}", thread_or_error.error());
+            break;
+        }
+        m_workers.append({ thread_or_error.release_value(), make<DisplayListPlayerSkia>() });
+    }
+}
+
+void TileRasterizer::rasterize(DisplayList& display_list, ScrollStateSnapshotByDisplayList const& scroll_state_snapshot_by_display_list, Gfx::PaintingSurface& surface, Vector<Gfx::IntRect> const& regions)
+{
+    VERIFY(display_list.can_be_rasterized_in_tiles());
+
+    Vector<NonnullRefPtr<Gfx::PaintingSurface>> tiles;
+    for (auto const& region : regions) {
+        for (int y = region.top(); y < region.bottom(); y += tile_size) {
+            for (int x = region.left(); x < region.right(); x += tile_size) {
+                Gfx::IntRect tile { x, y, tile_size, tile_size };
+                auto tile_surface = surface.create_view_for_region(tile.intersected(region));
+                VERIFY(tile_surface);
+                tiles.append(tile_surface.release_nonnull());
+            }
+        }
+    }
+
+    if (tiles.is_empty()) {
+        surface.flush();
+        return;
+    }
+
+    // Waking up the workers is not worth it for a single tile.
+    if (tiles.size() > 1)
+        ensure_workers();
+    auto workers = tiles.size() > 1 ? m_workers.span() : Span<Worker> {};
+
+    // Tiles are handed out one at a time, so that threads that got cheap tiles (e.g. empty background) move on
+    // to the next one instead of idling while others are busy with text-heavy regions.
+    Atomic<size_t> next_tile_index { 0 };
+    auto rasterize_tiles = [&](DisplayListPlayerSkia& player) {
+        while (true) {
+            auto tile_index = next_tile_index.fetch_add(1);
+            if (tile_index >= tiles.size())
+                return;
+            // Each replay needs its own copy, since the player consumes the snapshots.
+            auto snapshots = scroll_state_snapshot_by_display_list;
+            player.execute(display_list, move(snapshots), tiles[tile_index]);
+        }
+    };
+
+    for (auto& worker : workers) {
+        auto started = worker.thread->start_task([&rasterize_tiles, &player = *worker.player]() -> ErrorOr<void> {
+            rasterize_tiles(player);
+            return {};
+        });
+        VERIFY(started);
+    }
+
+    rasterize_tiles(*m_player);
+
+    for (auto& worker : workers)
+        MUST(worker.thread->wait_until_task_is_finished());
+
+    surface.flush();
+}
+
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Rect.h>
+#include <LibThreading/WorkerThread.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Painting {
+
+// Replays display lists into CPU-backed surfaces in tiles, spread across a small pool of worker threads. The calling
+// thread always takes tiles as well, so a rasterizer without workers simply replays all tiles one after another.
+//
+// NOTE: All threads replay the same display list at once. This relies on players never modifying the display list:
+//       commands that have to be adjusted for scroll offsets are copied first, and everything a command refers to is
+//       immutable and atomically reference counted (see DisplayListPlayer::execute_impl()). Each thread uses its own
+//       player and draws through its own view of the target surface's pixels.
+class TileRasterizer {
+    AK_MAKE_NONCOPYABLE(TileRasterizer);
+    AK_MAKE_NONMOVABLE(TileRasterizer);
+
+public:
+    static constexpr int tile_size = 512;
+
+    static size_t default_worker_count();
+
+    explicit TileRasterizer(size_t worker_count = default_worker_count());
+    ~TileRasterizer();
+
+    // Rasterizes the given regions of the surface (in device pixels), leaving all other pixels untouched. The display
+    // list has to be one that can be rasterized in tiles, and the surface has to be backed by a CPU bitmap.
+    void rasterize(DisplayList&, ScrollStateSnapshotByDisplayList const&, Gfx::PaintingSurface&, Vector<Gfx::IntRect> const& regions);
+
+private:
+    void ensure_workers();
+
+    struct Worker {
+        NonnullOwnPtr<Threading::WorkerThread<Error>> thread;
+        NonnullOwnPtr<DisplayListPlayerSkia> player;
+    };
+
+    size_t m_worker_count { 0 };
+    Vector<Worker> m_workers;
+    bool m_workers_initialized { false };
+
+    NonnullOwnPtr<DisplayListPlayerSkia> m_player;
+};
+
+}
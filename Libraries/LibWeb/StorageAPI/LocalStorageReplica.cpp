@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <LibGC/Function.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/StorageAPI/LocalStorageReplica.h>
+#include <LibWeb/StorageAPI/StorageEndpoint.h>
+
+namespace Web::StorageAPI {
+
+static HashMap<String, LocalStorageReplica*>& all_replicas()
+{
+    static HashMap<String, LocalStorageReplica*> replicas;
+    return replicas;
+}
+
+NonnullRefPtr<LocalStorageReplica> LocalStorageReplica::for_storage_key(String const& storage_key)
+{
+    if (auto replica = all_replicas().get(storage_key); replica.has_value())
+        return **replica;
+
+    auto replica = adopt_ref(*new LocalStorageReplica(storage_key));
+    all_replicas().set(storage_key, replica.ptr());
+    return replica;
+}
+
+LocalStorageReplica::LocalStorageReplica(String storage_key)
+    : m_storage_key(move(storage_key))
+{
+}
+
+LocalStorageReplica::~LocalStorageReplica()
+{
+    all_replicas().remove(m_storage_key);
+}
+
+void LocalStorageReplica::apply_changes_from_other_process(String const& storage_key, Vector<String> const& removed_key_prefixes, HashMap<String, Optional<String>> const& items)
+{
+    auto replica = all_replicas().get(storage_key);
+    if (!replica.has_value() || !(*replica)->m_is_loaded)
+        return;
+
+    auto& self = **replica;
+
+    if (!removed_key_prefixes.is_empty()) {
+        Vector<String> removed_keys;
+        for (auto const& [key, value] : self.m_items) {
+            if (self.has_unapplied_change(key))
+                continue;
+            if (any_of(removed_key_prefixes, [&](auto const& prefix) { return key.starts_with_bytes(prefix); }))
+                removed_keys.append(key);
+        }
+
+        for (auto const& key : removed_keys)
+            self.remove_item_from_replica(key);
+    }
+
+    for (auto const& [key, value] : items) {
+        if (self.has_unapplied_change(key))
+            continue;
+
+        if (value.has_value())
+            self.set_item_in_replica(key, *value);
+        else
+            self.remove_item_from_replica(key);
+    }
+}
+
+void LocalStorageReplica::did_write_back_changes(String const& storage_key, bool were_applied)
+{
+    auto replica = all_replicas().get(storage_key);
+    if (!replica.has_value() || (*replica)->m_unapplied_batches.is_empty())
+        return;
+
+    auto& self = **replica;
+    self.m_unapplied_batches.take_first();
+    if (!were_applied)
+        self.m_has_rejected_batch = true;
+
+    if (!self.m_unapplied_batches.is_empty())
+        return;
+
+    // NOTE: Once nothing is left in flight, the items are loaded again on next access, so that the replica matches the
+    //       storage jar again.
+    if (self.m_has_rejected_batch) {
+        self.m_has_rejected_batch = false;
+        self.m_is_loaded = false;
+        self.m_items.clear();
+        self.m_size_in_bytes = 0;
+    }
+
+    // NOTE: This may destroy the replica.
+    self.m_self_while_batches_are_unapplied = nullptr;
+}
+
+// NOTE: The storage jar applies changes in the order in which it receives them. If this replica has changed an item in
+//       a batch that the storage jar has yet to apply, or has not even written it back yet, that change will overwrite
+//       any change that the storage jar has applied before it. So we keep our own state of that item.
+bool LocalStorageReplica::has_unapplied_change(String const& key) const
+{
+    if (m_has_pending_clear || m_pending_items.contains(key))
+        return true;
+
+    return any_of(m_unapplied_batches, [&](auto const& batch) {
+        return batch.has_clear || batch.keys.contains(key);
+    });
+}
+
+void LocalStorageReplica::ensure_loaded(Page& page)
+{
+    if (m_is_loaded)
+        return;
+
+    // NOTE: Every key starts with the empty prefix, so this loads all items of the storage key at once. A pending clear
+    //       will remove them anyway.
+    if (!m_has_pending_clear) {
+        auto items = page.client().page_did_request_storage_items_with_prefix(StorageEndpointType::LocalStorage, m_storage_key, String {});
+        for (auto& [key, value] : items)
+            set_item_in_replica(key, value);
+    }
+
+    // NOTE: When loading again after the storage jar rejected a batch, changes that have yet to be written back still
+    //       take precedence over the items of the storage jar.
+    for (auto const& [key, value] : m_pending_items) {
+        if (value.has_value())
+            set_item_in_replica(key, *value);
+        else
+            remove_item_from_replica(key);
+    }
+
+    m_is_loaded = true;
+}
+
+size_t LocalStorageReplica::size(Page& page)
+{
+    ensure_loaded(page);
+    return m_items.size();
+}
+
+Vector<String> LocalStorageReplica::keys(Page& page)
+{
+    ensure_loaded(page);
+    return m_items.keys();
+}
+
+Optional<String> LocalStorageReplica::get(Page& page, String const& key)
+{
+    ensure_loaded(page);
+
+    if (auto value = m_items.get(key); value.has_value())
+        return value.value();
+    return OptionalNone {};
+}
+
+WebView::StorageOperationError LocalStorageReplica::set(Page& page, String const& key, String const& value, Optional<u64> quota)
+{
+    ensure_loaded(page);
+
+    if (quota.has_value()) {
+        u64 current_size = m_size_in_bytes;
+        if (auto existing_value = m_items.get(key); existing_value.has_value())
+            current_size -= key.bytes().size() + existing_value->bytes().size();
+
+        u64 new_size = key.bytes().size() + value.bytes().size();
+        if (current_size + new_size > quota.value())
+            return WebView::StorageOperationError::QuotaExceededError;
+    }
+
+    set_item_in_replica(key, value);
+    did_change_item(page, key, value);
+    return WebView::StorageOperationError::None;
+}
+
+void LocalStorageReplica::clear(Page& page)
+{
+    ensure_loaded(page);
+
+    m_items.clear();
+    m_size_in_bytes = 0;
+
+    // NOTE: Clearing the storage jar also takes care of any items that have not been written back yet.
+    m_has_pending_clear = true;
+    m_pending_items.clear();
+    write_back(page);
+}
+
+void LocalStorageReplica::remove(Page& page, String const& key)
+{
+    ensure_loaded(page);
+
+    remove_item_from_replica(key);
+    did_change_item(page, key, {});
+}
+
+void LocalStorageReplica::set_item_in_replica(String const& key, String const& value)
+{
+    if (auto existing_value = m_items.get(key); existing_value.has_value())
+        m_size_in_bytes -= key.bytes().size() + existing_value->bytes().size();
+
+    m_size_in_bytes += key.bytes().size() + value.bytes().size();
+    m_items.set(key, value);
+}
+
+void LocalStorageReplica::remove_item_from_replica(String const& key)
+{
+    auto existing_value = m_items.take(key);
+    if (existing_value.has_value())
+        m_size_in_bytes -= key.bytes().size() + existing_value->bytes().size();
+}
+
+void LocalStorageReplica::did_change_item(Page& page, String const& key, Optional<String> value)
+{
+    m_pending_items.set(key, move(value));
+    write_back(page);
+}
+
+void LocalStorageReplica::write_back(Page& page)
+{
+    if (m_write_back_is_scheduled)
+        return;
+    m_write_back_is_scheduled = true;
+
+    // NOTE: Writing back is deferred until the end of the current task, so that all changes made by the task are sent
+    //       to the storage jar in a single batch.
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(page.heap(), [self = NonnullRefPtr { *this }, page = GC::Ref { page }] {
+        self->m_write_back_is_scheduled = false;
+
+        Vector<String> removed_key_prefixes;
+        if (self->m_has_pending_clear)
+            removed_key_prefixes.append(String {});
+
+        page->client().page_did_update_storage_items(StorageEndpointType::LocalStorage, self->m_storage_key, removed_key_prefixes, self->m_pending_items);
+
+        WrittenBackBatch batch { .has_clear = self->m_has_pending_clear, .keys = {} };
+        for (auto const& [key, value] : self->m_pending_items)
+            batch.keys.set(key);
+        self->m_unapplied_batches.append(move(batch));
+        self->m_self_while_batches_are_unapplied = self;
+
+        self->m_has_pending_clear = false;
+        self->m_pending_items.clear();
+    }));
+}
+
+}
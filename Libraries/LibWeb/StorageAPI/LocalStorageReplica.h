@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/RefCounted.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibWeb/Forward.h>
+#include <LibWebView/StorageOperationError.h>
+
+namespace Web::StorageAPI {
+
+// The local storage of a storage key is kept by the storage jar in the browser process. To avoid an IPC round trip for
+// every access, each WebContent process keeps a replica of it, which is shared by all local storage bottles of that
+// storage key in the process.
+//
+// The replica is loaded with a single request on first access, and serves all reads from memory afterwards. Writes
+// are applied to the replica immediately, and then written back to the storage jar in a batch at the end of the
+// current task, without waiting for the storage jar to finish writing them.
+//
+// Changes that were written back by other WebContent processes are forwarded to the replica by the browser process, in
+// the order in which the storage jar applied them. The browser process also lets the replica know once the storage jar
+// has applied each of its own batches. A write that is not known to have been applied yet will be applied after any
+// forwarded change, so it takes precedence over it. This way, all replicas end up with the same items as the storage jar.
+//
+// The storage jar rejects a batch that would make the items exceed the quota, which may happen when several processes
+// write to the same storage key at once. The replica is then loaded again once all of its batches have been applied.
+class LocalStorageReplica : public RefCounted<LocalStorageReplica> {
+public:
+    static NonnullRefPtr<LocalStorageReplica> for_storage_key(String const& storage_key);
+    ~LocalStorageReplica();
+
+    static void apply_changes_from_other_process(String const& storage_key, Vector<String> const& removed_key_prefixes, HashMap<String, Optional<String>> const& items);
+    static void did_write_back_changes(String const& storage_key, bool were_applied);
+
+    size_t size(Page&);
+    Vector<String> keys(Page&);
+    Optional<String> get(Page&, String const& key);
+    WebView::StorageOperationError set(Page&, String const& key, String const& value, Optional<u64> quota);
+    void clear(Page&);
+    void remove(Page&, String const& key);
+
+private:
+    explicit LocalStorageReplica(String storage_key);
+
+    void ensure_loaded(Page&);
+    void did_change_item(Page&, String const& key, Optional<String> value);
+    void write_back(Page&);
+
+    void set_item_in_replica(String const& key, String const& value);
+    void remove_item_from_replica(String const& key);
+
+    bool has_unapplied_change(String const& key) const;
+
+    String m_storage_key;
+
+    bool m_is_loaded { false };
+    OrderedHashMap<String, String> m_items;
+
+    // The combined size of all keys and values in the replica, in bytes, which is what the quota applies to.
+    u64 m_size_in_bytes { 0 };
+
+    // The changes that have not been written back to the storage jar yet.
+    bool m_has_pending_clear { false };
+    HashMap<String, Optional<String>> m_pending_items;
+    bool m_write_back_is_scheduled { false };
+
+    // The changes that were written back, but that the storage jar is not known to have applied yet, oldest first.
+    struct WrittenBackBatch {
+        bool has_clear { false };
+        HashTable<String> keys;
+    };
+    Vector<WrittenBackBatch> m_unapplied_batches;
+
+    // Whether the storage jar rejected one of the written back batches, so that the replica has items it doesn't have.
+    bool m_has_rejected_batch { false };
+
+    // NOTE: The replica is kept alive until the storage jar has applied all of its batches, so that a replica that is
+    //       created for the same storage key in the meantime doesn't mistake them for its own.
+    RefPtr<LocalStorageReplica> m_self_while_batches_are_unapplied;
+};
+
+}
@@ -12,6 +12,7 @@
 #include <LibGC/Ptr.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/StorageAPI/LocalStorageReplica.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
 #include <LibWeb/StorageAPI/StorageKey.h>
 #include <LibWeb/StorageAPI/StorageType.h>
@@ -73,11 +74,15 @@ private:
         : StorageBottle(quota)
         , m_page(move(page))
         , m_storage_key(move(key))
+        , m_replica(LocalStorageReplica::for_storage_key(m_storage_key.to_string()))
     {
     }
 
     GC::Ref<Page> m_page;
     StorageKey m_storage_key;
+
+    // NOTE: The bottle's map is the storage jar in the browser process, which is accessed through this process' replica of it.
+    NonnullRefPtr<LocalStorageReplica> m_replica;
 };
 
 class SessionStorageBottle final : public StorageBottle {
@@ -933,4 +933,29 @@ void Application::request_console_messages(DevTools::TabDescription const& descr
     view->js_console_request_messages(start_index);
 }
 
+void Application::start_js_profiler(DevTools::TabDescription const& description) const
+{
+    auto view = ViewImplementation::find_view_by_id(description.id);
+    if (!view.has_value())
+        return;
+
+    view->start_js_profiler();
+}
+
+void Application::stop_js_profiler(DevTools::TabDescription const& description, OnJSProfileReceived on_complete) const
+{
+    auto view = ViewImplementation::find_view_by_id(description.id);
+    if (!view.has_value()) {
+        on_complete(Error::from_string_literal("Unable to locate tab"));
+        return;
+    }
+
+    view->stop_js_profiler([on_complete = move(on_complete)](ErrorOr<String> profile) {
+        if (profile.is_error())
+            on_complete(profile.release_error());
+        else
+            on_complete(JsonValue::from_string(profile.value()));
+    });
+}
+
 }
@@ -122,6 +122,8 @@ private:
     virtual void listen_for_console_messages(DevTools::TabDescription const&, OnConsoleMessageAvailable, OnReceivedConsoleMessages) const override;
     virtual void stop_listening_for_console_messages(DevTools::TabDescription const&) const override;
     virtual void request_console_messages(DevTools::TabDescription const&, i32) const override;
+    virtual void start_js_profiler(DevTools::TabDescription const&) const override;
+    virtual void stop_js_profiler(DevTools::TabDescription const&, OnJSProfileReceived) const override;
 
     static Application* s_the;
 
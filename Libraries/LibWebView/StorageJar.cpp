@@ -4,8 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StdLibExtras.h>
+#include <AK/StringBuilder.h>
 #include <LibWebView/StorageJar.h>
 
 namespace WebView {
@@ -33,10 +35,55 @@ ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database& database)
     statements.clear = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
     statements.get_keys = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
     statements.calculate_size_excluding_key = TRY(database.prepare_statement("SELECT SUM(LENGTH(bottle_key) + LENGTH(bottle_value)) FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key != ?;"sv));
+    statements.calculate_size = TRY(database.prepare_statement("SELECT SUM(LENGTH(bottle_key) + LENGTH(bottle_value)) FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
+
+    // NOTE: Items with a given prefix are looked up as the range of keys from the prefix up to its successor, so that the
+    //       primary key index can be used for them.
+    statements.get_items_in_range = TRY(database.prepare_statement("SELECT bottle_key, bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key >= ? AND bottle_key < ?;"sv));
+    statements.get_items_from = TRY(database.prepare_statement("SELECT bottle_key, bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key >= ?;"sv));
+    statements.get_keys_in_range = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key >= ? AND bottle_key < ?;"sv));
+    statements.get_keys_from = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key >= ?;"sv));
+    statements.delete_items_in_range = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key >= ? AND bottle_key < ?;"sv));
+    statements.delete_items_from = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key >= ?;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
+    statements.rollback_transaction = TRY(database.prepare_statement("ROLLBACK;"sv));
 
     return adopt_own(*new StorageJar { PersistedStorage { database, statements } });
 }
 
+// Returns the smallest string that is greater than every string starting with prefix, if there is one. Strings are
+// compared by their UTF-8 bytes, which orders them in the same way as their code points.
+static Optional<String> successor_of_prefix(String const& prefix)
+{
+    Vector<u32> code_points;
+    for (auto code_point : prefix.code_points())
+        code_points.append(code_point);
+
+    while (!code_points.is_empty() && code_points.last() == 0x10FFFF)
+        code_points.take_last();
+    if (code_points.is_empty())
+        return {};
+
+    // NOTE: Surrogates can't be encoded in UTF-8, so the code point after the last one before them comes after them.
+    auto& last_code_point = code_points.last();
+    last_code_point = last_code_point == 0xD7FF ? 0xE000 : last_code_point + 1;
+
+    StringBuilder builder;
+    for (auto code_point : code_points)
+        builder.append_code_point(code_point);
+    return builder.to_string_without_validation();
+}
+
+static Optional<u64> quota_for_storage_endpoint(StorageEndpointType storage_endpoint)
+{
+    for (auto const& endpoint : Web::StorageAPI::StorageEndpoint::registered_endpoints()) {
+        if (endpoint.identifier == storage_endpoint)
+            return endpoint.quota;
+    }
+    return {};
+}
+
 NonnullOwnPtr<StorageJar> StorageJar::create()
 {
     return adopt_own(*new StorageJar { OptionalNone {} });
@@ -91,6 +138,53 @@ Vector<String> StorageJar::get_all_keys(StorageEndpointType storage_endpoint, St
     return m_transient_storage.get_keys(storage_endpoint, storage_key);
 }
 
+HashMap<String, String> StorageJar::get_items_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix)
+{
+    if (m_persisted_storage.has_value())
+        return m_persisted_storage->get_items_with_prefix(storage_endpoint, storage_key, bottle_key_prefix);
+    return m_transient_storage.get_items_with_prefix(storage_endpoint, storage_key, bottle_key_prefix);
+}
+
+Vector<String> StorageJar::get_keys_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix)
+{
+    if (m_persisted_storage.has_value())
+        return m_persisted_storage->get_keys_with_prefix(storage_endpoint, storage_key, bottle_key_prefix);
+    return m_transient_storage.get_keys_with_prefix(storage_endpoint, storage_key, bottle_key_prefix);
+}
+
+Vector<Optional<String>> StorageJar::get_items(StorageEndpointType storage_endpoint, String const& storage_key, ReadonlySpan<String> bottle_keys)
+{
+    Vector<Optional<String>> values;
+    values.ensure_capacity(bottle_keys.size());
+    for (auto const& bottle_key : bottle_keys)
+        values.unchecked_append(get_item(storage_endpoint, storage_key, bottle_key));
+    return values;
+}
+
+StorageOperationError StorageJar::update_items(StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& removed_bottle_key_prefixes, HashMap<String, Optional<String>> const& items)
+{
+    auto quota = quota_for_storage_endpoint(storage_endpoint);
+    if (m_persisted_storage.has_value())
+        return m_persisted_storage->update_items(storage_endpoint, storage_key, removed_bottle_key_prefixes, items, quota);
+    return m_transient_storage.update_items(storage_endpoint, storage_key, removed_bottle_key_prefixes, items, quota);
+}
+
+u64 StorageJar::advance_counter(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, u64 minimum, u64 increment)
+{
+    u64 current_number = 0;
+    if (auto value = get_item(storage_endpoint, storage_key, bottle_key); value.has_value())
+        current_number = value->to_number<u64>().value_or(0);
+
+    auto number = max(current_number, minimum);
+    if (number + increment != current_number) {
+        HashMap<String, Optional<String>> items;
+        items.set(bottle_key, String::number(number + increment));
+        update_items(storage_endpoint, storage_key, {}, items);
+    }
+
+    return number;
+}
+
 StorageOperationError StorageJar::PersistedStorage::set_item(StorageLocation const& key, String const& value)
 {
     size_t current_size = 0;
@@ -165,6 +259,83 @@ Vector<String> StorageJar::PersistedStorage::get_keys(StorageEndpointType storag
     return keys;
 }
 
+HashMap<String, String> StorageJar::PersistedStorage::get_items_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix)
+{
+    HashMap<String, String> items;
+    Database::OnResult on_result = [&](auto statement_id) {
+        items.set(database.result_column<String>(statement_id, 0), database.result_column<String>(statement_id, 1));
+    };
+
+    if (auto successor = successor_of_prefix(bottle_key_prefix); successor.has_value())
+        database.execute_statement(statements.get_items_in_range, move(on_result), static_cast<int>(to_underlying(storage_endpoint)), storage_key, bottle_key_prefix, *successor);
+    else
+        database.execute_statement(statements.get_items_from, move(on_result), static_cast<int>(to_underlying(storage_endpoint)), storage_key, bottle_key_prefix);
+    return items;
+}
+
+Vector<String> StorageJar::PersistedStorage::get_keys_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix)
+{
+    Vector<String> keys;
+    Database::OnResult on_result = [&](auto statement_id) {
+        keys.append(database.result_column<String>(statement_id, 0));
+    };
+
+    if (auto successor = successor_of_prefix(bottle_key_prefix); successor.has_value())
+        database.execute_statement(statements.get_keys_in_range, move(on_result), static_cast<int>(to_underlying(storage_endpoint)), storage_key, bottle_key_prefix, *successor);
+    else
+        database.execute_statement(statements.get_keys_from, move(on_result), static_cast<int>(to_underlying(storage_endpoint)), storage_key, bottle_key_prefix);
+    return keys;
+}
+
+StorageOperationError StorageJar::PersistedStorage::update_items(StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& removed_bottle_key_prefixes, HashMap<String, Optional<String>> const& items, Optional<u64> quota)
+{
+    // Write the whole batch in a single transaction, rather than syncing each statement to disk on its own.
+    database.execute_statement(statements.begin_transaction, {});
+
+    for (auto const& prefix : removed_bottle_key_prefixes) {
+        if (auto successor = successor_of_prefix(prefix); successor.has_value())
+            database.execute_statement(statements.delete_items_in_range, {}, static_cast<int>(to_underlying(storage_endpoint)), storage_key, prefix, *successor);
+        else
+            database.execute_statement(statements.delete_items_from, {}, static_cast<int>(to_underlying(storage_endpoint)), storage_key, prefix);
+    }
+
+    for (auto const& [bottle_key, value] : items) {
+        StorageLocation storage_location { storage_endpoint, storage_key, bottle_key };
+        if (!value.has_value()) {
+            delete_item(storage_location);
+            continue;
+        }
+
+        database.execute_statement(
+            statements.set_item,
+            {},
+            static_cast<int>(to_underlying(storage_endpoint)),
+            storage_key,
+            bottle_key,
+            *value);
+    }
+
+    // NOTE: The batch is applied as a whole or not at all, so it is rolled back if the items end up exceeding the quota.
+    if (quota.has_value()) {
+        u64 size = 0;
+        database.execute_statement(
+            statements.calculate_size,
+            [&](auto statement_id) {
+                size = database.result_column<int>(statement_id, 0);
+            },
+            static_cast<int>(to_underlying(storage_endpoint)),
+            storage_key);
+
+        if (size > *quota) {
+            database.execute_statement(statements.rollback_transaction, {});
+            return StorageOperationError::QuotaExceededError;
+        }
+    }
+
+    database.execute_statement(statements.commit_transaction, {});
+    return StorageOperationError::None;
+}
+
 StorageOperationError StorageJar::TransientStorage::set_item(StorageLocation const& key, String const& value)
 {
     u64 current_size = 0;
@@ -219,4 +390,65 @@ Vector<String> StorageJar::TransientStorage::get_keys(StorageEndpointType storag
     return keys;
 }
 
+HashMap<String, String> StorageJar::TransientStorage::get_items_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix)
+{
+    HashMap<String, String> items;
+    for (auto const& [key, value] : m_storage_items) {
+        if (key.storage_endpoint == storage_endpoint && key.storage_key == storage_key && key.bottle_key.starts_with_bytes(bottle_key_prefix))
+            items.set(key.bottle_key, value);
+    }
+    return items;
+}
+
+Vector<String> StorageJar::TransientStorage::get_keys_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix)
+{
+    Vector<String> keys;
+    for (auto const& [key, value] : m_storage_items) {
+        if (key.storage_endpoint == storage_endpoint && key.storage_key == storage_key && key.bottle_key.starts_with_bytes(bottle_key_prefix))
+            keys.append(key.bottle_key);
+    }
+    return keys;
+}
+
+StorageOperationError StorageJar::TransientStorage::update_items(StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& removed_bottle_key_prefixes, HashMap<String, Optional<String>> const& items, Optional<u64> quota)
+{
+    auto is_removed_by_prefix = [&](StorageLocation const& key) {
+        if (key.storage_endpoint != storage_endpoint || key.storage_key != storage_key)
+            return false;
+        return any_of(removed_bottle_key_prefixes, [&](auto const& prefix) { return key.bottle_key.starts_with_bytes(prefix); });
+    };
+
+    // NOTE: The batch is applied as a whole or not at all, so the size that the items would end up with is checked first.
+    if (quota.has_value()) {
+        u64 size = 0;
+        for (auto const& [key, value] : m_storage_items) {
+            if (key.storage_endpoint != storage_endpoint || key.storage_key != storage_key)
+                continue;
+            if (is_removed_by_prefix(key) || items.contains(key.bottle_key))
+                continue;
+            size += key.bottle_key.bytes().size() + value.bytes().size();
+        }
+        for (auto const& [bottle_key, value] : items) {
+            if (value.has_value())
+                size += bottle_key.bytes().size() + value->bytes().size();
+        }
+
+        if (size > *quota)
+            return StorageOperationError::QuotaExceededError;
+    }
+
+    if (!removed_bottle_key_prefixes.is_empty())
+        m_storage_items.remove_all_matching([&](auto const& key, auto const&) { return is_removed_by_prefix(key); });
+
+    for (auto const& [bottle_key, value] : items) {
+        StorageLocation storage_location { storage_endpoint, storage_key, bottle_key };
+        if (value.has_value())
+            m_storage_items.set(move(storage_location), *value);
+        else
+            m_storage_items.remove(storage_location);
+    }
+
+    return StorageOperationError::None;
+}
+
 }
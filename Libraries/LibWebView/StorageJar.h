@@ -42,6 +42,21 @@ public:
     void clear_storage_key(StorageEndpointType storage_endpoint, String const& storage_key);
     Vector<String> get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key);
 
+    HashMap<String, String> get_items_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix);
+    Vector<String> get_keys_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix);
+    Vector<Optional<String>> get_items(StorageEndpointType storage_endpoint, String const& storage_key, ReadonlySpan<String> bottle_keys);
+
+    // Applies a batch of changes to the items of a storage key at once. First, every item whose key starts with one of
+    // the removed prefixes is removed. Then, each item in the map is set to its new value, or removed if it has none.
+    // If the items of the storage key would end up exceeding the quota of the storage endpoint, none of the changes are
+    // applied.
+    StorageOperationError update_items(StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& removed_bottle_key_prefixes, HashMap<String, Optional<String>> const& items);
+
+    // Uses an item as a counter. Takes the larger of the number it holds (or 0 if it doesn't exist) and minimum, stores
+    // that number plus increment in the item, and returns the number that was taken. As the storage jar handles one
+    // request at a time, processes that share a counter never take the same number from it.
+    u64 advance_counter(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, u64 minimum, u64 increment);
+
 private:
     struct Statements {
         Database::StatementID set_item { 0 };
@@ -50,6 +65,16 @@ private:
         Database::StatementID clear { 0 };
         Database::StatementID get_keys { 0 };
         Database::StatementID calculate_size_excluding_key { 0 };
+        Database::StatementID calculate_size { 0 };
+        Database::StatementID get_items_in_range { 0 };
+        Database::StatementID get_items_from { 0 };
+        Database::StatementID get_keys_in_range { 0 };
+        Database::StatementID get_keys_from { 0 };
+        Database::StatementID delete_items_in_range { 0 };
+        Database::StatementID delete_items_from { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
+        Database::StatementID rollback_transaction { 0 };
     };
 
     class TransientStorage {
@@ -59,6 +84,9 @@ private:
         void delete_item(StorageLocation const& key);
         void clear(StorageEndpointType storage_endpoint, String const& storage_key);
         Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+        HashMap<String, String> get_items_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix);
+        Vector<String> get_keys_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix);
+        StorageOperationError update_items(StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& removed_bottle_key_prefixes, HashMap<String, Optional<String>> const& items, Optional<u64> quota);
 
     private:
         HashMap<StorageLocation, String> m_storage_items;
@@ -70,6 +98,9 @@ private:
         void delete_item(StorageLocation const& key);
         void clear(StorageEndpointType storage_endpoint, String const& storage_key);
         Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+        HashMap<String, String> get_items_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix);
+        Vector<String> get_keys_with_prefix(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix);
+        StorageOperationError update_items(StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& removed_bottle_key_prefixes, HashMap<String, Optional<String>> const& items, Optional<u64> quota);
 
         Database& database;
         Statements statements;
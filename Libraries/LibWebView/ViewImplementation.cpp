@@ -406,6 +406,29 @@ void ViewImplementation::request_style_sheet_source(Web::CSS::StyleSheetIdentifi
     client().async_request_style_sheet_source(page_id(), identifier);
 }
 
+void ViewImplementation::start_js_profiler()
+{
+    client().async_start_js_profiler(page_id());
+}
+
+void ViewImplementation::stop_js_profiler(OnJSProfileReceived on_complete)
+{
+    m_pending_js_profile_callbacks.enqueue(move(on_complete));
+    client().async_stop_js_profiler(page_id());
+}
+
+void ViewImplementation::did_receive_js_profile(Badge<WebContentClient>, Optional<String> const& profile)
+{
+    if (m_pending_js_profile_callbacks.is_empty())
+        return;
+
+    auto on_complete = m_pending_js_profile_callbacks.dequeue();
+    if (profile.has_value())
+        on_complete(*profile);
+    else
+        on_complete(Error::from_string_literal("The JS profiler was not running"));
+}
+
 void ViewImplementation::debug_request(ByteString const& request, ByteString const& argument)
 {
     client().async_debug_request(page_id(), request, argument);
@@ -611,6 +634,10 @@ void ViewImplementation::handle_web_content_process_crash(LoadErrorPage load_err
     dbgln("\033[31;1mWebContent process crashed!\033[0m Last page loaded: {}", m_url);
     dbgln("Consider raising an issue at https://github.com/LadybirdBrowser/ladybird/issues/new/choose");
 
+    // The crashed process will never reply to the requests that are still pending.
+    while (!m_pending_js_profile_callbacks.is_empty())
+        m_pending_js_profile_callbacks.dequeue()(Error::from_string_literal("WebContent process crashed"));
+
     ++m_crash_count;
     constexpr size_t max_reasonable_crash_count = 5U;
     if (m_crash_count >= max_reasonable_crash_count) {
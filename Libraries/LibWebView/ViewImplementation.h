@@ -119,6 +119,11 @@ public:
     void list_style_sheets();
     void request_style_sheet_source(Web::CSS::StyleSheetIdentifier const&);
 
+    using OnJSProfileReceived = Function<void(ErrorOr<String>)>;
+    void start_js_profiler();
+    void stop_js_profiler(OnJSProfileReceived);
+    void did_receive_js_profile(Badge<WebContentClient>, Optional<String> const& profile);
+
     void debug_request(ByteString const& request, ByteString const& argument = {});
 
     void run_javascript(String const&);
@@ -305,6 +310,9 @@ protected:
     RefPtr<Core::Promise<LexicalPath>> m_pending_screenshot;
     RefPtr<Core::Promise<String>> m_pending_info_request;
 
+    // WebContent replies to every request to stop the JS profiler, in the order of the requests.
+    Queue<OnJSProfileReceived> m_pending_js_profile_callbacks;
+
     Web::HTML::VisibilityState m_system_visibility_state { Web::HTML::VisibilityState::Hidden };
 
     Web::HTML::AudioPlayState m_audio_play_state { Web::HTML::AudioPlayState::Paused };
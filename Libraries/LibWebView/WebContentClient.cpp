@@ -388,6 +388,12 @@ void WebContentClient::did_get_style_sheet_source(u64 page_id, Web::CSS::StyleSh
     }
 }
 
+void WebContentClient::did_finish_js_profile(u64 page_id, Optional<String> profile)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value())
+        view->did_receive_js_profile({}, profile);
+}
+
 void WebContentClient::did_take_screenshot(u64 page_id, Gfx::ShareableBitmap screenshot)
 {
     if (auto view = view_for_page_id(page_id); view.has_value())
@@ -545,6 +551,53 @@ void WebContentClient::did_clear_storage(Web::StorageAPI::StorageEndpointType st
     Application::storage_jar().clear_storage_key(storage_endpoint, storage_key);
 }
 
+Messages::WebContentClient::DidRequestStorageItemsWithPrefixResponse WebContentClient::did_request_storage_items_with_prefix(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key_prefix)
+{
+    return Application::storage_jar().get_items_with_prefix(storage_endpoint, storage_key, bottle_key_prefix);
+}
+
+Messages::WebContentClient::DidRequestStorageKeysWithPrefixResponse WebContentClient::did_request_storage_keys_with_prefix(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key_prefix)
+{
+    return Application::storage_jar().get_keys_with_prefix(storage_endpoint, storage_key, bottle_key_prefix);
+}
+
+Messages::WebContentClient::DidRequestStorageItemsResponse WebContentClient::did_request_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, Vector<String> bottle_keys)
+{
+    return Application::storage_jar().get_items(storage_endpoint, storage_key, bottle_keys);
+}
+
+void WebContentClient::did_update_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, Vector<String> removed_bottle_key_prefixes, HashMap<String, Optional<String>> items)
+{
+    auto result = Application::storage_jar().update_items(storage_endpoint, storage_key, removed_bottle_key_prefixes, items);
+    auto were_applied = result == StorageOperationError::None;
+
+    // WebContent processes keep a replica of local storage, and the IndexedDB records that they have loaded, so let the
+    // others know about the changes made by this one.
+    if (storage_endpoint == Web::StorageAPI::StorageEndpointType::LocalStorage) {
+        // NOTE: This process is told that its changes were written in the same order as the changes of the others, so
+        //       that it knows which of them the storage jar applied last.
+        for_each_client([&](WebContentClient& client) {
+            if (&client == this)
+                client.async_local_storage_changes_written(storage_key, were_applied);
+            else if (were_applied)
+                client.async_local_storage_changed(storage_key, removed_bottle_key_prefixes, items);
+            return IterationDecision::Continue;
+        });
+    } else if (storage_endpoint == Web::StorageAPI::StorageEndpointType::IndexedDB && were_applied) {
+        auto changed_keys = items.keys();
+        for_each_client([&](WebContentClient& client) {
+            if (&client != this)
+                client.async_indexed_db_storage_changed(storage_key, removed_bottle_key_prefixes, changed_keys);
+            return IterationDecision::Continue;
+        });
+    }
+}
+
+Messages::WebContentClient::DidAdvanceStorageCounterResponse WebContentClient::did_advance_storage_counter(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key, u64 minimum, u64 increment)
+{
+    return Application::storage_jar().advance_counter(storage_endpoint, storage_key, bottle_key, minimum, increment);
+}
+
 Messages::WebContentClient::DidRequestNewWebViewResponse WebContentClient::did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab activate_tab, Web::HTML::WebViewHints hints, Optional<u64> page_index)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
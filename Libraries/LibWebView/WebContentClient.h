@@ -89,6 +89,7 @@ private:
     virtual void did_get_dom_node_html(u64 page_id, String html) override;
     virtual void did_list_style_sheets(u64 page_id, Vector<Web::CSS::StyleSheetIdentifier> stylesheets) override;
     virtual void did_get_style_sheet_source(u64 page_id, Web::CSS::StyleSheetIdentifier identifier, URL::URL, String source) override;
+    virtual void did_finish_js_profile(u64 page_id, Optional<String> profile) override;
     virtual void did_take_screenshot(u64 page_id, Gfx::ShareableBitmap screenshot) override;
     virtual void did_get_internal_page_info(u64 page_id, PageInfoType, String) override;
     virtual void did_execute_js_console_input(u64 page_id, JsonValue) override;
@@ -113,6 +114,11 @@ private:
     virtual void did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key) override;
     virtual Messages::WebContentClient::DidRequestStorageKeysResponse did_request_storage_keys(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key) override;
     virtual void did_clear_storage(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key) override;
+    virtual Messages::WebContentClient::DidRequestStorageItemsWithPrefixResponse did_request_storage_items_with_prefix(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key_prefix) override;
+    virtual Messages::WebContentClient::DidRequestStorageKeysWithPrefixResponse did_request_storage_keys_with_prefix(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key_prefix) override;
+    virtual Messages::WebContentClient::DidRequestStorageItemsResponse did_request_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, Vector<String> bottle_keys) override;
+    virtual void did_update_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, Vector<String> removed_bottle_key_prefixes, HashMap<String, Optional<String>> items) override;
+    virtual Messages::WebContentClient::DidAdvanceStorageCounterResponse did_advance_storage_counter(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key, u64 minimum, u64 increment) override;
     virtual Messages::WebContentClient::DidRequestNewWebViewResponse did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab, Web::HTML::WebViewHints, Optional<u64> page_index) override;
     virtual void did_request_activate_tab(u64 page_id) override;
     virtual void did_close_browsing_context(u64 page_id) override;
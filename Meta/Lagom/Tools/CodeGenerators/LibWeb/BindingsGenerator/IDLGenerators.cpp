@@ -3367,6 +3367,7 @@ GC_DEFINE_ALLOCATOR(@named_properties_class@);
   : JS::Object(realm, nullptr, MayInterfereWithIndexedPropertyAccess::Yes)
   , m_realm(realm)
 {
+    m_has_exotic_named_property_lookup = true;
 }
 
 @named_properties_class@::~@named_properties_class@()
@@ -7,9 +7,12 @@
 #include "WebSocketImplCurl.h"
 
 #include <AK/IDAllocator.h>
+#include <AK/LexicalPath.h>
 #include <AK/NonnullOwnPtr.h>
+#include <LibCore/Directory.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
 #include <LibCore/StandardPaths.h>
@@ -21,6 +24,7 @@
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/PreconnectPredictor.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #ifdef AK_OS_WINDOWS
 // needed because curl.h includes winsock2.h
@@ -34,6 +38,35 @@ ByteString g_default_certificate_path;
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 static long s_connect_timeout_seconds = 90L;
+
+// Large response bodies are written to shared memory chunks, which are shared by all requests of a client.
+// NOTE: A request hands its current chunk over to the client every time the requests are checked, even if the chunk is
+//       only partly filled. So a slow download never holds on to a chunk while it waits for more data, and only the
+//       downloads that outpace the client have to wait for chunks to be released.
+static constexpr size_t body_chunk_size = 1 * MiB;
+static constexpr size_t max_body_chunk_count = 16;
+static constexpr u64 minimum_body_size_for_body_chunks = 256 * KiB;
+
+// HTTP/2 stream weights range from 1 to 256. These follow the spread that other browsers use for their priorities.
+static long stream_weight_for_priority(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Highest:
+        return 256;
+    case RequestPriority::High:
+        return 220;
+    case RequestPriority::Medium:
+        return 183;
+    case RequestPriority::Low:
+        return 110;
+    case RequestPriority::Lowest:
+        return 32;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Only the subresources requested this soon after a navigation starts are considered to be part of loading the page.
+static constexpr auto navigation_subresource_window = AK::Duration::from_seconds(10);
 static struct {
     Optional<Core::SocketAddress> server_address;
     Optional<ByteString> server_hostname;
@@ -43,6 +76,47 @@ static struct {
 } g_dns_info;
 
 static WeakPtr<Resolver> s_resolver {};
+
+static ByteString dns_cache_path()
+{
+    return ByteString::formatted("{}/Ladybird/dns-cache.json", Core::StandardPaths::user_data_directory());
+}
+
+// The DNS cache is persisted across runs, so that the names a user visits often can be resolved without waiting for the
+// DNS server, even right after starting up.
+static void load_dns_cache(Resolver& resolver)
+{
+    auto file = Core::File::open(dns_cache_path(), Core::File::OpenMode::Read);
+    if (file.is_error())
+        return;
+
+    auto contents = file.value()->read_until_eof();
+    if (contents.is_error()) {
+        dbgln("Unable to read DNS cache: {}", contents.error());
+        return;
+    }
+
+    resolver.dns.load_cache(contents.value());
+}
+
+static void save_dns_cache(Resolver& resolver)
+{
+    auto statistics = resolver.dns.cache_statistics();
+    dbgln_if(REQUESTSERVER_DEBUG, "DNS cache: {} hits, {} stale hits, {} misses, {} refreshes (hit rate {:.1}%)",
+        statistics.hits, statistics.stale_hits, statistics.misses, statistics.refreshes, statistics.hit_rate() * 100);
+
+    auto result = [&]() -> ErrorOr<void> {
+        auto path = dns_cache_path();
+        TRY(Core::Directory::create(LexicalPath { path }.parent(), Core::Directory::CreateDirectories::Yes));
+
+        auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write));
+        TRY(file->write_until_depleted(resolver.dns.serialize_cache()));
+        return {};
+    }();
+
+    if (result.is_error())
+        dbgln("Unable to write DNS cache: {}", result.error());
+}
 static NonnullRefPtr<Resolver> default_resolver()
 {
     if (auto resolver = s_resolver.strong_ref())
@@ -77,6 +151,8 @@ static NonnullRefPtr<Resolver> default_resolver()
         };
     });
 
+    load_dns_cache(*resolver);
+
     s_resolver = resolver;
     return resolver;
 }
@@ -113,12 +189,20 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     bool is_connect_only { false };
     size_t downloaded_so_far { 0 };
     String url;
+    String origin;
     Optional<String> reason_phrase;
     ByteBuffer body;
     AllocatingMemoryStream send_buffer;
     NonnullRefPtr<Core::Notifier> write_notifier;
     bool done_fetching { false };
 
+    // Whether the response body is delivered through body chunks rather than the pipe. This is decided when the first
+    // data is received, and applies to all of the data.
+    Optional<bool> uses_body_chunks;
+    Optional<u32> body_chunk_id;
+    size_t body_chunk_used_size { 0 };
+    bool is_waiting_for_body_chunks { false };
+
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
         : multi(multi)
         , easy(easy)
@@ -180,6 +264,10 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
             dbgln("Warning: Request destroyed with buffered data (it's likely that the client disappeared or the request was cancelled)");
         }
 
+        // NOTE: A chunk that was never handed over to the client will not be released by it.
+        if (body_chunk_id.has_value() && client)
+            client->free_body_chunk(*body_chunk_id);
+
         if (writer_fd > 0)
             MUST(Core::System::close(writer_fd));
 
@@ -191,6 +279,65 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
             curl_slist_free_all(string_list);
     }
 
+    bool should_use_body_chunks() const
+    {
+        auto content_length = headers.get("Content-Length"sv);
+        if (!content_length.has_value())
+            return false;
+        return content_length->to_number<u64>().value_or(0) >= minimum_body_size_for_body_chunks;
+    }
+
+    void switch_to_body_chunks()
+    {
+        // The client stops waiting for data on the pipe once it is closed.
+        write_notifier->close();
+        MUST(Core::System::close(writer_fd));
+        writer_fd = 0;
+    }
+
+    // Returns false if there is not enough room in the body chunks for the data, in which case the transfer has to
+    // wait until the client releases a chunk.
+    ErrorOr<bool> write_to_body_chunks(ReadonlyBytes bytes)
+    {
+        auto available_size = body_chunk_id.has_value() ? body_chunk_size - body_chunk_used_size : 0;
+        if (bytes.size() > available_size) {
+            auto chunk_count = ceil_div(bytes.size() - available_size, body_chunk_size);
+            if (!client->can_allocate_body_chunks(chunk_count)) {
+                // Hand over what we have, so that the chunk can return to the pool once the client has read it.
+                send_body_chunk();
+                return false;
+            }
+        }
+
+        while (!bytes.is_empty()) {
+            if (!body_chunk_id.has_value()) {
+                body_chunk_id = TRY(client->allocate_body_chunk());
+                body_chunk_used_size = 0;
+            }
+
+            auto& chunk = client->m_body_chunks[*body_chunk_id].buffer;
+            auto size = min(bytes.size(), body_chunk_size - body_chunk_used_size);
+            bytes.slice(0, size).copy_to({ chunk.data<u8>() + body_chunk_used_size, size });
+            body_chunk_used_size += size;
+            bytes = bytes.slice(size);
+
+            if (body_chunk_used_size == body_chunk_size)
+                send_body_chunk();
+        }
+
+        return true;
+    }
+
+    // Tells the client about the data written to the current body chunk, and hands the chunk over to the client.
+    void send_body_chunk()
+    {
+        if (!body_chunk_id.has_value())
+            return;
+
+        client->async_request_body_received(request_id, *body_chunk_id, body_chunk_used_size);
+        body_chunk_id.clear();
+    }
+
     void flush_headers_if_needed()
     {
         if (got_all_headers)
@@ -243,6 +390,29 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     size_t total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
+    // NOTE: If every body chunk is in use, the body is sent through the pipe instead, so that the request doesn't have to
+    //       wait for other requests to make progress before it can start.
+    if (!request->uses_body_chunks.has_value()) {
+        request->uses_body_chunks = request->should_use_body_chunks() && request->client->can_allocate_body_chunks(1);
+        if (*request->uses_body_chunks)
+            request->switch_to_body_chunks();
+    }
+
+    if (*request->uses_body_chunks) {
+        auto was_written = request->write_to_body_chunks(bytes);
+        if (was_written.is_error()) {
+            dbgln("ConnectionFromClient::on_data_received: Aborting request because a body chunk could not be allocated: {}", was_written.error());
+            return CURL_WRITEFUNC_ERROR;
+        }
+        if (!was_written.value()) {
+            request->is_waiting_for_body_chunks = true;
+            return CURL_WRITEFUNC_PAUSE;
+        }
+
+        request->downloaded_so_far += total_size;
+        return total_size;
+    }
+
     auto maybe_write_error = [&] -> ErrorOr<void> {
         TRY(request->send_buffer.write_some(bytes));
         return request->write_queued_bytes_without_blocking();
@@ -311,6 +481,7 @@ int ConnectionFromClient::on_timeout_callback(void*, long timeout_ms, void* user
 
 ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transport)
     : IPC::ConnectionFromClient<RequestClientEndpoint, RequestServerEndpoint>(*this, move(transport), s_client_ids.allocate())
+    , m_request_scheduler([this](i32 request_id) { start_scheduled_request(request_id); })
     , m_resolver(default_resolver())
 {
     s_connections.set(client_id(), *this);
@@ -345,12 +516,19 @@ ConnectionFromClient::~ConnectionFromClient()
 
 void ConnectionFromClient::die()
 {
+    if constexpr (REQUESTSERVER_DEBUG)
+        m_request_scheduler.dump_origin_statistics();
+
     auto client_id = this->client_id();
     s_connections.remove(client_id);
     s_client_ids.deallocate(client_id);
 
-    if (s_connections.is_empty())
+    if (s_connections.is_empty()) {
+        PreconnectPredictor::the().persist_if_needed();
+        if (auto resolver = s_resolver.strong_ref())
+            save_dns_cache(*resolver);
         Core::EventLoop::current().quit(0);
+    }
 }
 
 Messages::RequestServer::InitTransportResponse ConnectionFromClient::init_transport([[maybe_unused]] int peer_pid)
@@ -452,14 +630,16 @@ void ConnectionFromClient::set_use_system_dns()
 }
 
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, ::RequestServer::RequestPriority)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, ::RequestServer::RequestPriority priority)
 {
     dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: start_request({}, {})", request_id, url);
+    did_request_url(url);
+
     auto host = url.serialized_host().to_byte_string();
 
     m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
@@ -468,7 +648,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             // FIXME: Implement timing info for DNS lookup failure.
             async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, priority](auto const& dns_result) mutable {
             if (dns_result->is_empty() || !dns_result->has_cached_addresses()) {
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
                 // FIXME: Implement timing info for DNS lookup failure.
@@ -497,6 +677,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
 
             auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
             request->url = url.to_string();
+            request->origin = url.origin().serialize();
 
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
@@ -515,6 +696,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
             set_option(CURLOPT_PIPEWAIT, 1L);
             set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path.characters());
+            set_option(CURLOPT_STREAM_WEIGHT, stream_weight_for_priority(priority));
 
             set_option(CURLOPT_CUSTOMREQUEST, method.characters());
             set_option(CURLOPT_FOLLOWLOCATION, 0);
@@ -575,14 +757,22 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             } else
                 VERIFY_NOT_REACHED();
 
-            auto result = curl_multi_add_handle(m_curl_multi, easy);
-            VERIFY(result == CURLM_OK);
-
+            auto origin = request->origin;
             m_active_requests.set(request_id, move(request));
+            m_request_scheduler.schedule(request_id, move(origin), priority);
         });
 }
 #endif
 
+void ConnectionFromClient::start_scheduled_request(i32 request_id)
+{
+    auto request = m_active_requests.get(request_id);
+    VERIFY(request.has_value());
+
+    auto result = curl_multi_add_handle(m_curl_multi, (*request)->easy);
+    VERIFY(result == CURLM_OK);
+}
+
 static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& code)
 {
     switch (code) {
@@ -609,7 +799,7 @@ static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& cod
     }
 }
 
-static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* easy_handle)
+static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* easy_handle, AK::Duration scheduler_queueing_delay)
 {
     /*
      *   curl_easy_perform()
@@ -632,7 +822,9 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
         return time_value;
     };
 
-    auto queue_time = get_timing_info(CURLINFO_QUEUE_TIME_T);
+    // NOTE: The time the request spent in our own queue comes before the time it spent in curl's queue.
+    auto queueing_delay = scheduler_queueing_delay.to_microseconds();
+    auto queue_time = queueing_delay + get_timing_info(CURLINFO_QUEUE_TIME_T);
     auto domain_lookup_time = get_timing_info(CURLINFO_NAMELOOKUP_TIME_T);
     auto connect_time = get_timing_info(CURLINFO_CONNECT_TIME_T);
     auto secure_connect_time = get_timing_info(CURLINFO_APPCONNECT_TIME_T);
@@ -645,6 +837,10 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
     auto get_version_result = curl_easy_getinfo(easy_handle, CURLINFO_HTTP_VERSION, &http_version);
     VERIFY(get_version_result == CURLE_OK);
 
+    long new_connection_count = 0;
+    auto get_connection_count_result = curl_easy_getinfo(easy_handle, CURLINFO_NUM_CONNECTS, &new_connection_count);
+    VERIFY(get_connection_count_result == CURLE_OK);
+
     auto http_version_alpn = Requests::ALPNHttpVersion::None;
     switch (http_version) {
     case CURL_HTTP_VERSION_1_0:
@@ -675,11 +871,18 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
         .response_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_end_time,
         .encoded_body_size = encoded_body_size,
         .http_version_alpn_identifier = http_version_alpn,
+        .queueing_delay_microseconds = queueing_delay,
+        .connection_was_reused = new_connection_count == 0,
     };
 }
 
 void ConnectionFromClient::check_active_requests()
 {
+    // Hand the body data that was received since the last time we got here over to the client, in one go. The chunks
+    // return to the pool once the client has read them.
+    for (auto& [request_id, request] : m_active_requests)
+        request->send_body_chunk();
+
     int msgs_in_queue = 0;
     while (auto* msg = curl_multi_info_read(m_curl_multi, &msgs_in_queue)) {
         if (msg->msg != CURLMSG_DONE)
@@ -705,7 +908,9 @@ void ConnectionFromClient::check_active_requests()
         auto* request = static_cast<ActiveRequest*>(application_private);
 
         if (!request->is_connect_only) {
-            auto timing_info = get_timing_info_from_curl_easy_handle(msg->easy_handle);
+            auto timing_info = get_timing_info_from_curl_easy_handle(msg->easy_handle, m_request_scheduler.queueing_delay(request->request_id));
+            m_request_scheduler.did_use_connection(request->origin, timing_info.connection_was_reused);
+            m_request_scheduler.did_finish(request->request_id);
             request->flush_headers_if_needed();
 
             auto result_code = msg->data.result;
@@ -728,11 +933,14 @@ void ConnectionFromClient::check_active_requests()
                 }
             }
 
+            request->send_body_chunk();
             async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
         }
 
         request->notify_about_fetching_completion();
     }
+
+    m_request_scheduler.start_queued_requests();
 }
 
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
@@ -743,9 +951,79 @@ Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(
         return false;
     }
 
+    m_request_scheduler.did_finish(request_id);
+    m_request_scheduler.start_queued_requests();
     return true;
 }
 
+bool ConnectionFromClient::can_allocate_body_chunks(size_t count) const
+{
+    size_t available_count = max_body_chunk_count - m_body_chunks.size();
+    for (auto const& chunk : m_body_chunks) {
+        if (!chunk.is_in_use)
+            ++available_count;
+    }
+    return available_count >= count;
+}
+
+ErrorOr<u32> ConnectionFromClient::allocate_body_chunk()
+{
+    for (size_t chunk_id = 0; chunk_id < m_body_chunks.size(); ++chunk_id) {
+        if (!m_body_chunks[chunk_id].is_in_use) {
+            m_body_chunks[chunk_id].is_in_use = true;
+            return chunk_id;
+        }
+    }
+
+    if (m_body_chunks.size() >= max_body_chunk_count)
+        return Error::from_string_literal("All body chunks are in use");
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(body_chunk_size));
+
+    u32 chunk_id = m_body_chunks.size();
+    m_body_chunks.append({ .buffer = move(buffer), .is_in_use = true });
+    async_body_chunk_created(chunk_id, m_body_chunks.last().buffer);
+    return chunk_id;
+}
+
+void ConnectionFromClient::free_body_chunk(u32 chunk_id)
+{
+    VERIFY(chunk_id < m_body_chunks.size());
+    m_body_chunks[chunk_id].is_in_use = false;
+}
+
+void ConnectionFromClient::release_body_chunk(u32 chunk_id)
+{
+    if (chunk_id >= m_body_chunks.size()) {
+        dbgln("ReleaseBodyChunk: Chunk ID {} not found", chunk_id);
+        return;
+    }
+
+    free_body_chunk(chunk_id);
+    resume_requests_waiting_for_body_chunks();
+}
+
+void ConnectionFromClient::resume_requests_waiting_for_body_chunks()
+{
+    Vector<CURL*> requests_to_resume;
+    for (auto& [request_id, request] : m_active_requests) {
+        if (!request->is_waiting_for_body_chunks)
+            continue;
+        request->is_waiting_for_body_chunks = false;
+        requests_to_resume.append(request->easy);
+    }
+
+    // NOTE: Unpausing a transfer may immediately deliver the data it is holding on to, which may pause it again.
+    for (auto* easy : requests_to_resume) {
+        auto result = curl_easy_pause(easy, CURLPAUSE_CONT);
+        if (result != CURLE_OK)
+            dbgln("ReleaseBodyChunk: Failed to resume request: {}", curl_easy_strerror(result));
+    }
+
+    if (!requests_to_resume.is_empty())
+        check_active_requests();
+}
+
 Messages::RequestServer::SetCertificateResponse ConnectionFromClient::set_certificate(i32 request_id, ByteString certificate, ByteString key)
 {
     (void)request_id;
@@ -759,37 +1037,61 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
     auto const url_string_value = url.to_string();
 
     if (cache_level == CacheLevel::CreateConnection) {
-        auto* easy = curl_easy_init();
-        if (!easy) {
-            dbgln("EnsureConnection: Failed to initialize curl easy handle");
-            return;
-        }
+        auto host = url.serialized_host().to_byte_string();
+
+        // NOTE: The host is resolved through our own resolver, as it is for requests, so that its cache is warmed up
+        //       along with the connection.
+        m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
+            ->when_rejected([url](auto const& error) {
+                dbgln_if(REQUESTSERVER_DEBUG, "EnsureConnection: DNS lookup for {} failed: {}", url, error);
+            })
+            .when_resolved([this, url, url_string_value, host = move(host)](auto const& dns_result) {
+                if (dns_result->is_empty() || !dns_result->has_cached_addresses())
+                    return;
+
+                auto* easy = curl_easy_init();
+                if (!easy) {
+                    dbgln("EnsureConnection: Failed to initialize curl easy handle");
+                    return;
+                }
 
-        auto set_option = [easy](auto option, auto value) {
-            auto result = curl_easy_setopt(easy, option, value);
-            if (result != CURLE_OK) {
-                dbgln("EnsureConnection: Failed to set curl option: {}", curl_easy_strerror(result));
-                return false;
-            }
-            return true;
-        };
+                auto set_option = [easy](auto option, auto value) {
+                    auto result = curl_easy_setopt(easy, option, value);
+                    if (result != CURLE_OK) {
+                        dbgln("EnsureConnection: Failed to set curl option: {}", curl_easy_strerror(result));
+                        return false;
+                    }
+                    return true;
+                };
 
-        auto connect_only_request_id = get_random<i32>();
+                auto connect_only_request_id = get_random<i32>();
 
-        auto request = make<ActiveRequest>(*this, m_curl_multi, easy, connect_only_request_id, 0);
-        request->url = url_string_value;
-        request->is_connect_only = true;
+                auto request = make<ActiveRequest>(*this, m_curl_multi, easy, connect_only_request_id, 0);
+                request->url = url_string_value;
+                request->is_connect_only = true;
 
-        set_option(CURLOPT_PRIVATE, request.ptr());
-        set_option(CURLOPT_URL, url_string_value.to_byte_string().characters());
-        set_option(CURLOPT_PORT, url.port_or_default());
-        set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
-        set_option(CURLOPT_CONNECT_ONLY, 1L);
+                set_option(CURLOPT_PRIVATE, request.ptr());
 
-        auto const result = curl_multi_add_handle(m_curl_multi, easy);
-        VERIFY(result == CURLM_OK);
+                if (!g_default_certificate_path.is_empty())
+                    set_option(CURLOPT_CAINFO, g_default_certificate_path.characters());
 
-        m_active_requests.set(connect_only_request_id, move(request));
+                set_option(CURLOPT_URL, url_string_value.to_byte_string().characters());
+                set_option(CURLOPT_PORT, url.port_or_default());
+                set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
+                set_option(CURLOPT_CONNECT_ONLY, 1L);
+
+                auto formatted_address = build_curl_resolve_list(*dns_result, host, url.port_or_default());
+                if (curl_slist* resolve_list = curl_slist_append(nullptr, formatted_address.characters())) {
+                    set_option(CURLOPT_RESOLVE, resolve_list);
+                    request->curl_string_lists.append(resolve_list);
+                } else
+                    VERIFY_NOT_REACHED();
+
+                auto const result = curl_multi_add_handle(m_curl_multi, easy);
+                VERIFY(result == CURLM_OK);
+
+                m_active_requests.set(connect_only_request_id, move(request));
+            });
 
         return;
     }
@@ -808,6 +1110,46 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
     }
 }
 
+void ConnectionFromClient::will_navigate(URL::URL url)
+{
+    m_navigation_site = PreconnectPredictor::site_for_url(url);
+    m_origins_used_by_navigation.clear();
+
+    if (!m_navigation_site.has_value())
+        return;
+
+    m_navigation_origin = url.origin().serialize();
+    m_navigation_start_time = MonotonicTime::now_coarse();
+
+    auto prediction = PreconnectPredictor::the().did_start_navigation(*m_navigation_site);
+    dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: Navigating to {}, connecting to {} and resolving {} origin(s)", *m_navigation_site, prediction.origins_to_connect.size(), prediction.origins_to_resolve.size());
+
+    for (auto& origin : prediction.origins_to_connect)
+        ensure_connection(move(origin), CacheLevel::CreateConnection);
+    for (auto& origin : prediction.origins_to_resolve)
+        ensure_connection(move(origin), CacheLevel::ResolveOnly);
+}
+
+void ConnectionFromClient::did_request_url(URL::URL const& url)
+{
+    if (!m_navigation_site.has_value())
+        return;
+    if (MonotonicTime::now_coarse() - m_navigation_start_time > navigation_subresource_window)
+        return;
+    if (!url.scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    // NOTE: The navigation's own origin is connected to by the navigation request itself.
+    auto origin = url.origin().serialize();
+    if (origin == m_navigation_origin)
+        return;
+
+    if (m_origins_used_by_navigation.set(origin) != HashSetResult::InsertedNewEntry)
+        return;
+
+    PreconnectPredictor::the().did_use_origin(*m_navigation_site, origin);
+}
+
 void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, ByteString origin, Vector<ByteString> protocols, Vector<ByteString> extensions, HTTP::HeaderMap additional_request_headers)
 {
     auto host = url.serialized_host().to_byte_string();
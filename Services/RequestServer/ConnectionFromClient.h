@@ -7,10 +7,14 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/Time.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibDNS/Resolver.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibWebSocket/WebSocket.h>
 #include <RequestServer/RequestClientEndpoint.h>
+#include <RequestServer/RequestScheduler.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
 namespace RequestServer {
@@ -44,10 +48,12 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, ::RequestServer::RequestPriority) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
+    virtual void release_body_chunk(u32 chunk_id) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
+    virtual void will_navigate(URL::URL url) override;
 
     virtual void websocket_connect(i64 websocket_id, URL::URL, ByteString, Vector<ByteString>, Vector<ByteString>, HTTP::HeaderMap) override;
     virtual void websocket_send(i64 websocket_id, bool, ByteBuffer) override;
@@ -67,14 +73,40 @@ private:
     static size_t on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data);
 
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
+    RequestScheduler m_request_scheduler;
 
     void check_active_requests();
+    void start_scheduled_request(i32 request_id);
+
+    void did_request_url(URL::URL const&);
+
+    // Large response bodies are written into a pool of shared memory chunks, which the client reads from directly. A
+    // chunk is handed over to the client once it is full or its request is done, and returns to the pool once the
+    // client has released it.
+    struct BodyChunk {
+        Core::AnonymousBuffer buffer;
+        bool is_in_use { false };
+    };
+
+    bool can_allocate_body_chunks(size_t count) const;
+    ErrorOr<u32> allocate_body_chunk();
+    void free_body_chunk(u32 chunk_id);
+    void resume_requests_waiting_for_body_chunks();
+
+    Vector<BodyChunk> m_body_chunks;
     void* m_curl_multi { nullptr };
     RefPtr<Core::Timer> m_timer;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_write_notifiers;
     NonnullRefPtr<Resolver> m_resolver;
     ByteString m_alt_svc_cache_path;
+
+    // The site of the current top-level navigation, and the origins it has requested subresources from. See
+    // PreconnectPredictor.
+    Optional<String> m_navigation_site;
+    String m_navigation_origin;
+    MonotonicTime m_navigation_start_time { MonotonicTime::now_coarse() };
+    HashTable<String> m_origins_used_by_navigation;
 };
 
 // FIXME: Find a good home for this
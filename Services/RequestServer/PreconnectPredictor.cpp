@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibURL/Parser.h>
+#include <RequestServer/PreconnectPredictor.h>
+
+namespace RequestServer {
+
+static constexpr size_t max_origin_count_per_site = 32;
+
+static constexpr size_t max_origins_to_connect = 6;
+static constexpr size_t max_origins_to_resolve = 16;
+
+static constexpr int persist_delay_ms = 5000;
+
+static constexpr auto navigation_count_key = "navigationCount"sv;
+static constexpr auto last_navigation_time_key = "lastNavigationTime"sv;
+static constexpr auto origins_key = "origins"sv;
+
+PreconnectPredictor& PreconnectPredictor::the()
+{
+    static PreconnectPredictor predictor { ByteString::formatted("{}/Ladybird/preconnect-predictions.json", Core::StandardPaths::user_data_directory()) };
+    return predictor;
+}
+
+PreconnectPredictor::PreconnectPredictor(ByteString path)
+    : m_path(move(path))
+{
+    load();
+}
+
+Optional<String> PreconnectPredictor::site_for_url(URL::URL const& url)
+{
+    if (!url.scheme().is_one_of("http"sv, "https"sv) || !url.host().has_value())
+        return {};
+
+    if (auto registrable_domain = url.host()->registrable_domain(); registrable_domain.has_value())
+        return MUST(String::formatted("{}://{}", url.scheme(), *registrable_domain));
+    return MUST(String::formatted("{}://{}", url.scheme(), url.serialized_host()));
+}
+
+PreconnectPredictor::Prediction PreconnectPredictor::did_start_navigation(String const& site)
+{
+    Prediction prediction;
+
+    if (!m_sites.contains(site) && m_sites.size() >= max_site_count)
+        evict_least_recently_navigated_site();
+
+    auto& entry = m_sites.ensure(site);
+
+    struct OriginAndUseCount {
+        StringView origin;
+        u32 use_count { 0 };
+    };
+    Vector<OriginAndUseCount> origins;
+    origins.ensure_capacity(entry.origin_use_counts.size());
+
+    for (auto const& [origin, use_count] : entry.origin_use_counts)
+        origins.unchecked_append({ origin, use_count });
+
+    quick_sort(origins, [](auto const& a, auto const& b) { return a.use_count > b.use_count; });
+
+    for (auto const& [origin, use_count] : origins) {
+        auto url = URL::Parser::basic_parse(origin);
+        if (!url.has_value())
+            continue;
+
+        if (use_count * 2 >= entry.navigation_count && prediction.origins_to_connect.size() < max_origins_to_connect)
+            prediction.origins_to_connect.append(url.release_value());
+        else if (prediction.origins_to_resolve.size() < max_origins_to_resolve)
+            prediction.origins_to_resolve.append(url.release_value());
+    }
+
+    ++entry.navigation_count;
+    entry.last_navigation_time = UnixDateTime::now();
+
+    if (entry.navigation_count >= navigation_count_decay_threshold) {
+        entry.navigation_count /= 2;
+
+        entry.origin_use_counts.remove_all_matching([](auto const&, auto& use_count) {
+            use_count /= 2;
+            return use_count == 0;
+        });
+    }
+
+    schedule_persist();
+    return prediction;
+}
+
+void PreconnectPredictor::did_use_origin(String const& site, String const& origin)
+{
+    auto entry = m_sites.find(site);
+    if (entry == m_sites.end())
+        return;
+
+    auto& origin_use_counts = entry->value.origin_use_counts;
+
+    if (auto use_count = origin_use_counts.find(origin); use_count != origin_use_counts.end()) {
+        use_count->value = min(use_count->value + 1, entry->value.navigation_count);
+    } else {
+        if (origin_use_counts.size() >= max_origin_count_per_site) {
+            // Make room by forgetting the least used origin, unless the new origin would be just as likely to be evicted.
+            auto least_used = origin_use_counts.begin();
+            for (auto it = origin_use_counts.begin(); it != origin_use_counts.end(); ++it) {
+                if (it->value < least_used->value)
+                    least_used = it;
+            }
+            if (least_used->value > 1)
+                return;
+            origin_use_counts.remove(least_used);
+        }
+
+        origin_use_counts.set(origin, 1);
+    }
+
+    schedule_persist();
+}
+
+void PreconnectPredictor::evict_least_recently_navigated_site()
+{
+    auto least_recent = m_sites.begin();
+    for (auto it = m_sites.begin(); it != m_sites.end(); ++it) {
+        if (it->value.last_navigation_time < least_recent->value.last_navigation_time)
+            least_recent = it;
+    }
+
+    if (least_recent != m_sites.end())
+        m_sites.remove(least_recent);
+}
+
+void PreconnectPredictor::load()
+{
+    auto file = Core::File::open(m_path, Core::File::OpenMode::Read);
+    if (file.is_error()) {
+        if (!file.error().is_errno() || file.error().code() != ENOENT)
+            dbgln("PreconnectPredictor: Unable to open {}: {}", m_path, file.error());
+        return;
+    }
+
+    auto contents = file.value()->read_until_eof();
+    if (contents.is_error()) {
+        dbgln("PreconnectPredictor: Unable to read {}: {}", m_path, contents.error());
+        return;
+    }
+
+    auto json = JsonValue::from_string(contents.value());
+    if (json.is_error() || !json.value().is_object()) {
+        dbgln("PreconnectPredictor: Ignoring malformed {}", m_path);
+        return;
+    }
+
+    json.value().as_object().for_each_member([&](String const& site, JsonValue const& value) {
+        if (!value.is_object() || m_sites.size() >= max_site_count)
+            return;
+
+        auto const& object = value.as_object();
+
+        Site entry;
+        entry.navigation_count = object.get_u32(navigation_count_key).value_or(0);
+        entry.last_navigation_time = UnixDateTime::from_seconds_since_epoch(object.get_i64(last_navigation_time_key).value_or(0));
+
+        if (auto origins = object.get_object(origins_key); origins.has_value()) {
+            origins->for_each_member([&](String const& origin, JsonValue const& use_count) {
+                if (entry.origin_use_counts.size() >= max_origin_count_per_site)
+                    return;
+                if (auto count = use_count.get_u32(); count.has_value() && *count > 0)
+                    entry.origin_use_counts.set(origin, min(*count, entry.navigation_count));
+            });
+        }
+
+        m_sites.set(site, move(entry));
+    });
+}
+
+void PreconnectPredictor::schedule_persist()
+{
+    m_has_unpersisted_changes = true;
+
+    // NOTE: Writes are delayed so that the changes made by a navigation, which come in over a few seconds, are written
+    //       together.
+    if (!m_persist_timer)
+        m_persist_timer = Core::Timer::create_single_shot(persist_delay_ms, [this] { persist_if_needed(); });
+    if (!m_persist_timer->is_active())
+        m_persist_timer->start();
+}
+
+void PreconnectPredictor::persist_if_needed()
+{
+    if (!m_has_unpersisted_changes)
+        return;
+    m_has_unpersisted_changes = false;
+
+    if (m_persist_timer)
+        m_persist_timer->stop();
+
+    JsonObject json;
+
+    for (auto const& [site, entry] : m_sites) {
+        JsonObject origins;
+        for (auto const& [origin, use_count] : entry.origin_use_counts)
+            origins.set(origin, use_count);
+
+        JsonObject object;
+        object.set(navigation_count_key, entry.navigation_count);
+        object.set(last_navigation_time_key, entry.last_navigation_time.seconds_since_epoch());
+        object.set(origins_key, move(origins));
+
+        json.set(site, move(object));
+    }
+
+    // NOTE: The predictions are written to a temporary file which then replaces the previous one, so that a crash or
+    //       a full disk in the middle of writing never leaves a truncated file behind.
+    auto temporary_path = ByteString::formatted("{}.tmp", m_path);
+
+    auto result = [&]() -> ErrorOr<void> {
+        TRY(Core::Directory::create(LexicalPath { m_path }.parent(), Core::Directory::CreateDirectories::Yes));
+
+        {
+            auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+            TRY(file->write_until_depleted(json.serialized()));
+        }
+
+        TRY(Core::System::rename(temporary_path, m_path));
+        return {};
+    }();
+
+    if (result.is_error()) {
+        dbgln("PreconnectPredictor: Unable to write {}: {}", m_path, result.error());
+        (void)Core::System::unlink(temporary_path);
+    }
+}
+
+}
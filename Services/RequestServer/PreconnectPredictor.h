@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// Learns which origins the pages of a site load their subresources from, so that those origins can be resolved and
+// connected to as soon as the next navigation to that site starts, rather than once the document asks for them.
+//
+// Origins are learned per site (the scheme and registrable domain of the navigated URL), and are persisted across runs.
+// Each origin keeps a count of the recent navigations to the site that used it. Origins that were used by at least
+// half of those navigations are connected to, and the others are only resolved.
+class PreconnectPredictor {
+public:
+    static constexpr size_t max_site_count = 1000;
+
+    // Once a site has been navigated to this many times, all of its counts are halved, so that origins that pages of
+    // the site no longer use are eventually forgotten.
+    static constexpr u32 navigation_count_decay_threshold = 16;
+
+    static PreconnectPredictor& the();
+
+    // Learned origins are loaded from and persisted to the JSON file at the given path.
+    explicit PreconnectPredictor(ByteString path);
+
+    static Optional<String> site_for_url(URL::URL const&);
+
+    struct Prediction {
+        Vector<URL::URL> origins_to_connect;
+        Vector<URL::URL> origins_to_resolve;
+    };
+
+    // Records a navigation to the site, and returns the origins that its pages are expected to load subresources from.
+    Prediction did_start_navigation(String const& site);
+
+    // Records that a navigation to the site loaded a subresource from the origin. Should be called once per navigation
+    // and origin.
+    void did_use_origin(String const& site, String const& origin);
+
+    void persist_if_needed();
+
+private:
+    struct Site {
+        u32 navigation_count { 0 };
+        UnixDateTime last_navigation_time;
+        HashMap<String, u32> origin_use_counts;
+    };
+
+    void load();
+    void schedule_persist();
+    void evict_least_recently_navigated_site();
+
+    ByteString m_path;
+    HashMap<String, Site> m_sites;
+
+    RefPtr<Core::Timer> m_persist_timer;
+    bool m_has_unpersisted_changes { false };
+};
+
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <RequestServer/RequestScheduler.h>
+
+namespace RequestServer {
+
+// The number of low priority requests (e.g. images) that may be in flight to an origin at the same time.
+static constexpr size_t max_low_priority_requests_per_origin = 6;
+
+// While render-blocking requests (e.g. stylesheets and scripts) are in flight, fewer low priority requests are started,
+// so that they don't hold back the first paint.
+static constexpr size_t max_low_priority_requests_per_origin_while_render_blocked = 2;
+
+// The lowest priority requests (e.g. prefetches) are only started while nothing is render-blocking, one at a time.
+static constexpr size_t max_lowest_priority_requests_per_origin = 1;
+
+static constexpr size_t max_origin_statistics_count = 256;
+
+RequestScheduler::RequestScheduler(Function<void(i32 request_id)> start_request)
+    : m_start_request(move(start_request))
+{
+}
+
+void RequestScheduler::schedule(i32 request_id, String origin, RequestPriority priority)
+{
+    VERIFY(!m_requests.contains(request_id));
+    m_requests.set(request_id,
+        ScheduledRequest {
+            .request_id = request_id,
+            .origin = move(origin),
+            .priority = priority,
+            .schedule_time = MonotonicTime::now(),
+            .start_time = {},
+        });
+    auto& request = m_requests.find(request_id)->value;
+
+    if (auto* statistics = statistics_for(request.origin))
+        ++statistics->request_count;
+
+    if (can_start(request)) {
+        start(request);
+        return;
+    }
+
+    dbgln_if(REQUESTSERVER_DEBUG, "RequestScheduler: Queueing request {} to {} with priority {}", request_id, request.origin, to_underlying(priority));
+
+    auto index = m_queue.size();
+    while (index > 0 && m_requests.get(m_queue[index - 1])->priority < priority)
+        --index;
+    m_queue.insert(index, request_id);
+
+    if (auto* statistics = statistics_for(request.origin))
+        ++statistics->queued_request_count;
+}
+
+void RequestScheduler::did_finish(i32 request_id)
+{
+    auto request = m_requests.take(request_id);
+    if (!request.has_value())
+        return;
+
+    if (!request->start_time.has_value()) {
+        m_queue.remove_first_matching([&](auto id) { return id == request_id; });
+        return;
+    }
+
+    switch (request->priority) {
+    case RequestPriority::Highest:
+        --m_in_flight_render_blocking_count;
+        break;
+    case RequestPriority::Low:
+    case RequestPriority::Lowest: {
+        auto origin = m_origins.find(request->origin);
+        VERIFY(origin != m_origins.end());
+
+        if (request->priority == RequestPriority::Low)
+            --origin->value.in_flight_low_priority_count;
+        else
+            --origin->value.in_flight_lowest_priority_count;
+
+        if (origin->value.in_flight_low_priority_count == 0 && origin->value.in_flight_lowest_priority_count == 0)
+            m_origins.remove(origin);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void RequestScheduler::start_queued_requests()
+{
+    // NOTE: Starting a request changes what the requests behind it may do, so the queue is walked front to back.
+    for (size_t i = 0; i < m_queue.size();) {
+        auto& request = m_requests.find(m_queue[i])->value;
+        if (!can_start(request)) {
+            ++i;
+            continue;
+        }
+
+        m_queue.remove(i);
+        start(request);
+    }
+}
+
+AK::Duration RequestScheduler::queueing_delay(i32 request_id) const
+{
+    auto request = m_requests.find(request_id);
+    if (request == m_requests.end() || !request->value.start_time.has_value())
+        return {};
+    return *request->value.start_time - request->value.schedule_time;
+}
+
+void RequestScheduler::did_use_connection(String const& origin, bool was_reused)
+{
+    auto* statistics = statistics_for(origin);
+    if (!statistics)
+        return;
+
+    if (was_reused)
+        ++statistics->reused_connection_count;
+    else
+        ++statistics->new_connection_count;
+}
+
+void RequestScheduler::dump_origin_statistics() const
+{
+    for (auto const& [origin, statistics] : m_origin_statistics) {
+        dbgln("{}: {} requests ({} queued, {}ms total queueing delay), {} new connections, {} reused connections",
+            origin,
+            statistics.request_count,
+            statistics.queued_request_count,
+            statistics.total_queueing_delay.to_milliseconds(),
+            statistics.new_connection_count,
+            statistics.reused_connection_count);
+    }
+}
+
+bool RequestScheduler::can_start(ScheduledRequest const& request) const
+{
+    if (request.priority >= RequestPriority::Medium)
+        return true;
+
+    auto origin = m_origins.get(request.origin).value_or({});
+
+    if (request.priority == RequestPriority::Lowest) {
+        if (m_in_flight_render_blocking_count > 0)
+            return false;
+        return origin.in_flight_lowest_priority_count < max_lowest_priority_requests_per_origin;
+    }
+
+    auto limit = m_in_flight_render_blocking_count > 0 ? max_low_priority_requests_per_origin_while_render_blocked : max_low_priority_requests_per_origin;
+    return origin.in_flight_low_priority_count < limit;
+}
+
+void RequestScheduler::start(ScheduledRequest& request)
+{
+    request.start_time = MonotonicTime::now();
+
+    switch (request.priority) {
+    case RequestPriority::Highest:
+        ++m_in_flight_render_blocking_count;
+        break;
+    case RequestPriority::Low:
+        ++m_origins.ensure(request.origin).in_flight_low_priority_count;
+        break;
+    case RequestPriority::Lowest:
+        ++m_origins.ensure(request.origin).in_flight_lowest_priority_count;
+        break;
+    default:
+        break;
+    }
+
+    if (auto* statistics = statistics_for(request.origin))
+        statistics->total_queueing_delay += *request.start_time - request.schedule_time;
+
+    m_start_request(request.request_id);
+}
+
+RequestScheduler::OriginStatistics* RequestScheduler::statistics_for(String const& origin)
+{
+    if (auto statistics = m_origin_statistics.find(origin); statistics != m_origin_statistics.end())
+        return &statistics->value;
+
+    // NOTE: Statistics are only kept for the first origins that were used, so that a long-lived client doesn't grow them
+    //       without bounds.
+    if (m_origin_statistics.size() >= max_origin_statistics_count)
+        return nullptr;
+    return &m_origin_statistics.ensure(origin);
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <RequestServer/RequestPriority.h>
+
+namespace RequestServer {
+
+// Decides when the requests of a client are handed over to curl. Requests of medium or higher priority are started right
+// away, while the number of low priority requests that are in flight to an origin at the same time is capped, so that
+// they don't compete with render-blocking requests for the bandwidth of a (possibly multiplexed) connection.
+//
+// Requests that can't be started yet are queued, and are started in order of priority once the requests that hold them
+// back are done.
+class RequestScheduler {
+public:
+    explicit RequestScheduler(Function<void(i32 request_id)> start_request);
+
+    void schedule(i32 request_id, String origin, RequestPriority);
+
+    // Must be called once a request is done, or has been cancelled, whether it was started or not. This does not start
+    // any queued requests, so that it is safe to call while iterating over requests; call start_queued_requests() for that.
+    void did_finish(i32 request_id);
+    void start_queued_requests();
+
+    // The time that a started request spent waiting in the queue.
+    AK::Duration queueing_delay(i32 request_id) const;
+
+    void did_use_connection(String const& origin, bool was_reused);
+
+    struct OriginStatistics {
+        u64 request_count { 0 };
+        u64 queued_request_count { 0 };
+        AK::Duration total_queueing_delay;
+        u64 new_connection_count { 0 };
+        u64 reused_connection_count { 0 };
+    };
+
+    HashMap<String, OriginStatistics> const& origin_statistics() const { return m_origin_statistics; }
+    void dump_origin_statistics() const;
+
+private:
+    struct ScheduledRequest {
+        i32 request_id { 0 };
+        String origin;
+        RequestPriority priority { RequestPriority::Medium };
+        MonotonicTime schedule_time;
+        Optional<MonotonicTime> start_time;
+    };
+
+    struct OriginState {
+        size_t in_flight_low_priority_count { 0 };
+        size_t in_flight_lowest_priority_count { 0 };
+    };
+
+    bool can_start(ScheduledRequest const&) const;
+    void start(ScheduledRequest&);
+    OriginStatistics* statistics_for(String const& origin);
+
+    Function<void(i32 request_id)> m_start_request;
+
+    HashMap<i32, ScheduledRequest> m_requests;
+    HashMap<String, OriginState> m_origins;
+
+    // The ids of the requests that have not been started yet, from the highest to the lowest priority. Requests of the
+    // same priority are kept in the order in which they were scheduled.
+    Vector<i32> m_queue;
+
+    size_t m_in_flight_render_blocking_count { 0 };
+
+    HashMap<String, OriginStatistics> m_origin_statistics;
+};
+
+}
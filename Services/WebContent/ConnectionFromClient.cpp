@@ -16,6 +16,7 @@
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
 #include <LibUnicode/TimeZone.h>
@@ -39,6 +40,7 @@
 #include <LibWeb/HTML/Storage.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/IndexedDB/Internal/PersistentStorage.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Loader/ContentFilter.h>
@@ -50,6 +52,7 @@
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/StorageAPI/LocalStorageReplica.h>
 #include <LibWebView/Attribute.h>
 #include <WebContent/ConnectionFromClient.h>
 #include <WebContent/PageClient.h>
@@ -636,6 +639,33 @@ void ConnectionFromClient::request_style_sheet_source(u64 page_id, Web::CSS::Sty
     }
 }
 
+void ConnectionFromClient::start_js_profiler(u64 page_id)
+{
+    if (!this->page(page_id).has_value())
+        return;
+
+    // NOTE: All pages of this WebContent process share the main thread VM, so the profile covers all of them.
+    Web::Bindings::main_thread_vm().bytecode_interpreter().start_sampling_profiler();
+}
+
+void ConnectionFromClient::stop_js_profiler(u64 page_id)
+{
+    // NOTE: The client waits for a reply to every request, so we reply even if there is no profile to send.
+    if (!this->page(page_id).has_value()) {
+        async_did_finish_js_profile(page_id, {});
+        return;
+    }
+
+    auto profiler = Web::Bindings::main_thread_vm().bytecode_interpreter().stop_sampling_profiler();
+    if (!profiler) {
+        async_did_finish_js_profile(page_id, {});
+        return;
+    }
+
+    // NOTE: The profile is only requested by Firefox DevTools, which expects it in the Gecko profile format.
+    async_did_finish_js_profile(page_id, profiler->to_gecko_profile_json());
+}
+
 void ConnectionFromClient::set_listen_for_dom_mutations(u64 page_id, bool listen_for_dom_mutations)
 {
     auto page = this->page(page_id);
@@ -1331,4 +1361,19 @@ void ConnectionFromClient::cookies_changed(Vector<Web::Cookie::Cookie> cookies)
     }
 }
 
+void ConnectionFromClient::local_storage_changed(String storage_key, Vector<String> removed_key_prefixes, HashMap<String, Optional<String>> items)
+{
+    Web::StorageAPI::LocalStorageReplica::apply_changes_from_other_process(storage_key, removed_key_prefixes, items);
+}
+
+void ConnectionFromClient::local_storage_changes_written(String storage_key, bool were_applied)
+{
+    Web::StorageAPI::LocalStorageReplica::did_write_back_changes(storage_key, were_applied);
+}
+
+void ConnectionFromClient::indexed_db_storage_changed(String storage_key, Vector<String> removed_key_prefixes, Vector<String> changed_keys)
+{
+    Web::IndexedDB::did_change_persisted_items_in_other_process(storage_key, removed_key_prefixes, changed_keys);
+}
+
 }
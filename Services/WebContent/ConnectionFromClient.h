@@ -88,6 +88,9 @@ private:
     virtual void list_style_sheets(u64 page_id) override;
     virtual void request_style_sheet_source(u64 page_id, Web::CSS::StyleSheetIdentifier identifier) override;
 
+    virtual void start_js_profiler(u64 page_id) override;
+    virtual void stop_js_profiler(u64 page_id) override;
+
     virtual void set_listen_for_dom_mutations(u64 page_id, bool) override;
     virtual void get_dom_node_inner_html(u64 page_id, Web::UniqueNodeID node_id) override;
     virtual void get_dom_node_outer_html(u64 page_id, Web::UniqueNodeID node_id) override;
@@ -159,6 +162,9 @@ private:
 
     virtual void system_time_zone_changed() override;
     virtual void cookies_changed(Vector<Web::Cookie::Cookie>) override;
+    virtual void local_storage_changed(String storage_key, Vector<String> removed_key_prefixes, HashMap<String, Optional<String>> items) override;
+    virtual void local_storage_changes_written(String storage_key, bool were_applied) override;
+    virtual void indexed_db_storage_changed(String storage_key, Vector<String> removed_key_prefixes, Vector<String> changed_keys) override;
 
     NonnullOwnPtr<PageHost> m_page_host;
 
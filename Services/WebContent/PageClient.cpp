@@ -574,6 +574,51 @@ void PageClient::page_did_clear_storage(Web::StorageAPI::StorageEndpointType sto
     }
 }
 
+HashMap<String, String> PageClient::page_did_request_storage_items_with_prefix(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageItemsWithPrefix>(storage_endpoint, storage_key, bottle_key_prefix);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestStorageItemsWithPrefix. Exiting peacefully.");
+        exit(0);
+    }
+    return response->take_items();
+}
+
+Vector<String> PageClient::page_did_request_storage_keys_with_prefix(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageKeysWithPrefix>(storage_endpoint, storage_key, bottle_key_prefix);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestStorageKeysWithPrefix. Exiting peacefully.");
+        exit(0);
+    }
+    return response->take_keys();
+}
+
+Vector<Optional<String>> PageClient::page_did_request_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& bottle_keys)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageItems>(storage_endpoint, storage_key, bottle_keys);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestStorageItems. Exiting peacefully.");
+        exit(0);
+    }
+    return response->take_values();
+}
+
+void PageClient::page_did_update_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& removed_bottle_key_prefixes, HashMap<String, Optional<String>> const& items)
+{
+    client().async_did_update_storage_items(storage_endpoint, storage_key, removed_bottle_key_prefixes, items);
+}
+
+Optional<u64> PageClient::page_did_advance_storage_counter(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, u64 minimum, u64 increment)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidAdvanceStorageCounter>(storage_endpoint, storage_key, bottle_key, minimum, increment);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidAdvanceStorageCounter. Exiting peacefully.");
+        exit(0);
+    }
+    return response->number();
+}
+
 void PageClient::page_did_update_resource_count(i32 count_waiting)
 {
     client().async_did_update_resource_count(m_id, count_waiting);
@@ -155,6 +155,11 @@ private:
     virtual void page_did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key) override;
     virtual Vector<String> page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key) override;
     virtual void page_did_clear_storage(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key) override;
+    virtual HashMap<String, String> page_did_request_storage_items_with_prefix(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix) override;
+    virtual Vector<String> page_did_request_storage_keys_with_prefix(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key_prefix) override;
+    virtual Vector<Optional<String>> page_did_request_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& bottle_keys) override;
+    virtual void page_did_update_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, Vector<String> const& removed_bottle_key_prefixes, HashMap<String, Optional<String>> const& items) override;
+    virtual Optional<u64> page_did_advance_storage_counter(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, u64 minimum, u64 increment) override;
     virtual void page_did_update_resource_count(i32) override;
     virtual NewWebViewResult page_did_request_new_web_view(Web::HTML::ActivateTab, Web::HTML::WebViewHints, Web::HTML::TokenizedFeature::NoOpener) override;
     virtual void page_did_request_activate_tab() override;
@@ -4,11 +4,116 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/MemoryStream.h>
+#include <AK/StringBuilder.h>
 #include <LibCore/Socket.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibCore/UDPServer.h>
 #include <LibDNS/Resolver.h>
 #include <LibTLS/TLSv12.h>
 #include <LibTest/TestCase.h>
 
+// Answers every A question it gets with the same address, so that the tests can tell which answer the resolver serves.
+class FakeDNSServer {
+public:
+    FakeDNSServer()
+        : m_server(Core::UDPServer::construct())
+    {
+        VERIFY(m_server->bind({ 127, 0, 0, 1 }, 0));
+        m_server->on_ready_to_receive = [this] { answer_query(); };
+    }
+
+    ErrorOr<DNS::Resolver::SocketResult> create_socket()
+    {
+        Core::SocketAddress address = { IPv4Address(127, 0, 0, 1), m_server->local_port().value() };
+        return DNS::Resolver::SocketResult {
+            TRY(Core::BufferedSocket<Core::UDPSocket>::create(TRY(Core::UDPSocket::connect(address)))),
+            DNS::Resolver::ConnectionMode::UDP,
+        };
+    }
+
+    void set_address(IPv4Address address) { m_address = address; }
+    void set_ttl(u32 ttl) { m_ttl = ttl; }
+
+    size_t query_count() const { return m_query_count; }
+
+private:
+    void answer_query()
+    {
+        sockaddr_in from;
+        auto query_bytes = MUST(m_server->receive(4096, from));
+        FixedMemoryStream stream { query_bytes.bytes() };
+        auto query = MUST(DNS::Messages::Message::from_raw(stream));
+        ++m_query_count;
+
+        DNS::Messages::Message response;
+        response.header.id = query.header.id;
+        response.header.options = query.header.options;
+        response.header.question_count = query.header.question_count;
+        response.questions = query.questions;
+
+        // NOTE: Message::to_raw() only writes queries, so the answers are appended to the serialized questions.
+        ByteBuffer response_bytes;
+        MUST(response.to_raw(response_bytes));
+
+        u16 answer_count = 0;
+        for (auto const& question : query.questions) {
+            if (question.type != DNS::Messages::ResourceType::A)
+                continue;
+
+            DNS::Messages::ResourceRecord answer {
+                .name = question.name,
+                .type = DNS::Messages::ResourceType::A,
+                .class_ = DNS::Messages::Class::IN,
+                .ttl = m_ttl,
+                .record = DNS::Messages::Records::A { m_address },
+                .raw = {},
+            };
+            MUST(answer.to_raw(response_bytes));
+            ++answer_count;
+        }
+
+        response.header.answer_count = answer_count;
+        response_bytes.overwrite(0, &response.header, sizeof(response.header));
+
+        MUST(m_server->send(response_bytes, from));
+    }
+
+    NonnullRefPtr<Core::UDPServer> m_server;
+    IPv4Address m_address { 192, 0, 2, 2 };
+    u32 m_ttl { 3600 };
+    size_t m_query_count { 0 };
+};
+
+static NonnullRefPtr<DNS::LookupResult const> resolve(DNS::Resolver& resolver, ByteString name)
+{
+    return MUST(resolver.lookup(move(name), DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A })->await());
+}
+
+static RefPtr<DNS::LookupResult const> lookup_in_cache(DNS::Resolver& resolver, StringView name)
+{
+    return resolver.lookup_in_cache(name, DNS::Messages::Class::IN, Array { DNS::Messages::ResourceType::A });
+}
+
+// Runs the event loop until the condition holds, giving up after a while so that a broken resolver fails the test
+// rather than hanging it.
+static bool spin_until(Core::EventLoop& loop, Function<bool()> condition)
+{
+    auto timed_out = false;
+    auto timer = Core::Timer::create_single_shot(5000, [&] { timed_out = true; });
+    timer->start();
+
+    loop.spin_until([&] { return timed_out || condition(); });
+    return condition();
+}
+
+static bool has_cached_address(DNS::Resolver& resolver, StringView name, IPv4Address address)
+{
+    auto result = lookup_in_cache(resolver, name);
+    return result && result->record<DNS::Messages::Records::A>().address == address;
+}
+
 TEST_CASE(test_udp)
 {
     Core::EventLoop loop;
@@ -102,3 +207,195 @@ TEST_CASE(test_tls)
 
     EXPECT_EQ(0, loop.exec());
 }
+
+TEST_CASE(test_cache_persistence)
+{
+    Core::EventLoop loop;
+
+    DNS::Resolver resolver {
+        [] -> ErrorOr<DNS::Resolver::SocketResult> {
+            return Error::from_string_literal("No DNS server in this test");
+        }
+    };
+
+    auto now = UnixDateTime::now().seconds_since_epoch();
+    auto serialized_cache = MUST(String::formatted(R"~~~([
+        {{ "name": "fresh.example", "types": [1], "records": [{{ "type": 1, "ttl": 3600, "expiration": {}, "address": "192.0.2.1" }}] }},
+        {{ "name": "stale.example", "types": [28], "records": [{{ "type": 28, "ttl": 60, "expiration": {}, "address": "2001:db8::1" }}] }},
+        {{ "name": "forgotten.example", "types": [1], "records": [{{ "type": 1, "ttl": 60, "expiration": {}, "address": "192.0.2.2" }}] }}
+    ])~~~",
+        now + 3600, now - 60, now - 2 * 24 * 60 * 60));
+
+    resolver.load_cache(serialized_cache);
+
+    auto fresh = resolver.lookup_in_cache("fresh.example"sv, DNS::Messages::Class::IN, Array { DNS::Messages::ResourceType::A });
+    EXPECT(fresh);
+    EXPECT(!fresh->is_dnssec_validated());
+    EXPECT_EQ(fresh->record<DNS::Messages::Records::A>().address, IPv4Address(192, 0, 2, 1));
+
+    // Expired entries are only served while they are being refreshed, never from the cache itself.
+    EXPECT(!resolver.lookup_in_cache("stale.example"sv, DNS::Messages::Class::IN, Array { DNS::Messages::ResourceType::AAAA }));
+
+    auto reserialized_cache = resolver.serialize_cache();
+    EXPECT(reserialized_cache.contains("fresh.example"sv));
+    EXPECT(reserialized_cache.contains("stale.example"sv));
+    EXPECT(!reserialized_cache.contains("forgotten.example"sv));
+}
+
+TEST_CASE(test_cache_statistics)
+{
+    Core::EventLoop loop;
+
+    FakeDNSServer server;
+    DNS::Resolver resolver { [&] { return server.create_socket(); } };
+    TRY_OR_FAIL(resolver.when_socket_ready()->await());
+
+    auto result = resolve(resolver, "counted.example");
+    EXPECT_EQ(result->record<DNS::Messages::Records::A>().address, IPv4Address(192, 0, 2, 2));
+    EXPECT_EQ(server.query_count(), 1u);
+
+    auto statistics = resolver.cache_statistics();
+    EXPECT_EQ(statistics.hits, 0u);
+    EXPECT_EQ(statistics.misses, 1u);
+
+    (void)resolve(resolver, "counted.example");
+    (void)resolve(resolver, "counted.example");
+    EXPECT_EQ(server.query_count(), 1u);
+
+    // Addresses don't need to be resolved at all, so they don't count as lookups.
+    (void)resolve(resolver, "192.0.2.3");
+
+    statistics = resolver.cache_statistics();
+    EXPECT_EQ(statistics.hits, 2u);
+    EXPECT_EQ(statistics.stale_hits, 0u);
+    EXPECT_EQ(statistics.misses, 1u);
+    EXPECT_EQ(statistics.refreshes, 0u);
+    EXPECT_APPROXIMATE(statistics.hit_rate(), 2.0 / 3.0);
+}
+
+TEST_CASE(test_serve_stale_while_refreshing)
+{
+    Core::EventLoop loop;
+
+    FakeDNSServer server;
+    DNS::Resolver resolver { [&] { return server.create_socket(); } };
+    TRY_OR_FAIL(resolver.when_socket_ready()->await());
+
+    auto now = UnixDateTime::now().seconds_since_epoch();
+    resolver.load_cache(MUST(String::formatted(R"~~~([
+        {{ "name": "stale.example", "types": [1], "records": [{{ "type": 1, "ttl": 60, "expiration": {}, "address": "192.0.2.1" }}] }}
+    ])~~~",
+        now - 60)));
+
+    // The expired address is served right away, and the name is resolved again in the background.
+    auto result = resolve(resolver, "stale.example");
+    EXPECT_EQ(result->record<DNS::Messages::Records::A>().address, IPv4Address(192, 0, 2, 1));
+
+    // Until the server has answered, the expired address keeps being served, without asking the server again.
+    result = resolve(resolver, "stale.example");
+    EXPECT_EQ(result->record<DNS::Messages::Records::A>().address, IPv4Address(192, 0, 2, 1));
+
+    auto statistics = resolver.cache_statistics();
+    EXPECT_EQ(statistics.stale_hits, 2u);
+    EXPECT_EQ(statistics.refreshes, 1u);
+    EXPECT_EQ(statistics.misses, 0u);
+
+    EXPECT(spin_until(loop, [&] { return has_cached_address(resolver, "stale.example"sv, { 192, 0, 2, 2 }); }));
+    EXPECT_EQ(server.query_count(), 1u);
+
+    result = resolve(resolver, "stale.example");
+    EXPECT_EQ(result->record<DNS::Messages::Records::A>().address, IPv4Address(192, 0, 2, 2));
+
+    statistics = resolver.cache_statistics();
+    EXPECT_EQ(statistics.hits, 1u);
+    EXPECT_EQ(statistics.stale_hits, 2u);
+    EXPECT_EQ(statistics.refreshes, 1u);
+    EXPECT_EQ(statistics.misses, 0u);
+}
+
+TEST_CASE(test_refresh_popular_entries_before_they_expire)
+{
+    Core::EventLoop loop;
+
+    FakeDNSServer server;
+    DNS::Resolver resolver { [&] { return server.create_socket(); } };
+    TRY_OR_FAIL(resolver.when_socket_ready()->await());
+
+    // An hour long TTL with a minute left, so the entry is about to expire.
+    auto now = UnixDateTime::now().seconds_since_epoch();
+    resolver.load_cache(MUST(String::formatted(R"~~~([
+        {{ "name": "popular.example", "types": [1], "records": [{{ "type": 1, "ttl": 3600, "expiration": {}, "address": "192.0.2.1" }}] }}
+    ])~~~",
+        now + 60)));
+
+    for (u32 i = 1; i < DNS::Resolver::popular_entry_use_count; ++i) {
+        auto result = resolve(resolver, "popular.example");
+        EXPECT_EQ(result->record<DNS::Messages::Records::A>().address, IPv4Address(192, 0, 2, 1));
+    }
+    EXPECT_EQ(resolver.cache_statistics().refreshes, 0u);
+
+    // Once the entry is popular, using it while it is about to expire resolves it again, but still serves the current
+    // address without waiting for the server.
+    auto result = resolve(resolver, "popular.example");
+    EXPECT_EQ(result->record<DNS::Messages::Records::A>().address, IPv4Address(192, 0, 2, 1));
+    EXPECT_EQ(resolver.cache_statistics().refreshes, 1u);
+
+    EXPECT(spin_until(loop, [&] { return has_cached_address(resolver, "popular.example"sv, { 192, 0, 2, 2 }); }));
+    EXPECT_EQ(server.query_count(), 1u);
+
+    result = resolve(resolver, "popular.example");
+    EXPECT_EQ(result->record<DNS::Messages::Records::A>().address, IPv4Address(192, 0, 2, 2));
+
+    auto statistics = resolver.cache_statistics();
+    EXPECT_EQ(statistics.hits, DNS::Resolver::popular_entry_use_count + 1);
+    EXPECT_EQ(statistics.stale_hits, 0u);
+    EXPECT_EQ(statistics.misses, 0u);
+    EXPECT_EQ(statistics.refreshes, 1u);
+}
+
+TEST_CASE(test_evict_least_recently_used_entry)
+{
+    Core::EventLoop loop;
+
+    FakeDNSServer server;
+    DNS::Resolver resolver { [&] { return server.create_socket(); } };
+    TRY_OR_FAIL(resolver.when_socket_ready()->await());
+
+    // Fill the cache up, next to the entry for localhost that every resolver starts out with.
+    auto const entry_count = DNS::Resolver::max_cache_entry_count - 1;
+    auto expiration = UnixDateTime::now().seconds_since_epoch() + 3600;
+
+    StringBuilder serialized_cache;
+    serialized_cache.append('[');
+    for (size_t i = 0; i < entry_count; ++i) {
+        if (i > 0)
+            serialized_cache.append(',');
+        serialized_cache.appendff(R"~~~({{ "name": "name-{}.example", "types": [1], "records": [{{ "type": 1, "ttl": 3600, "expiration": {}, "address": "192.0.2.1" }}] }})~~~", i, expiration);
+    }
+    serialized_cache.append(']');
+    resolver.load_cache(serialized_cache.string_view());
+
+    EXPECT(lookup_in_cache(resolver, "name-0.example"sv));
+    EXPECT(lookup_in_cache(resolver, ByteString::formatted("name-{}.example", entry_count - 1)));
+
+    // Use every entry but the first one, so that it is the least recently used one.
+    // NOTE: The use times come from a coarse clock, so wait long enough for them to differ from the load time.
+    MUST(Core::System::sleep_ms(50));
+    (void)resolve(resolver, "localhost");
+    for (size_t i = 1; i < entry_count; ++i)
+        (void)resolve(resolver, ByteString::formatted("name-{}.example", i));
+
+    auto result = resolve(resolver, "new.example");
+    EXPECT_EQ(result->record<DNS::Messages::Records::A>().address, IPv4Address(192, 0, 2, 2));
+    EXPECT_EQ(server.query_count(), 1u);
+
+    EXPECT(!lookup_in_cache(resolver, "name-0.example"sv));
+    EXPECT(lookup_in_cache(resolver, "new.example"sv));
+    EXPECT(lookup_in_cache(resolver, "localhost"sv));
+    for (size_t i = 1; i < entry_count; ++i)
+        EXPECT(lookup_in_cache(resolver, ByteString::formatted("name-{}.example", i)));
+
+    auto statistics = resolver.cache_statistics();
+    EXPECT_EQ(statistics.hits, static_cast<u64>(entry_count));
+    EXPECT_EQ(statistics.misses, 1u);
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Socket.h>
+#include <LibDevTools/DevToolsDelegate.h>
+#include <LibDevTools/DevToolsServer.h>
+#include <LibTest/TestCase.h>
+
+static constexpr u16 devtools_port = 9092;
+
+class TestDelegate final : public DevTools::DevToolsDelegate {
+public:
+    virtual Vector<DevTools::TabDescription> tab_list() const override
+    {
+        return { { .id = 1, .title = "Test"_string, .url = "about:blank"_string } };
+    }
+
+    virtual void start_js_profiler(DevTools::TabDescription const&) const override
+    {
+        ++start_count;
+    }
+
+    // NOTE: The profile is delivered from the event loop, as it would be once WebContent has replied.
+    virtual void stop_js_profiler(DevTools::TabDescription const&, OnJSProfileReceived on_complete) const override
+    {
+        ++stop_count;
+
+        Core::deferred_invoke([fail_to_stop = fail_to_stop, on_complete = move(on_complete)]() mutable {
+            if (fail_to_stop) {
+                on_complete(Error::from_string_literal("Unable to locate tab"));
+                return;
+            }
+
+            JsonObject profile;
+            profile.set("nodes"sv, JsonArray {});
+            profile.set("samples"sv, JsonArray {});
+            on_complete(JsonValue { move(profile) });
+        });
+    }
+
+    bool fail_to_stop { false };
+    mutable size_t start_count { 0 };
+    mutable size_t stop_count { 0 };
+};
+
+class TestClient {
+public:
+    static ErrorOr<TestClient> connect(Core::EventLoop& event_loop)
+    {
+        auto socket = TRY(Core::TCPSocket::connect({ { 127, 0, 0, 1 }, devtools_port }));
+        TestClient client { event_loop, move(socket) };
+
+        // The root actor greets every new client.
+        auto greeting = TRY(client.receive());
+        if (greeting.get_string("from"sv) != "root"sv)
+            return Error::from_string_literal("Did not receive a greeting from the root actor");
+
+        return client;
+    }
+
+    ErrorOr<void> send(StringView to, StringView type)
+    {
+        JsonObject message;
+        message.set("to"sv, to);
+        message.set("type"sv, type);
+
+        auto serialized = message.serialized();
+        TRY(m_socket->write_formatted("{}:{}", serialized.byte_count(), serialized));
+        return {};
+    }
+
+    ErrorOr<JsonObject> receive()
+    {
+        // NOTE: The server reads and writes from the event loop, so we keep pumping it until a message has arrived.
+        for (size_t i = 0; !TRY(m_socket->can_read_without_blocking(10)); ++i) {
+            if (i == 500)
+                return Error::from_string_literal("Timed out waiting for a message from the DevTools server");
+            m_event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+        }
+
+        ByteBuffer length_buffer;
+        while (true) {
+            auto byte = TRY(m_socket->read_value<u8>());
+            if (byte == ':')
+                break;
+            length_buffer.append(byte);
+        }
+
+        auto length = StringView { length_buffer }.to_number<size_t>();
+        if (!length.has_value())
+            return Error::from_string_literal("Could not read message length from the DevTools server");
+
+        auto message_buffer = TRY(ByteBuffer::create_uninitialized(*length));
+        TRY(m_socket->read_until_filled(message_buffer));
+
+        auto message = TRY(JsonValue::from_string(message_buffer));
+        if (!message.is_object())
+            return Error::from_string_literal("Received a message that is not an object");
+        return message.as_object();
+    }
+
+    ErrorOr<JsonObject> request(StringView to, StringView type)
+    {
+        TRY(send(to, type));
+        return receive();
+    }
+
+    ErrorOr<String> perf_actor()
+    {
+        auto tab_list = TRY(request("root"sv, "listTabs"sv));
+        auto tabs = tab_list.get_array("tabs"sv);
+        if (!tabs.has_value() || tabs->is_empty() || !tabs->at(0).is_object())
+            return Error::from_string_literal("Did not receive a tab");
+
+        auto tab = tabs->at(0).as_object().get_string("actor"sv);
+        if (!tab.has_value())
+            return Error::from_string_literal("Did not receive a tab actor");
+
+        auto perf_actor = TRY(request(*tab, "getPerfActor"sv));
+        auto perf = perf_actor.get_string("actor"sv);
+        if (!perf.has_value())
+            return Error::from_string_literal("Did not receive a perf actor");
+        return *perf;
+    }
+
+private:
+    TestClient(Core::EventLoop& event_loop, NonnullOwnPtr<Core::TCPSocket> socket)
+        : m_event_loop(event_loop)
+        , m_socket(move(socket))
+    {
+    }
+
+    Core::EventLoop& m_event_loop;
+    NonnullOwnPtr<Core::TCPSocket> m_socket;
+};
+
+TEST_CASE(start_and_stop_profiler)
+{
+    Core::EventLoop event_loop;
+    TestDelegate delegate;
+    auto server = TRY_OR_FAIL(DevTools::DevToolsServer::create(delegate, devtools_port));
+    auto client = TRY_OR_FAIL(TestClient::connect(event_loop));
+    auto perf = TRY_OR_FAIL(client.perf_actor());
+
+    EXPECT_EQ(TRY_OR_FAIL(client.request(perf, "isActive"sv)).get_bool("isActive"sv), false);
+
+    EXPECT_EQ(TRY_OR_FAIL(client.request(perf, "startProfiler"sv)).get_bool("value"sv), true);
+    EXPECT_EQ(TRY_OR_FAIL(client.request(perf, "isActive"sv)).get_bool("isActive"sv), true);
+
+    // Starting the profiler again doesn't restart it.
+    EXPECT_EQ(TRY_OR_FAIL(client.request(perf, "startProfiler"sv)).get_bool("value"sv), true);
+    EXPECT_EQ(delegate.start_count, 1u);
+
+    auto response = TRY_OR_FAIL(client.request(perf, "getProfileAndStopProfiler"sv));
+    auto profile = response.get_object("profile"sv);
+    EXPECT(profile.has_value());
+    EXPECT(profile.has_value() && profile->has_array("nodes"sv));
+    EXPECT_EQ(delegate.stop_count, 1u);
+    EXPECT_EQ(TRY_OR_FAIL(client.request(perf, "isActive"sv)).get_bool("isActive"sv), false);
+
+    // Without an active profiler, there is no profile to get.
+    response = TRY_OR_FAIL(client.request(perf, "getProfileAndStopProfiler"sv));
+    EXPECT(response.get("profile"sv).has_value() && response.get("profile"sv)->is_null());
+    EXPECT_EQ(delegate.stop_count, 1u);
+
+    EXPECT_EQ(TRY_OR_FAIL(client.request(perf, "startProfiler"sv)).get_bool("value"sv), true);
+    response = TRY_OR_FAIL(client.request(perf, "stopProfilerAndDiscardProfile"sv));
+    EXPECT(!response.has("error"sv));
+    EXPECT_EQ(delegate.start_count, 2u);
+    EXPECT_EQ(delegate.stop_count, 2u);
+    EXPECT_EQ(TRY_OR_FAIL(client.request(perf, "isActive"sv)).get_bool("isActive"sv), false);
+}
+
+TEST_CASE(reply_when_profile_cannot_be_retrieved)
+{
+    Core::EventLoop event_loop;
+    TestDelegate delegate;
+    delegate.fail_to_stop = true;
+
+    auto server = TRY_OR_FAIL(DevTools::DevToolsServer::create(delegate, devtools_port));
+    auto client = TRY_OR_FAIL(TestClient::connect(event_loop));
+    auto perf = TRY_OR_FAIL(client.perf_actor());
+
+    EXPECT_EQ(TRY_OR_FAIL(client.request(perf, "startProfiler"sv)).get_bool("value"sv), true);
+
+    // The reply to a later request is held back until the profile has been replied to, so both must arrive.
+    TRY_OR_FAIL(client.send(perf, "getProfileAndStopProfiler"sv));
+    TRY_OR_FAIL(client.send(perf, "isActive"sv));
+
+    auto response = TRY_OR_FAIL(client.receive());
+    EXPECT(response.get_string("error"sv) == "unknownError"sv);
+    EXPECT(!response.has("profile"sv));
+
+    response = TRY_OR_FAIL(client.receive());
+    EXPECT_EQ(response.get_bool("isActive"sv), false);
+}
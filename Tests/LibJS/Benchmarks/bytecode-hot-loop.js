@@ -0,0 +1,15 @@
+function collatzSteps(n) {
+    let steps = 0;
+    while (n !== 1) {
+        n = n % 2 === 0 ? n / 2 : 3 * n + 1;
+        ++steps;
+    }
+    return steps;
+}
+
+function benchmark() {
+    let total = 0;
+    for (let i = 1; i < 30000; ++i) total += collatzSteps(i);
+    for (let i = 0; i < 300000; ++i) total = (total + ((i * 7) ^ (i >> 3))) | 0;
+    return total;
+}
@@ -0,0 +1,18 @@
+function makeTree(depth) {
+    if (depth === 0) return { left: null, right: null, value: 0 };
+    return { left: makeTree(depth - 1), right: makeTree(depth - 1), value: depth };
+}
+
+function countNodes(tree) {
+    if (tree === null) return 0;
+    return 1 + countNodes(tree.left) + countNodes(tree.right);
+}
+
+const longLived = makeTree(14);
+
+function benchmark() {
+    let total = 0;
+    for (let i = 0; i < 40; ++i) total += countNodes(makeTree(10));
+    for (let i = 0; i < 50000; ++i) total += [i, i + 1, { i }].length;
+    return total + countNodes(longLived);
+}
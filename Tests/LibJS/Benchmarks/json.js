@@ -0,0 +1,21 @@
+const records = [];
+for (let i = 0; i < 2000; ++i) {
+    records.push({
+        id: i,
+        name: `record ${i}`,
+        active: i % 3 === 0,
+        score: i * 1.5,
+        tags: ["alpha", "beta", "gamma"].slice(0, i % 4),
+        nested: { created: "2024-01-01T00:00:00Z", counts: [i, i * 2, i * 3] },
+    });
+}
+const text = JSON.stringify(records);
+
+function benchmark() {
+    let total = 0;
+    for (let i = 0; i < 5; ++i) {
+        total += JSON.stringify(records).length;
+        total += JSON.parse(text).length;
+    }
+    return total;
+}
@@ -0,0 +1,23 @@
+const keys = [];
+for (let i = 0; i < 10000; ++i) keys.push(`key${i}`);
+
+function benchmark() {
+    let total = 0;
+    for (let round = 0; round < 2; ++round) {
+        const map = new Map();
+        const set = new Set();
+        for (let i = 0; i < keys.length; ++i) {
+            map.set(keys[i], i);
+            set.add(i);
+        }
+        for (const key of keys) total += map.get(key);
+        for (const [key, value] of map) total += value;
+        for (let i = 0; i < keys.length; i += 2) {
+            map.delete(keys[i]);
+            set.delete(i);
+        }
+        for (const value of set) total += value;
+        total += map.size + set.size;
+    }
+    return total;
+}
@@ -0,0 +1,22 @@
+// Builds a synthetic bundle in the style of a minified module bundler output, and measures parsing and compiling it.
+const modules = [];
+for (let i = 0; i < 400; ++i) {
+    modules.push(`
+    ${i}: function (module, exports, require) {
+        "use strict";
+        class Component${i} {
+            constructor(props) { this.props = props; this.state = { count: ${i}, items: [] }; }
+            render() { return { type: "div", children: this.state.items.map((item, index) => ({ key: index, text: \`\${item}\` })) }; }
+            async load(url) { const response = await fetch(url); for (const entry of await response.json()) this.state.items.push(entry); }
+        }
+        const helpers = { add: (a, b) => a + b, clamp: (v, lo = 0, hi = 1) => Math.min(hi, Math.max(lo, v)), ...{ id: ${i} } };
+        module.exports = { Component${i}, helpers, value: [${i}, "${i}", { nested: [${i}] }] };
+    },`);
+}
+const source = `const modules = {${modules.join("")}}; return modules;`;
+
+function benchmark() {
+    let total = 0;
+    for (let i = 0; i < 3; ++i) total += Object.keys(new Function(source)()).length;
+    return total;
+}
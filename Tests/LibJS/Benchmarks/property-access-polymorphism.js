@@ -0,0 +1,50 @@
+class Point {
+    constructor(x, y) {
+        this.x = x;
+        this.y = y;
+    }
+
+    get length() {
+        return Math.sqrt(this.x * this.x + this.y * this.y);
+    }
+}
+
+class ColoredPoint extends Point {
+    constructor(x, y, color) {
+        super(x, y);
+        this.color = color;
+    }
+}
+
+const shapes = [];
+for (let i = 0; i < 1000; ++i) {
+    switch (i % 5) {
+    case 0:
+        shapes.push({ x: i, y: i + 1 });
+        break;
+    case 1:
+        shapes.push({ y: i + 1, x: i });
+        break;
+    case 2:
+        shapes.push(new Point(i, i + 1));
+        break;
+    case 3:
+        shapes.push(new ColoredPoint(i, i + 1, "red"));
+        break;
+    case 4:
+        shapes.push(Object.assign(Object.create({ z: 0 }), { x: i, y: i + 1 }));
+        break;
+    }
+}
+
+function benchmark() {
+    let total = 0;
+    for (let round = 0; round < 200; ++round) {
+        for (const shape of shapes) {
+            total += shape.x - shape.y;
+            if ("z" in shape) total += shape.z;
+            if (shape instanceof Point) total += shape.length | 0;
+        }
+    }
+    return total;
+}
@@ -0,0 +1,18 @@
+const lines = [];
+for (let i = 0; i < 5000; ++i)
+    lines.push(`2024-03-${(i % 28) + 1} 12:${i % 60}:00 [${i % 7 === 0 ? "ERROR" : "INFO"}] user${i}@example.com requested /api/v1/items/${i}?page=${i % 10}`);
+const log = lines.join("\n");
+
+const emailPattern = /([a-z0-9]+)@([a-z]+)\.com/g;
+const errorPattern = /^\S+ \S+ \[ERROR\] (.*)$/gm;
+
+function benchmark() {
+    let total = 0;
+    for (let i = 0; i < 5; ++i) {
+        total += log.match(emailPattern).length;
+        for (const match of log.matchAll(errorPattern)) total += match[1].length;
+        total += log.replace(/\d+/g, "#").length;
+        total += log.split(/\s+/).length;
+    }
+    return total;
+}
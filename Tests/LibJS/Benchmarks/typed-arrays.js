@@ -0,0 +1,16 @@
+const size = 1 << 16;
+const input = new Float64Array(size);
+const output = new Float64Array(size);
+const bytes = new Uint8Array(size * 4);
+for (let i = 0; i < size; ++i) input[i] = Math.sin(i);
+
+function benchmark() {
+    let total = 0;
+    for (let round = 0; round < 4; ++round) {
+        for (let i = 1; i < size - 1; ++i) output[i] = (input[i - 1] + input[i] + input[i + 1]) / 3;
+        for (let i = 0; i < bytes.length; ++i) bytes[i] = (bytes[i] + i) & 0xff;
+        total += output[size >> 1] + bytes[size];
+    }
+    total += new Int32Array(output.buffer).subarray(0, 1024).reduce((a, b) => (a + b) | 0, 0);
+    return total;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Keeps calling a function until the profiler has had plenty of chances to take samples in it.
+static constexpr auto busy_script = R"~~~(
+function busy() {
+    let sum = 0;
+    for (let i = 0; i < 1000; ++i)
+        sum += i;
+    return sum;
+}
+
+const start = Date.now();
+while (Date.now() - start < 50)
+    busy();
+)~~~"sv;
+
+static OwnPtr<JS::Bytecode::SamplingProfiler> profile_busy_script(JS::VM& vm, JS::Realm& realm)
+{
+    auto script = MUST(JS::Script::parse(busy_script, realm, "busy.js"sv));
+
+    vm.bytecode_interpreter().start_sampling_profiler(AK::Duration::from_microseconds(100));
+    EXPECT(vm.bytecode_interpreter().is_sampling_profiler_running());
+
+    MUST(vm.bytecode_interpreter().run(*script));
+
+    return vm.bytecode_interpreter().stop_sampling_profiler();
+}
+
+TEST_CASE(stopping_without_starting)
+{
+    auto vm = JS::VM::create();
+    EXPECT(!vm->bytecode_interpreter().stop_sampling_profiler());
+}
+
+TEST_CASE(cpuprofile_format)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+
+    auto profiler = profile_busy_script(*vm, *root_execution_context->realm);
+    VERIFY(profiler);
+    EXPECT(!vm->bytecode_interpreter().is_sampling_profiler_running());
+
+    auto profile = MUST(JsonValue::from_string(profiler->to_cpuprofile_json())).as_object();
+
+    auto const& nodes = profile.get_array("nodes"sv).value();
+    auto const& samples = profile.get_array("samples"sv).value();
+    auto const& time_deltas = profile.get_array("timeDeltas"sv).value();
+
+    EXPECT(!samples.is_empty());
+    EXPECT_EQ(samples.size(), time_deltas.size());
+
+    // Node ids are 1-based, and the first node is the root of the call tree.
+    EXPECT_EQ(nodes.at(0).as_object().get_object("callFrame"sv)->get_string("functionName"sv), "(root)"_string);
+
+    bool has_busy_node = false;
+    size_t total_hit_count = 0;
+    for (auto const& node_value : nodes.values()) {
+        auto const& node = node_value.as_object();
+        total_hit_count += node.get_u64("hitCount"sv).value();
+
+        for (auto const& child : node.get_array("children"sv)->values())
+            EXPECT(child.get_u64().value() >= 1 && child.get_u64().value() <= nodes.size());
+
+        auto const& call_frame = *node.get_object("callFrame"sv);
+        if (call_frame.get_string("functionName"sv) == "busy"_string) {
+            has_busy_node = true;
+            EXPECT_EQ(call_frame.get_string("url"sv), "busy.js"_string);
+            EXPECT_EQ(call_frame.get_i64("lineNumber"sv), 1);
+        }
+    }
+
+    EXPECT(has_busy_node);
+    EXPECT_EQ(total_hit_count, samples.size());
+
+    for (auto const& sample : samples.values())
+        EXPECT(sample.get_u64().value() >= 1 && sample.get_u64().value() <= nodes.size());
+}
+
+TEST_CASE(gecko_profile_format)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+
+    auto profiler = profile_busy_script(*vm, *root_execution_context->realm);
+    VERIFY(profiler);
+
+    auto profile = MUST(JsonValue::from_string(profiler->to_gecko_profile_json())).as_object();
+    EXPECT(profile.get_object("meta"sv)->get_u64("version"sv).has_value());
+
+    auto const& threads = profile.get_array("threads"sv).value();
+    EXPECT_EQ(threads.size(), 1u);
+    auto const& thread = threads.at(0).as_object();
+
+    auto table_data = [&](StringView name) -> JsonArray const& {
+        return thread.get_object(name)->get_array("data"sv).value();
+    };
+
+    auto const& samples = table_data("samples"sv);
+    auto const& stack_table = table_data("stackTable"sv);
+    auto const& frame_table = table_data("frameTable"sv);
+    auto const& string_table = thread.get_array("stringTable"sv).value();
+
+    EXPECT(!samples.is_empty());
+
+    // Every stack only refers to stacks before it, and to existing frames.
+    for (size_t stack_index = 0; stack_index < stack_table.size(); ++stack_index) {
+        auto const& stack = stack_table.at(stack_index).as_array();
+        if (!stack.at(0).is_null())
+            EXPECT(stack.at(0).get_u64().value() < stack_index);
+        EXPECT(stack.at(1).get_u64().value() < frame_table.size());
+    }
+
+    for (auto const& frame : frame_table.values())
+        EXPECT(frame.as_array().at(0).get_u64().value() < string_table.size());
+
+    // Sample times are in milliseconds since the start of the profile, and never go backwards.
+    double previous_time = 0;
+    for (auto const& sample_value : samples.values()) {
+        auto const& sample = sample_value.as_array();
+        if (!sample.at(0).is_null())
+            EXPECT(sample.at(0).get_u64().value() < stack_table.size());
+
+        auto time = sample.at(1).get_double_with_precision_loss().value();
+        EXPECT(time >= previous_time);
+        previous_time = time;
+    }
+
+    EXPECT(any_of(string_table.values(), [](auto const& string) {
+        return string.as_string().starts_with_bytes("busy (busy.js:2:"sv);
+    }));
+}
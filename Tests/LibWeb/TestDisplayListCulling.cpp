@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Utf8View.h>
+#include <LibCore/File.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Font/FontData.h>
+#include <LibGfx/Font/Typeface.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibGfx/TextLayout.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/DisplayListRecorder.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+static constexpr Gfx::IntSize viewport_size { 800, 600 };
+static Gfx::IntRect const viewport_rect { { 0, 0 }, viewport_size };
+
+// Draws nothing, but records how much work a replay did: how many commands were drawn, and how many times the
+// player was asked whether something would be clipped away (once per skippable range and once per command that
+// was not skipped along with a range).
+class CountingPlayer final : public DisplayListPlayer {
+public:
+    size_t draw_count() const { return m_draw_count; }
+    size_t clip_check_count() const { return m_clip_check_count; }
+
+private:
+#define COUNT_DRAW(method, command_type) \
+    virtual void method(command_type const&) override { ++m_draw_count; }
+#define IGNORE_COMMAND(method, command_type) \
+    virtual void method(command_type const&) override { }
+
+    virtual void flush() override { }
+    COUNT_DRAW(draw_glyph_run, DrawGlyphRun)
+    COUNT_DRAW(fill_rect, FillRect)
+    COUNT_DRAW(draw_painting_surface, DrawPaintingSurface)
+    COUNT_DRAW(draw_scaled_immutable_bitmap, DrawScaledImmutableBitmap)
+    COUNT_DRAW(draw_repeated_immutable_bitmap, DrawRepeatedImmutableBitmap)
+    IGNORE_COMMAND(save, Save)
+    IGNORE_COMMAND(save_layer, SaveLayer)
+    IGNORE_COMMAND(restore, Restore)
+    IGNORE_COMMAND(translate, Translate)
+    IGNORE_COMMAND(add_clip_rect, AddClipRect)
+    IGNORE_COMMAND(push_stacking_context, PushStackingContext)
+    IGNORE_COMMAND(pop_stacking_context, PopStackingContext)
+    COUNT_DRAW(paint_linear_gradient, PaintLinearGradient)
+    COUNT_DRAW(paint_radial_gradient, PaintRadialGradient)
+    COUNT_DRAW(paint_conic_gradient, PaintConicGradient)
+    COUNT_DRAW(paint_outer_box_shadow, PaintOuterBoxShadow)
+    COUNT_DRAW(paint_inner_box_shadow, PaintInnerBoxShadow)
+    COUNT_DRAW(paint_text_shadow, PaintTextShadow)
+    COUNT_DRAW(fill_rect_with_rounded_corners, FillRectWithRoundedCorners)
+    COUNT_DRAW(fill_path, FillPath)
+    COUNT_DRAW(stroke_path, StrokePath)
+    COUNT_DRAW(draw_ellipse, DrawEllipse)
+    COUNT_DRAW(fill_ellipse, FillEllipse)
+    COUNT_DRAW(draw_line, DrawLine)
+    COUNT_DRAW(apply_backdrop_filter, ApplyBackdropFilter)
+    COUNT_DRAW(draw_rect, DrawRect)
+    IGNORE_COMMAND(add_rounded_rect_clip, AddRoundedRectClip)
+    IGNORE_COMMAND(add_mask, AddMask)
+    COUNT_DRAW(paint_nested_display_list, PaintNestedDisplayList)
+    COUNT_DRAW(paint_scrollbar, PaintScrollBar)
+    IGNORE_COMMAND(apply_opacity, ApplyOpacity)
+    IGNORE_COMMAND(apply_composite_and_blending_operator, ApplyCompositeAndBlendingOperator)
+    IGNORE_COMMAND(apply_filters, ApplyFilter)
+    IGNORE_COMMAND(apply_transform, ApplyTransform)
+    IGNORE_COMMAND(apply_mask_bitmap, ApplyMaskBitmap)
+
+#undef COUNT_DRAW
+#undef IGNORE_COMMAND
+
+    virtual bool would_be_fully_clipped_by_painter(Gfx::IntRect rect) const override
+    {
+        ++m_clip_check_count;
+        return !rect.intersects(viewport_rect);
+    }
+
+    size_t m_draw_count { 0 };
+    mutable size_t m_clip_check_count { 0 };
+};
+
+static void replay(DisplayListPlayer& player, DisplayList& display_list, ScrollStateSnapshotByDisplayList snapshots = {})
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, viewport_size));
+    player.execute(display_list, move(snapshots), Gfx::PaintingSurface::wrap_bitmap(*bitmap));
+}
+
+// Ahem draws every glyph except the space as a box filling the whole em square, 80% of which is above the baseline.
+static NonnullRefPtr<Gfx::Font> load_ahem(float pixel_size)
+{
+    auto file = MUST(Core::File::open("Text/input/wpt-import/fonts/Ahem.ttf"sv, Core::File::OpenMode::Read));
+    auto font_data = Gfx::FontData::create_from_byte_buffer(MUST(file->read_until_eof()));
+    auto typeface = MUST(Gfx::Typeface::try_load_from_font_data(move(font_data)));
+    return typeface->font(pixel_size * 72 / 96);
+}
+
+static NonnullRefPtr<Gfx::GlyphRun> shape(Gfx::Font const& font, StringView text)
+{
+    return Gfx::shape_text({ 0, 0 }, 0, Utf8View(text), font, Gfx::GlyphRun::TextType::Ltr, {});
+}
+
+TEST_CASE(offscreen_ranges_are_skipped_as_a_whole)
+{
+    auto display_list = DisplayList::create(1);
+    DisplayListRecorder recorder(*display_list);
+    for (int i = 0; i < 200; ++i)
+        recorder.fill_rect({ 0, 1000 + i * 10, 800, 8 }, Color::Red);
+    for (int i = 0; i < 3; ++i)
+        recorder.fill_rect({ 0, i * 10, 800, 8 }, Color::Green);
+
+    EXPECT(!display_list->skippable_ranges().is_empty());
+
+    CountingPlayer player;
+    replay(player, *display_list);
+    EXPECT_EQ(player.draw_count(), 3u);
+    // Checking every command on its own would take 203 checks.
+    EXPECT(player.clip_check_count() < 203u / 4);
+}
+
+TEST_CASE(skipped_ranges_follow_their_scroll_frame)
+{
+    auto display_list = DisplayList::create(1);
+    DisplayListRecorder recorder(*display_list);
+    recorder.push_scroll_frame_id(0);
+    for (int i = 0; i < 150; ++i)
+        recorder.fill_rect({ 0, i * 10, 800, 8 }, Color::Blue);
+    recorder.pop_scroll_frame_id();
+
+    // Scrolled down by 1000 pixels, only the rects starting at 1000 to 1490 are visible.
+    CSSPixelPoint offset { 0, -1000 };
+    ScrollStateSnapshotByDisplayList snapshots;
+    snapshots.set(*display_list, ScrollStateSnapshot::create_from_entries({ { .cumulative_offset = offset, .own_offset = offset } }));
+
+    CountingPlayer player;
+    replay(player, *display_list, move(snapshots));
+    EXPECT_EQ(player.draw_count(), 50u);
+    // The rects scrolled out of view above the viewport are skipped as a whole.
+    EXPECT(player.clip_check_count() < 150u);
+}
+
+TEST_CASE(glyph_run_ink_bounds)
+{
+    auto font = load_ahem(100);
+    auto glyph_run = shape(*font, "XX"sv);
+
+    // Two boxes of 100x100 pixels, from 80 pixels above the baseline to 20 below it.
+    auto ink_rect = glyph_run->ink_bounding_rect(1);
+    EXPECT(ink_rect.contains(Gfx::FloatRect { 1, -79, 198, 98 }));
+    EXPECT(Gfx::FloatRect(-1, -81, 202, 102).contains(ink_rect));
+
+    auto scaled_ink_rect = glyph_run->ink_bounding_rect(2);
+    EXPECT(scaled_ink_rect.contains(Gfx::FloatRect { 2, -158, 396, 196 }));
+    EXPECT(Gfx::FloatRect(-2, -162, 404, 204).contains(scaled_ink_rect));
+
+    EXPECT(shape(*font, " "sv)->ink_bounding_rect(1).is_empty());
+}
+
+// The fragment rects passed along with glyph runs say nothing about where glyphs draw: fonts can draw far outside of
+// their line box. Here the horizontal runs get deliberately tiny ones outside the viewport, while their glyphs are
+// partially visible.
+static NonnullRefPtr<DisplayList> record_glyphs_near_viewport_edges(Gfx::Font const& font)
+{
+    auto glyph_run = shape(font, "XX"sv);
+
+    auto display_list = DisplayList::create(1);
+    DisplayListRecorder recorder(*display_list);
+    // Glyphs from (0, -85) to (200, 15), sticking into the top of the viewport.
+    recorder.draw_glyph_run({ 0, -5 }, *glyph_run, Color::Black, { 0, -100, 200, 5 }, 1, Gfx::Orientation::Horizontal);
+    // Glyphs from (700, 590) to (900, 690), sticking into the bottom right corner of the viewport.
+    recorder.draw_glyph_run({ 700, 670 }, *glyph_run, Color::Black, { 700, 650, 200, 5 }, 1, Gfx::Orientation::Horizontal);
+    // Glyphs rotated into the rect from (700, 300) to (800, 500), against the right edge of the viewport.
+    recorder.draw_glyph_run({ 700, 380 }, *glyph_run, Color::Black, { 700, 300, 100, 200 }, 1, Gfx::Orientation::Vertical);
+    // Glyphs from (300, 620) to (500, 720), entirely below the viewport.
+    recorder.draw_glyph_run({ 300, 700 }, *glyph_run, Color::Black, { 300, 610, 200, 5 }, 1, Gfx::Orientation::Horizontal);
+    return display_list;
+}
+
+TEST_CASE(glyphs_near_viewport_edges_are_drawn)
+{
+    auto font = load_ahem(100);
+    auto display_list = record_glyphs_near_viewport_edges(*font);
+
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, viewport_size));
+    bitmap->fill(Color::White);
+    auto surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+    DisplayListPlayerSkia player;
+    player.execute(*display_list, {}, surface);
+    surface->flush();
+
+    EXPECT_EQ(bitmap->get_pixel(10, 5), Color::Black);
+    EXPECT_EQ(bitmap->get_pixel(195, 10), Color::Black);
+    EXPECT_EQ(bitmap->get_pixel(210, 5), Color::White);
+    EXPECT_EQ(bitmap->get_pixel(750, 595), Color::Black);
+    EXPECT_EQ(bitmap->get_pixel(695, 595), Color::White);
+    EXPECT_EQ(bitmap->get_pixel(750, 310), Color::Black);
+    EXPECT_EQ(bitmap->get_pixel(795, 490), Color::Black);
+    EXPECT_EQ(bitmap->get_pixel(750, 510), Color::White);
+}
+
+TEST_CASE(offscreen_glyphs_are_culled)
+{
+    auto font = load_ahem(100);
+    auto display_list = record_glyphs_near_viewport_edges(*font);
+
+    CountingPlayer player;
+    replay(player, *display_list);
+    EXPECT_EQ(player.draw_count(), 3u);
+}
+
+}
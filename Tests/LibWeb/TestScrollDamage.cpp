@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/DisplayListRecorder.h>
+#include <LibWeb/Painting/ScrollState.h>
+#include <LibWeb/Painting/TileRasterizer.h>
+
+namespace Web::Painting {
+
+static constexpr Gfx::IntSize surface_size { 800, 600 };
+static constexpr int viewport_scroll_frame_id = 0;
+static constexpr int nested_scroll_frame_id = 1;
+static constexpr int sticky_scroll_frame_id = 2;
+
+// Where the sticky box sits in the document, and how far from the top of the viewport it sticks.
+static constexpr int sticky_box_top = 100;
+static constexpr int sticky_box_inset = 40;
+
+// The page scrolls by 2000 - 600 pixels at most, and the nested scroll container by 580 - 200 pixels.
+static NonnullRefPtr<DisplayList> record_page()
+{
+    auto display_list = DisplayList::create(1);
+    DisplayListRecorder recorder(*display_list);
+
+    recorder.push_scroll_frame_id(viewport_scroll_frame_id);
+    recorder.fill_rect({ 0, 0, 800, 2000 }, Color::White);
+    for (int i = 0; i < 20; ++i)
+        recorder.fill_rect_with_rounded_corners({ 20 + (i % 5) * 150, 50 + i * 97, 120, 70 }, Color(i * 12, 100, 255 - i * 12), 15);
+    recorder.fill_ellipse({ 450, 700, 300, 200 }, Color::Red);
+
+    // A scroll container with a scrollbar. Its content scrolls with the page and with the container itself.
+    recorder.fill_rect({ 95, 295, 210, 210 }, Color::Black);
+    recorder.save();
+    recorder.add_clip_rect({ 100, 300, 200, 200 });
+    recorder.fill_rect({ 100, 300, 200, 200 }, Color::LightGray);
+    recorder.push_scroll_frame_id(nested_scroll_frame_id);
+    for (int i = 0; i < 6; ++i)
+        recorder.fill_rect_with_rounded_corners({ 110, 310 + i * 95, 170, 80 }, Color(255 - i * 20, i * 30, 60), 20);
+    recorder.pop_scroll_frame_id();
+    recorder.restore();
+    recorder.paint_scrollbar(nested_scroll_frame_id, { 290, 300, 10, 200 }, { 290, 300, 10, 70 }, CSSPixelFraction(200, 580), Color::DarkGray, Color::MidGray, true);
+    recorder.pop_scroll_frame_id();
+
+    // A sticky box, which scrolls with the page until it reaches its inset from the top of the viewport.
+    recorder.push_scroll_frame_id(sticky_scroll_frame_id);
+    recorder.fill_rect_with_rounded_corners({ 350, sticky_box_top, 400, 60 }, Color::Blue, 10);
+    recorder.pop_scroll_frame_id();
+
+    // A fixed header and footer, which never scroll.
+    recorder.fill_rect({ 0, 0, 800, 30 }, Color::Yellow);
+    recorder.fill_ellipse({ 20, 5, 20, 20 }, Color::Magenta);
+    recorder.fill_rect_with_rounded_corners({ 600, 560, 180, 30 }, Color::Cyan, 8);
+
+    return display_list;
+}
+
+static ScrollStateSnapshot scroll_state(int page_scroll_top, int nested_scroll_top)
+{
+    CSSPixelPoint page_offset { 0, -page_scroll_top };
+    CSSPixelPoint nested_offset { 0, -nested_scroll_top };
+    CSSPixelPoint sticky_offset { 0, max(0, page_scroll_top - (sticky_box_top - sticky_box_inset)) };
+
+    return ScrollStateSnapshot::create_from_entries({
+        { .cumulative_offset = page_offset, .own_offset = page_offset },
+        { .cumulative_offset = page_offset + nested_offset, .own_offset = nested_offset },
+        { .cumulative_offset = page_offset + sticky_offset, .own_offset = sticky_offset },
+    });
+}
+
+static ScrollStateSnapshotByDisplayList snapshots_for(DisplayList& display_list, ScrollStateSnapshot const& scroll_state)
+{
+    ScrollStateSnapshotByDisplayList snapshots;
+    snapshots.set(display_list, scroll_state);
+    return snapshots;
+}
+
+static size_t count_differing_pixels(Gfx::Bitmap const& bitmap, Gfx::Bitmap const& expected)
+{
+    size_t count = 0;
+    for (int y = 0; y < bitmap.height(); ++y) {
+        for (int x = 0; x < bitmap.width(); ++x) {
+            if (bitmap.get_pixel(x, y) != expected.get_pixel(x, y))
+                ++count;
+        }
+    }
+    return count;
+}
+
+struct Frame {
+    NonnullRefPtr<Gfx::Bitmap> bitmap;
+    NonnullRefPtr<Gfx::PaintingSurface> surface;
+};
+
+static Frame create_frame()
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, surface_size));
+    auto surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+    return { move(bitmap), move(surface) };
+}
+
+static Frame repaint_fully(DisplayList& display_list, ScrollStateSnapshot const& scroll_state)
+{
+    auto frame = create_frame();
+    DisplayListPlayerSkia player;
+    player.execute(display_list, snapshots_for(display_list, scroll_state), frame.surface);
+    frame.surface->flush();
+    return frame;
+}
+
+// Scrolls from one state to the other the way the rendering thread does, and checks that the result is the same as
+// repainting the whole frame. Returns the area that had to be repainted, in pixels.
+static size_t scroll_and_compare_with_full_repaint(ScrollStateSnapshot const& previous_scroll_state, ScrollStateSnapshot const& scroll_state)
+{
+    auto display_list = record_page();
+    auto previous_frame = repaint_fully(*display_list, previous_scroll_state);
+    auto expected_frame = repaint_fully(*display_list, scroll_state);
+
+    auto frame = create_frame();
+    auto damage = display_list->compute_scroll_damage(previous_scroll_state, scroll_state, frame.surface->rect());
+    EXPECT(damage.has_value());
+    if (!damage.has_value())
+        return 0;
+
+    EXPECT(frame.surface->copy_pixels_from(*previous_frame.surface, damage->offset));
+    TileRasterizer rasterizer { 2 };
+    rasterizer.rasterize(*display_list, snapshots_for(*display_list, scroll_state), *frame.surface, damage->rects);
+
+    EXPECT_EQ(count_differing_pixels(*frame.bitmap, *expected_frame.bitmap), 0u);
+
+    size_t damaged_area = 0;
+    for (auto const& rect : damage->rects)
+        damaged_area += static_cast<size_t>(rect.width()) * rect.height();
+    return damaged_area;
+}
+
+TEST_CASE(page_scroll_with_fixed_content)
+{
+    // Stays short of the sticky box's inset, so only the page and its fixed content are involved.
+    scroll_and_compare_with_full_repaint(scroll_state(0, 0), scroll_state(50, 0));
+    scroll_and_compare_with_full_repaint(scroll_state(50, 0), scroll_state(10, 0));
+}
+
+TEST_CASE(page_scroll_with_sticky_content)
+{
+    // The sticky box starts to stick halfway through.
+    scroll_and_compare_with_full_repaint(scroll_state(30, 0), scroll_state(90, 0));
+    // The sticky box stays stuck.
+    scroll_and_compare_with_full_repaint(scroll_state(200, 0), scroll_state(320, 0));
+    scroll_and_compare_with_full_repaint(scroll_state(320, 0), scroll_state(260, 0));
+}
+
+TEST_CASE(page_scroll_with_scrolled_nested_content)
+{
+    // The nested scroll container keeps its own offset, so its content moves along with the page.
+    scroll_and_compare_with_full_repaint(scroll_state(100, 150), scroll_state(180, 150));
+}
+
+TEST_CASE(nested_scroll)
+{
+    // Only the content of the nested scroll container and its scrollbar thumb have to be repainted.
+    auto damaged_area = scroll_and_compare_with_full_repaint(scroll_state(0, 0), scroll_state(0, 120));
+    EXPECT(damaged_area < static_cast<size_t>(surface_size.width()) * surface_size.height() / 2);
+
+    scroll_and_compare_with_full_repaint(scroll_state(250, 120), scroll_state(250, 40));
+}
+
+TEST_CASE(page_and_nested_scroll_at_once)
+{
+    scroll_and_compare_with_full_repaint(scroll_state(20, 0), scroll_state(40, 300));
+}
+
+TEST_CASE(unchanged_scroll_state_needs_no_repaint)
+{
+    auto damaged_area = scroll_and_compare_with_full_repaint(scroll_state(140, 60), scroll_state(140, 60));
+    EXPECT_EQ(damaged_area, 0u);
+}
+
+}
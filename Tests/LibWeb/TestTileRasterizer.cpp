@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/DisplayListRecorder.h>
+#include <LibWeb/Painting/TileRasterizer.h>
+
+namespace Web::Painting {
+
+// Deliberately not a multiple of the tile size, so that the last row and column of tiles are cut off.
+static constexpr Gfx::IntSize surface_size { 1300, 1100 };
+static Gfx::IntRect const whole_surface { { 0, 0 }, surface_size };
+static constexpr Color background_color = Color::Magenta;
+
+// Records content that crosses tile boundaries in every way we can think of: anti-aliased edges, clips, and a nested
+// display list that spans several tiles.
+static NonnullRefPtr<DisplayList> record_display_list()
+{
+    auto nested_display_list = DisplayList::create(1);
+    {
+        DisplayListRecorder recorder(*nested_display_list);
+        recorder.fill_rect({ 0, 0, 300, 300 }, Color::Cyan);
+        recorder.fill_ellipse({ 20, 20, 260, 260 }, Color::DarkBlue);
+    }
+
+    auto display_list = DisplayList::create(1);
+    DisplayListRecorder recorder(*display_list);
+    recorder.fill_rect(whole_surface, Color::White);
+
+    for (int i = 0; i < 12; ++i) {
+        Gfx::IntRect rect { 37 + i * 103, 11 + i * 89, 211, 157 };
+        recorder.fill_rect_with_rounded_corners(rect, Color(20 * i, 255 - 20 * i, 128, 200), 31);
+    }
+
+    recorder.fill_ellipse({ 400, 400, 250, 230 }, Color::Red);
+    recorder.draw_line({ 0, 1099 }, { 1299, 0 }, Color::Black, 3);
+
+    Gfx::Path path;
+    path.move_to({ 500.5f, 10.25f });
+    path.line_to({ 1250.75f, 700.5f });
+    path.line_to({ 300.25f, 1050.75f });
+    path.close();
+    recorder.fill_path({ .path = move(path), .opacity = 0.5f, .paint_style_or_color = Color::Green });
+
+    recorder.save();
+    recorder.add_clip_rect({ 480, 480, 70, 600 });
+    recorder.fill_rect_with_rounded_corners({ 100, 500, 1100, 100 }, Color::Blue, 40);
+    recorder.restore();
+
+    recorder.save();
+    recorder.paint_nested_display_list(nested_display_list, { 360, 360, 300, 300 });
+    recorder.restore();
+
+    return display_list;
+}
+
+static NonnullRefPtr<Gfx::Bitmap> create_bitmap()
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, surface_size));
+    bitmap->fill(background_color);
+    return bitmap;
+}
+
+static NonnullRefPtr<Gfx::Bitmap> rasterize_in_single_pass(DisplayList& display_list)
+{
+    auto bitmap = create_bitmap();
+    auto surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+    DisplayListPlayerSkia player;
+    player.execute(display_list, {}, surface);
+    surface->flush();
+    return bitmap;
+}
+
+static NonnullRefPtr<Gfx::Bitmap> rasterize_in_tiles(DisplayList& display_list, size_t worker_count, Vector<Gfx::IntRect> const& regions)
+{
+    auto bitmap = create_bitmap();
+    auto surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+    TileRasterizer rasterizer { worker_count };
+    rasterizer.rasterize(display_list, {}, *surface, regions);
+    return bitmap;
+}
+
+static size_t count_differing_pixels(Gfx::Bitmap const& bitmap, Gfx::Bitmap const& expected, Gfx::IntRect rect)
+{
+    size_t count = 0;
+    for (int y = rect.top(); y < rect.bottom(); ++y) {
+        for (int x = rect.left(); x < rect.right(); ++x) {
+            if (bitmap.get_pixel(x, y) != expected.get_pixel(x, y))
+                ++count;
+        }
+    }
+    return count;
+}
+
+TEST_CASE(tiled_output_matches_single_pass_output)
+{
+    auto display_list = record_display_list();
+    EXPECT(display_list->can_be_rasterized_in_tiles());
+
+    auto expected = rasterize_in_single_pass(*display_list);
+
+    // Without workers, the calling thread rasterizes every tile by itself.
+    for (size_t worker_count : { 0, 1, 3 }) {
+        auto bitmap = rasterize_in_tiles(*display_list, worker_count, { whole_surface });
+        EXPECT_EQ(count_differing_pixels(*bitmap, *expected, whole_surface), 0u);
+    }
+}
+
+TEST_CASE(tiled_output_is_stable_across_frames)
+{
+    auto display_list = record_display_list();
+    auto expected = rasterize_in_single_pass(*display_list);
+
+    // Reusing a rasterizer (and so its worker threads and players) for several frames must not change the output.
+    TileRasterizer rasterizer { 3 };
+    for (int frame = 0; frame < 5; ++frame) {
+        auto bitmap = create_bitmap();
+        auto surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+        rasterizer.rasterize(*display_list, {}, *surface, { whole_surface });
+        EXPECT_EQ(count_differing_pixels(*bitmap, *expected, whole_surface), 0u);
+    }
+}
+
+TEST_CASE(only_given_regions_are_rasterized)
+{
+    auto display_list = record_display_list();
+    auto expected = rasterize_in_single_pass(*display_list);
+
+    Vector<Gfx::IntRect> regions {
+        { 0, 0, surface_size.width(), 40 },
+        { 450, 300, 700, 600 },
+        { 1299, 1099, 1, 1 },
+    };
+    auto bitmap = rasterize_in_tiles(*display_list, 2, regions);
+
+    for (auto const& region : regions)
+        EXPECT_EQ(count_differing_pixels(*bitmap, *expected, region), 0u);
+
+    // Everything outside the regions still has the pixels the surface had before.
+    EXPECT_EQ(bitmap->get_pixel(10, 100), background_color);
+    EXPECT_EQ(bitmap->get_pixel(449, 500), background_color);
+    EXPECT_EQ(bitmap->get_pixel(1150, 500), background_color);
+    EXPECT_EQ(bitmap->get_pixel(600, 900), background_color);
+}
+
+}
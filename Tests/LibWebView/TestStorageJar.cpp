@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/QuickSort.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/StorageAPI/StorageEndpoint.h>
+#include <LibWebView/StorageJar.h>
+
+using WebView::StorageEndpointType;
+using WebView::StorageOperationError;
+
+static auto const storage_key = "https://example.com"_string;
+
+TEST_CASE(update_items_with_prefixes)
+{
+    auto storage_jar = WebView::StorageJar::create();
+
+    HashMap<String, Optional<String>> items;
+    items.set("a/1"_string, "one"_string);
+    items.set("a/2"_string, "two"_string);
+    items.set("ab"_string, "three"_string);
+    items.set("b/1"_string, "four"_string);
+    EXPECT_EQ(storage_jar->update_items(StorageEndpointType::IndexedDB, storage_key, {}, items), StorageOperationError::None);
+
+    auto items_with_prefix = storage_jar->get_items_with_prefix(StorageEndpointType::IndexedDB, storage_key, "a/"_string);
+    EXPECT_EQ(items_with_prefix.size(), 2u);
+    EXPECT_EQ(items_with_prefix.get("a/1"_string), "one"_string);
+    EXPECT_EQ(items_with_prefix.get("a/2"_string), "two"_string);
+
+    EXPECT_EQ(storage_jar->get_items_with_prefix(StorageEndpointType::IndexedDB, storage_key, String {}).size(), 4u);
+
+    // Prefixes are removed before the items of the batch are set.
+    HashMap<String, Optional<String>> more_items;
+    more_items.set("a/3"_string, "five"_string);
+    more_items.set("b/1"_string, {});
+    EXPECT_EQ(storage_jar->update_items(StorageEndpointType::IndexedDB, storage_key, { "a/"_string }, more_items), StorageOperationError::None);
+
+    auto keys = storage_jar->get_all_keys(StorageEndpointType::IndexedDB, storage_key);
+    quick_sort(keys);
+    EXPECT_EQ(keys, (Vector<String> { "a/3"_string, "ab"_string }));
+}
+
+TEST_CASE(get_keys_with_prefix_and_items)
+{
+    auto storage_jar = WebView::StorageJar::create();
+
+    HashMap<String, Optional<String>> items;
+    items.set("a/1"_string, "one"_string);
+    items.set("a/2"_string, "two"_string);
+    items.set("b/1"_string, "three"_string);
+    EXPECT_EQ(storage_jar->update_items(StorageEndpointType::IndexedDB, storage_key, {}, items), StorageOperationError::None);
+
+    auto keys = storage_jar->get_keys_with_prefix(StorageEndpointType::IndexedDB, storage_key, "a/"_string);
+    quick_sort(keys);
+    EXPECT_EQ(keys, (Vector<String> { "a/1"_string, "a/2"_string }));
+
+    // Values are returned in the order of the requested keys, with nothing for keys that don't exist.
+    Vector<String> requested_keys { "b/1"_string, "a/3"_string, "a/1"_string };
+    auto values = storage_jar->get_items(StorageEndpointType::IndexedDB, storage_key, requested_keys);
+    EXPECT_EQ(values, (Vector<Optional<String>> { "three"_string, {}, "one"_string }));
+}
+
+TEST_CASE(update_items_enforces_quota)
+{
+    auto storage_jar = WebView::StorageJar::create();
+    auto quota = Web::StorageAPI::StorageEndpoint::LOCAL_STORAGE_QUOTA;
+
+    auto large_value = MUST(String::repeated('x', quota / 2));
+
+    HashMap<String, Optional<String>> items;
+    items.set("first"_string, large_value);
+    EXPECT_EQ(storage_jar->update_items(StorageEndpointType::LocalStorage, storage_key, {}, items), StorageOperationError::None);
+
+    // A batch that would exceed the quota is rejected as a whole.
+    HashMap<String, Optional<String>> too_many_items;
+    too_many_items.set("second"_string, large_value);
+    too_many_items.set("small"_string, "value"_string);
+    EXPECT_EQ(storage_jar->update_items(StorageEndpointType::LocalStorage, storage_key, {}, too_many_items), StorageOperationError::QuotaExceededError);
+    EXPECT(!storage_jar->get_item(StorageEndpointType::LocalStorage, storage_key, "small"_string).has_value());
+    EXPECT(!storage_jar->get_item(StorageEndpointType::LocalStorage, storage_key, "second"_string).has_value());
+
+    // Items that are replaced or removed in the same batch don't count towards the quota.
+    HashMap<String, Optional<String>> replacing_items;
+    replacing_items.set("first"_string, {});
+    replacing_items.set("second"_string, large_value);
+    EXPECT_EQ(storage_jar->update_items(StorageEndpointType::LocalStorage, storage_key, {}, replacing_items), StorageOperationError::None);
+    EXPECT_EQ(storage_jar->get_item(StorageEndpointType::LocalStorage, storage_key, "second"_string), large_value);
+
+    // Endpoints without a quota accept any amount of data.
+    HashMap<String, Optional<String>> indexed_db_items;
+    indexed_db_items.set("first"_string, large_value);
+    indexed_db_items.set("second"_string, large_value);
+    indexed_db_items.set("third"_string, large_value);
+    EXPECT_EQ(storage_jar->update_items(StorageEndpointType::IndexedDB, storage_key, {}, indexed_db_items), StorageOperationError::None);
+}
+
+TEST_CASE(advance_counter)
+{
+    auto storage_jar = WebView::StorageJar::create();
+    auto counter = "counter"_string;
+
+    // A counter that doesn't exist yet holds 0.
+    EXPECT_EQ(storage_jar->advance_counter(StorageEndpointType::IndexedDB, storage_key, counter, 1, 1), 1u);
+    EXPECT_EQ(storage_jar->advance_counter(StorageEndpointType::IndexedDB, storage_key, counter, 1, 1), 2u);
+    EXPECT_EQ(storage_jar->get_item(StorageEndpointType::IndexedDB, storage_key, counter), "3"_string);
+
+    // A larger minimum moves the counter forward, a smaller one doesn't move it back.
+    EXPECT_EQ(storage_jar->advance_counter(StorageEndpointType::IndexedDB, storage_key, counter, 10, 0), 10u);
+    EXPECT_EQ(storage_jar->advance_counter(StorageEndpointType::IndexedDB, storage_key, counter, 5, 0), 10u);
+    EXPECT_EQ(storage_jar->advance_counter(StorageEndpointType::IndexedDB, storage_key, counter, 1, 1), 10u);
+    EXPECT_EQ(storage_jar->advance_counter(StorageEndpointType::IndexedDB, storage_key, counter, 1, 1), 11u);
+}
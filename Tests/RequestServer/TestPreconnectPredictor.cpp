@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibFileSystem/TempFile.h>
+#include <LibURL/Parser.h>
+#include <RequestServer/PreconnectPredictor.h>
+
+using RequestServer::PreconnectPredictor;
+
+static auto const site = "https://example.com"_string;
+static auto const cdn_origin = "https://cdn.example.net"_string;
+static auto const fonts_origin = "https://fonts.example.org"_string;
+static auto const ads_origin = "https://ads.example.org"_string;
+
+// Predictors persist through a timer, so they need an event loop, and each test gets its own file to persist to.
+struct TestPredictor {
+    TestPredictor()
+        : directory(MUST(FileSystem::TempFile::create_temp_directory()))
+        , path(ByteString::formatted("{}/preconnect-predictions.json", directory->path()))
+    {
+    }
+
+    PreconnectPredictor create() const { return PreconnectPredictor { path }; }
+
+    JsonObject read_persisted_json() const
+    {
+        auto file = MUST(Core::File::open(path, Core::File::OpenMode::Read));
+        auto json = MUST(JsonValue::from_string(MUST(file->read_until_eof())));
+        return json.as_object();
+    }
+
+    Core::EventLoop event_loop;
+    NonnullOwnPtr<FileSystem::TempFile> directory;
+    ByteString path;
+};
+
+static void navigate(PreconnectPredictor& predictor, String const& site, Vector<String> const& used_origins)
+{
+    (void)predictor.did_start_navigation(site);
+    for (auto const& origin : used_origins)
+        predictor.did_use_origin(site, origin);
+}
+
+static Vector<String> serialized_origins(Vector<URL::URL> const& urls)
+{
+    Vector<String> origins;
+    for (auto const& url : urls)
+        origins.append(url.origin().serialize());
+    return origins;
+}
+
+TEST_CASE(site_for_url)
+{
+    auto site_for = [](StringView url) { return PreconnectPredictor::site_for_url(URL::Parser::basic_parse(url).release_value()); };
+
+    EXPECT_EQ(site_for("https://www.example.com/index.html"sv), "https://example.com"_string);
+    EXPECT_EQ(site_for("http://news.example.co.uk/"sv), "http://example.co.uk"_string);
+    EXPECT_EQ(site_for("http://127.0.0.1:8080/"sv), "http://127.0.0.1"_string);
+    EXPECT(!site_for("file:///home/user/index.html"sv).has_value());
+}
+
+TEST_CASE(first_navigation_predicts_nothing)
+{
+    TestPredictor test;
+    auto predictor = test.create();
+
+    auto prediction = predictor.did_start_navigation(site);
+    EXPECT(prediction.origins_to_connect.is_empty());
+    EXPECT(prediction.origins_to_resolve.is_empty());
+}
+
+TEST_CASE(origins_used_by_half_of_the_navigations_are_connected_to)
+{
+    TestPredictor test;
+    auto predictor = test.create();
+
+    navigate(predictor, site, { cdn_origin, fonts_origin, ads_origin });
+    navigate(predictor, site, { cdn_origin, fonts_origin });
+    navigate(predictor, site, { cdn_origin });
+    navigate(predictor, site, { cdn_origin });
+
+    // Of four navigations, the CDN was used by all, the fonts by two and the ads by one.
+    auto prediction = predictor.did_start_navigation(site);
+    EXPECT_EQ(serialized_origins(prediction.origins_to_connect), (Vector<String> { cdn_origin, fonts_origin }));
+    EXPECT_EQ(serialized_origins(prediction.origins_to_resolve), (Vector<String> { ads_origin }));
+
+    // Predictions are per site.
+    prediction = predictor.did_start_navigation("https://example.org"_string);
+    EXPECT(prediction.origins_to_connect.is_empty());
+    EXPECT(prediction.origins_to_resolve.is_empty());
+}
+
+TEST_CASE(origins_for_unknown_sites_are_ignored)
+{
+    TestPredictor test;
+    auto predictor = test.create();
+
+    predictor.did_use_origin(site, cdn_origin);
+    navigate(predictor, site, {});
+
+    auto prediction = predictor.did_start_navigation(site);
+    EXPECT(prediction.origins_to_connect.is_empty());
+    EXPECT(prediction.origins_to_resolve.is_empty());
+}
+
+TEST_CASE(counts_decay_over_time)
+{
+    TestPredictor test;
+    auto predictor = test.create();
+
+    navigate(predictor, site, { cdn_origin, ads_origin });
+    for (u32 i = 1; i < PreconnectPredictor::navigation_count_decay_threshold - 1; ++i)
+        navigate(predictor, site, { cdn_origin });
+
+    // The ads were only used once, but are remembered until the counts decay...
+    auto prediction = predictor.did_start_navigation(site);
+    EXPECT_EQ(serialized_origins(prediction.origins_to_connect), (Vector<String> { cdn_origin }));
+    EXPECT_EQ(serialized_origins(prediction.origins_to_resolve), (Vector<String> { ads_origin }));
+    predictor.did_use_origin(site, cdn_origin);
+
+    // ...which halves them, and forgets the ones that drop to zero.
+    prediction = predictor.did_start_navigation(site);
+    EXPECT_EQ(serialized_origins(prediction.origins_to_connect), (Vector<String> { cdn_origin }));
+    EXPECT(prediction.origins_to_resolve.is_empty());
+
+    predictor.persist_if_needed();
+    auto persisted = test.read_persisted_json();
+    auto persisted_site = persisted.get_object(site).value();
+    EXPECT_EQ(persisted_site.get_u32("navigationCount"sv).value(), PreconnectPredictor::navigation_count_decay_threshold / 2 + 1);
+    EXPECT(persisted_site.get_object("origins"sv)->has(cdn_origin));
+    EXPECT(!persisted_site.get_object("origins"sv)->has(ads_origin));
+}
+
+TEST_CASE(least_recently_navigated_site_is_evicted)
+{
+    TestPredictor test;
+
+    // Start out with as many sites as the predictor remembers, each navigated to a second after the previous one.
+    JsonObject json;
+    for (size_t i = 0; i < PreconnectPredictor::max_site_count; ++i) {
+        JsonObject origins;
+        origins.set(cdn_origin, 1);
+
+        JsonObject object;
+        object.set("navigationCount"sv, 1);
+        object.set("lastNavigationTime"sv, static_cast<i64>(1'000'000 + i));
+        object.set("origins"sv, move(origins));
+        json.set(MUST(String::formatted("https://site{}.example", i)), move(object));
+    }
+    {
+        auto file = MUST(Core::File::open(test.path, Core::File::OpenMode::Write));
+        MUST(file->write_until_depleted(json.serialized()));
+    }
+
+    auto predictor = test.create();
+    EXPECT_EQ(serialized_origins(predictor.did_start_navigation("https://site0.example"_string).origins_to_connect), (Vector<String> { cdn_origin }));
+
+    // Site 0 was just navigated to, so site 1 is now the least recently navigated one.
+    navigate(predictor, site, { cdn_origin });
+    predictor.persist_if_needed();
+
+    auto persisted = test.read_persisted_json();
+    EXPECT_EQ(persisted.size(), PreconnectPredictor::max_site_count);
+    EXPECT(persisted.has(site));
+    EXPECT(persisted.has("https://site0.example"sv));
+    EXPECT(!persisted.has("https://site1.example"sv));
+    EXPECT(persisted.has("https://site2.example"sv));
+}
+
+TEST_CASE(predictions_survive_a_restart)
+{
+    TestPredictor test;
+
+    {
+        auto predictor = test.create();
+        navigate(predictor, site, { cdn_origin, fonts_origin });
+        navigate(predictor, site, { cdn_origin });
+        navigate(predictor, site, { cdn_origin });
+        predictor.persist_if_needed();
+    }
+
+    // Nothing is left behind but the predictions themselves.
+    EXPECT(FileSystem::exists(test.path));
+    EXPECT(!FileSystem::exists(ByteString::formatted("{}.tmp", test.path)));
+
+    auto predictor = test.create();
+    auto prediction = predictor.did_start_navigation(site);
+    EXPECT_EQ(serialized_origins(prediction.origins_to_connect), (Vector<String> { cdn_origin }));
+    EXPECT_EQ(serialized_origins(prediction.origins_to_resolve), (Vector<String> { fonts_origin }));
+}
+
+TEST_CASE(malformed_predictions_are_ignored_and_replaced)
+{
+    TestPredictor test;
+    {
+        // Much longer than the predictions that replace it, which must not have any of its bytes left behind.
+        StringBuilder builder;
+        builder.append("{\"https://example.com\": {\"navigationCount\": 3, \"origins\": {"sv);
+        for (size_t i = 0; i < 1000; ++i)
+            builder.appendff("\"https://origin{}.example\": 1, ", i);
+        auto file = MUST(Core::File::open(test.path, Core::File::OpenMode::Write));
+        MUST(file->write_until_depleted(builder.string_view()));
+    }
+
+    auto predictor = test.create();
+    auto prediction = predictor.did_start_navigation(site);
+    EXPECT(prediction.origins_to_connect.is_empty());
+    EXPECT(prediction.origins_to_resolve.is_empty());
+
+    predictor.did_use_origin(site, cdn_origin);
+    predictor.persist_if_needed();
+
+    auto persisted = test.read_persisted_json();
+    EXPECT_EQ(persisted.size(), 1u);
+    EXPECT_EQ(persisted.get_object(site)->get_object("origins"sv)->size(), 1u);
+}
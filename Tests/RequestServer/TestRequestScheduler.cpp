@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Vector.h>
+#include <RequestServer/RequestScheduler.h>
+
+using RequestServer::RequestPriority;
+using RequestServer::RequestScheduler;
+
+static auto const origin = "https://example.com"_string;
+static auto const other_origin = "https://example.org"_string;
+
+struct TestScheduler {
+    TestScheduler()
+        : scheduler([this](i32 request_id) { started_requests.append(request_id); })
+    {
+    }
+
+    void finish(i32 request_id)
+    {
+        scheduler.did_finish(request_id);
+        scheduler.start_queued_requests();
+    }
+
+    Vector<i32> started_requests;
+    RequestScheduler scheduler;
+};
+
+TEST_CASE(medium_and_higher_priority_requests_start_right_away)
+{
+    TestScheduler test;
+
+    for (i32 request_id = 1; request_id <= 10; ++request_id)
+        test.scheduler.schedule(request_id, origin, RequestPriority::Highest);
+    for (i32 request_id = 11; request_id <= 20; ++request_id)
+        test.scheduler.schedule(request_id, origin, RequestPriority::High);
+    for (i32 request_id = 21; request_id <= 30; ++request_id)
+        test.scheduler.schedule(request_id, origin, RequestPriority::Medium);
+
+    EXPECT_EQ(test.started_requests.size(), 30u);
+    EXPECT_EQ(test.scheduler.origin_statistics().get(origin)->queued_request_count, 0u);
+}
+
+TEST_CASE(low_priority_requests_are_capped_per_origin)
+{
+    TestScheduler test;
+
+    for (i32 request_id = 1; request_id <= 8; ++request_id)
+        test.scheduler.schedule(request_id, origin, RequestPriority::Low);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2, 3, 4, 5, 6 }));
+
+    // The cap is per origin.
+    test.scheduler.schedule(9, other_origin, RequestPriority::Low);
+    EXPECT_EQ(test.started_requests.size(), 7u);
+    EXPECT_EQ(test.started_requests.last(), 9);
+
+    // Finishing a request makes room for one queued request to the same origin.
+    test.finish(3);
+    EXPECT_EQ(test.started_requests.size(), 8u);
+    EXPECT_EQ(test.started_requests.last(), 7);
+
+    test.finish(9);
+    EXPECT_EQ(test.started_requests.size(), 8u);
+
+    test.finish(1);
+    EXPECT_EQ(test.started_requests.size(), 9u);
+    EXPECT_EQ(test.started_requests.last(), 8);
+
+    auto statistics = test.scheduler.origin_statistics().get(origin).value();
+    EXPECT_EQ(statistics.request_count, 8u);
+    EXPECT_EQ(statistics.queued_request_count, 2u);
+}
+
+TEST_CASE(render_blocking_requests_lower_the_low_priority_cap)
+{
+    TestScheduler test;
+
+    test.scheduler.schedule(1, origin, RequestPriority::Highest);
+    for (i32 request_id = 2; request_id <= 5; ++request_id)
+        test.scheduler.schedule(request_id, origin, RequestPriority::Low);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2, 3 }));
+
+    // Once nothing is render-blocking any more, the full cap applies again.
+    test.finish(1);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2, 3, 4, 5 }));
+}
+
+TEST_CASE(prefetches_wait_for_render_blocking_requests)
+{
+    TestScheduler test;
+
+    test.scheduler.schedule(1, origin, RequestPriority::Highest);
+    test.scheduler.schedule(2, other_origin, RequestPriority::Highest);
+    test.scheduler.schedule(3, origin, RequestPriority::Lowest);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2 }));
+
+    // A render-blocking request to any origin holds back prefetches.
+    test.finish(1);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2 }));
+
+    test.finish(2);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2, 3 }));
+
+    // Only one prefetch is in flight to an origin at a time.
+    test.scheduler.schedule(4, origin, RequestPriority::Lowest);
+    test.scheduler.schedule(5, other_origin, RequestPriority::Lowest);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2, 3, 5 }));
+
+    test.finish(3);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2, 3, 5, 4 }));
+}
+
+TEST_CASE(queued_requests_start_in_order_of_priority)
+{
+    TestScheduler test;
+
+    test.scheduler.schedule(1, origin, RequestPriority::Highest);
+    test.scheduler.schedule(2, origin, RequestPriority::Low);
+    test.scheduler.schedule(3, origin, RequestPriority::Low);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2, 3 }));
+
+    test.scheduler.schedule(4, origin, RequestPriority::Lowest);
+    test.scheduler.schedule(5, origin, RequestPriority::Low);
+    test.scheduler.schedule(6, origin, RequestPriority::Low);
+    test.scheduler.schedule(7, origin, RequestPriority::Lowest);
+    EXPECT_EQ(test.started_requests.size(), 3u);
+
+    // Low priority requests go before prefetches that were queued earlier, and requests of the same priority keep the
+    // order in which they were scheduled.
+    test.finish(1);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2, 3, 5, 6, 4 }));
+
+    test.finish(4);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 2, 3, 5, 6, 4, 7 }));
+}
+
+TEST_CASE(cancelled_requests_leave_the_queue)
+{
+    TestScheduler test;
+
+    test.scheduler.schedule(1, origin, RequestPriority::Highest);
+    test.scheduler.schedule(2, origin, RequestPriority::Lowest);
+    test.scheduler.schedule(3, origin, RequestPriority::Lowest);
+
+    test.scheduler.did_finish(2);
+    test.finish(1);
+    EXPECT_EQ(test.started_requests, (Vector<i32> { 1, 3 }));
+}
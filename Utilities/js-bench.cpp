@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <AK/Math.h>
+#include <AK/QuickSort.h>
+#include <AK/ScopeGuard.h>
+#include <AK/Time.h>
+#include <LibCore/ArgsParser.h>
+#include <LibCore/DirIterator.h>
+#include <LibCore/Environment.h>
+#include <LibCore/File.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/Script.h>
+#include <LibMain/Main.h>
+
+class BenchmarkGlobalObject final : public JS::GlobalObject {
+    JS_OBJECT(BenchmarkGlobalObject, JS::GlobalObject);
+
+public:
+    explicit BenchmarkGlobalObject(JS::Realm& realm)
+        : JS::GlobalObject(realm)
+    {
+    }
+    virtual ~BenchmarkGlobalObject() override = default;
+};
+
+struct Options {
+    size_t warmup_iterations { 3 };
+    size_t iterations { 10 };
+};
+
+struct SummaryStatistics {
+    double mean { 0 };
+    double standard_deviation { 0 };
+    double median { 0 };
+    double min { 0 };
+    double max { 0 };
+
+    // Half the width of the 95% confidence interval of the mean.
+    double confidence_interval { 0 };
+};
+
+struct Counters {
+    GC::Heap::Statistics heap;
+    JS::Bytecode::Interpreter::Statistics interpreter;
+};
+
+struct WorkloadResult {
+    ByteString name;
+    double parse_milliseconds { 0 };
+    double setup_milliseconds { 0 };
+    Vector<double> sample_milliseconds;
+    SummaryStatistics statistics;
+    JsonObject counters;
+};
+
+// Two-sided 95% critical values of Student's t-distribution, by degrees of freedom.
+static double students_t_critical_value(size_t degrees_of_freedom)
+{
+    static constexpr Array<double, 30> critical_values {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+    if (degrees_of_freedom == 0)
+        return 0;
+    if (degrees_of_freedom <= critical_values.size())
+        return critical_values[degrees_of_freedom - 1];
+    return 1.960;
+}
+
+static SummaryStatistics summarize(Vector<double> samples)
+{
+    VERIFY(!samples.is_empty());
+    quick_sort(samples);
+
+    SummaryStatistics statistics;
+    auto count = static_cast<double>(samples.size());
+
+    double sum = 0;
+    for (auto sample : samples)
+        sum += sample;
+    statistics.mean = sum / count;
+
+    if (samples.size() > 1) {
+        double sum_of_squares = 0;
+        for (auto sample : samples)
+            sum_of_squares += (sample - statistics.mean) * (sample - statistics.mean);
+        statistics.standard_deviation = AK::sqrt(sum_of_squares / (count - 1));
+    }
+
+    auto middle = samples.size() / 2;
+    statistics.median = samples.size() % 2 == 0 ? (samples[middle - 1] + samples[middle]) / 2 : samples[middle];
+    statistics.min = samples.first();
+    statistics.max = samples.last();
+    statistics.confidence_interval = students_t_critical_value(samples.size() - 1) * statistics.standard_deviation / AK::sqrt(count);
+    return statistics;
+}
+
+static double milliseconds_since(MonotonicTime start_time)
+{
+    return static_cast<double>((MonotonicTime::now() - start_time).to_nanoseconds()) / 1'000'000.0;
+}
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+}
+
+static Counters capture_counters(JS::VM& vm)
+{
+    return { vm.heap().statistics(), vm.bytecode_interpreter().statistics() };
+}
+
+static JsonObject counters_between(Counters const& before, Counters const& after, size_t iterations)
+{
+    JsonObject heap;
+    heap.set("allocated_cells"sv, after.heap.allocated_cells - before.heap.allocated_cells);
+    heap.set("allocated_bytes"sv, after.heap.allocated_bytes - before.heap.allocated_bytes);
+    heap.set("collections"sv, after.heap.collections - before.heap.collections);
+    heap.set("marking_ms"sv, to_milliseconds(after.heap.time_spent_marking - before.heap.time_spent_marking));
+    heap.set("sweeping_ms"sv, to_milliseconds(after.heap.time_spent_sweeping - before.heap.time_spent_sweeping));
+
+    JsonObject interpreter;
+    interpreter.set("executables_compiled"sv, after.interpreter.executables_compiled - before.interpreter.executables_compiled);
+    interpreter.set("compiling_ms"sv, to_milliseconds(after.interpreter.time_spent_compiling - before.interpreter.time_spent_compiling));
+    interpreter.set("executables_run"sv, after.interpreter.executables_run - before.interpreter.executables_run);
+    interpreter.set("get_by_id_cache_misses"sv, after.interpreter.get_by_id_cache_misses - before.interpreter.get_by_id_cache_misses);
+
+    JsonObject counters;
+    counters.set("iterations"sv, iterations);
+    counters.set("heap"sv, move(heap));
+    counters.set("interpreter"sv, move(interpreter));
+    return counters;
+}
+
+static Optional<WorkloadResult> run_workload(JS::VM& vm, ByteString const& path, Options const& options)
+{
+    auto name = LexicalPath::title(path);
+
+    auto file_or_error = Core::File::open(path, Core::File::OpenMode::Read);
+    if (file_or_error.is_error()) {
+        warnln("{}: Unable to open: {}", name, file_or_error.error());
+        return {};
+    }
+    auto source_or_error = file_or_error.value()->read_until_eof();
+    if (source_or_error.is_error()) {
+        warnln("{}: Unable to read: {}", name, source_or_error.error());
+        return {};
+    }
+    auto source = source_or_error.release_value();
+
+    // Every workload gets a fresh realm, so that they can't affect each other through their globals.
+    auto root_execution_context = JS::create_simple_execution_context<BenchmarkGlobalObject>(vm);
+    ScopeGuard pop_execution_context = [&] { vm.pop_execution_context(); };
+    auto& realm = *root_execution_context->realm;
+
+    WorkloadResult result;
+    result.name = name;
+
+    auto parse_start_time = MonotonicTime::now();
+    auto script_or_error = JS::Script::parse(source, realm, path);
+    result.parse_milliseconds = milliseconds_since(parse_start_time);
+    if (script_or_error.is_error()) {
+        warnln("{}: {}", name, script_or_error.error()[0].to_string());
+        return {};
+    }
+
+    auto setup_start_time = MonotonicTime::now();
+    auto setup_result = vm.bytecode_interpreter().run(*script_or_error.value());
+    result.setup_milliseconds = milliseconds_since(setup_start_time);
+    if (setup_result.is_error()) {
+        warnln("{}: Uncaught exception during setup: {}", name, setup_result.release_error().value());
+        return {};
+    }
+
+    auto benchmark_function = realm.global_object().get_without_side_effects("benchmark"_utf16_fly_string);
+    if (!benchmark_function.is_function()) {
+        warnln("{}: Does not define a benchmark() function", name);
+        return {};
+    }
+
+    auto run_once = [&]() -> bool {
+        auto call_result = JS::call(vm, benchmark_function, JS::js_undefined());
+        if (call_result.is_error()) {
+            warnln("{}: Uncaught exception: {}", name, call_result.release_error().value());
+            return false;
+        }
+        return true;
+    };
+
+    for (size_t i = 0; i < options.warmup_iterations; ++i) {
+        if (!run_once())
+            return {};
+    }
+
+    auto counters_before = capture_counters(vm);
+    for (size_t i = 0; i < options.iterations; ++i) {
+        auto start_time = MonotonicTime::now();
+        if (!run_once())
+            return {};
+        result.sample_milliseconds.append(milliseconds_since(start_time));
+    }
+    auto counters_after = capture_counters(vm);
+
+    result.statistics = summarize(result.sample_milliseconds);
+    result.counters = counters_between(counters_before, counters_after, options.iterations);
+    return result;
+}
+
+static JsonObject to_json(WorkloadResult const& result)
+{
+    JsonArray samples;
+    for (auto sample : result.sample_milliseconds)
+        samples.must_append(sample);
+
+    JsonObject json;
+    json.set("name"sv, result.name.view());
+    json.set("parse_ms"sv, result.parse_milliseconds);
+    json.set("setup_ms"sv, result.setup_milliseconds);
+    json.set("mean_ms"sv, result.statistics.mean);
+    json.set("stddev_ms"sv, result.statistics.standard_deviation);
+    json.set("median_ms"sv, result.statistics.median);
+    json.set("min_ms"sv, result.statistics.min);
+    json.set("max_ms"sv, result.statistics.max);
+    json.set("ci95_ms"sv, result.statistics.confidence_interval);
+    json.set("samples_ms"sv, move(samples));
+    json.set("counters"sv, result.counters);
+    return json;
+}
+
+enum class Verdict {
+    Unchanged,
+    Improvement,
+    Regression,
+};
+
+static StringView verdict_name(Verdict verdict)
+{
+    switch (verdict) {
+    case Verdict::Unchanged:
+        return "unchanged"sv;
+    case Verdict::Improvement:
+        return "improvement"sv;
+    case Verdict::Regression:
+        return "regression"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// A change only counts if it exceeds the threshold, and the confidence intervals of both runs don't overlap.
+static Verdict compare_to_baseline(SummaryStatistics const& current, double baseline_mean, double baseline_confidence_interval, double threshold_percent, double& change_percent)
+{
+    change_percent = (current.mean - baseline_mean) / baseline_mean * 100;
+
+    if (change_percent > threshold_percent && current.mean - current.confidence_interval > baseline_mean + baseline_confidence_interval)
+        return Verdict::Regression;
+    if (change_percent < -threshold_percent && current.mean + current.confidence_interval < baseline_mean - baseline_confidence_interval)
+        return Verdict::Improvement;
+    return Verdict::Unchanged;
+}
+
+static ErrorOr<JsonObject> load_baseline(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+    auto json = TRY(JsonValue::from_string(contents));
+    if (!json.is_object())
+        return Error::from_string_literal("Baseline is not a JSON object");
+
+    JsonObject workloads_by_name;
+    if (auto benchmarks = json.as_object().get_array("benchmarks"sv); benchmarks.has_value()) {
+        benchmarks->for_each([&](JsonValue const& benchmark) {
+            if (!benchmark.is_object())
+                return;
+            if (auto name = benchmark.as_object().get_string("name"sv); name.has_value())
+                workloads_by_name.set(*name, benchmark);
+        });
+    }
+    return workloads_by_name;
+}
+
+static ErrorOr<Vector<ByteString>> collect_workload_paths(Vector<ByteString> const& paths, StringView filter)
+{
+    Vector<ByteString> workload_paths;
+    for (auto const& path : paths) {
+        if (!FileSystem::is_directory(path)) {
+            workload_paths.append(path);
+            continue;
+        }
+
+        Vector<ByteString> paths_in_directory;
+        Core::DirIterator iterator(path, Core::DirIterator::Flags::SkipDots);
+        while (iterator.has_next()) {
+            auto name = iterator.next_path();
+            if (name.ends_with(".js"sv))
+                paths_in_directory.append(LexicalPath::join(path, name).string());
+        }
+        if (iterator.has_error())
+            return iterator.error();
+
+        quick_sort(paths_in_directory);
+        workload_paths.extend(move(paths_in_directory));
+    }
+
+    if (!filter.is_empty())
+        workload_paths.remove_all_matching([&](auto const& path) { return !LexicalPath::title(path).contains(filter); });
+    return workload_paths;
+}
+
+ErrorOr<int> ladybird_main(Main::Arguments arguments)
+{
+    Vector<ByteString> paths;
+    Options options;
+    StringView filter;
+    StringView output_path;
+    StringView baseline_path;
+    double threshold_percent = 5;
+
+    Core::ArgsParser args_parser;
+    args_parser.set_general_help("Run the LibJS benchmark workloads, and report their timings and engine counters as JSON.");
+    args_parser.add_option(options.warmup_iterations, "Untimed iterations to run before measuring (default: 3)", "warmup", 'w', "count");
+    args_parser.add_option(options.iterations, "Timed iterations to run (default: 10)", "iterations", 'n', "count");
+    args_parser.add_option(filter, "Only run workloads whose name contains this", "filter", 'f', "name");
+    args_parser.add_option(output_path, "Write the JSON results to this file instead of standard output", "output", 'o', "path");
+    args_parser.add_option(baseline_path, "Compare the results to a previous --output, and fail on regressions", "baseline", 'b', "path");
+    args_parser.add_option(threshold_percent, "Slowdown in percent to consider a regression (default: 5)", "threshold", 't', "percent");
+    args_parser.add_positional_argument(paths, "Workload files, or directories of them (default: Tests/LibJS/Benchmarks)", "paths", Core::ArgsParser::Required::No);
+    args_parser.parse(arguments);
+
+    if (options.iterations == 0) {
+        warnln("At least one iteration is required");
+        return 1;
+    }
+
+    if (paths.is_empty()) {
+        auto ladybird_source_dir = Core::Environment::get("LADYBIRD_SOURCE_DIR"sv);
+        if (!ladybird_source_dir.has_value()) {
+            warnln("No workloads given, js-bench requires the LADYBIRD_SOURCE_DIR environment variable to be set");
+            return 1;
+        }
+        paths.append(LexicalPath::join(*ladybird_source_dir, "Tests/LibJS/Benchmarks"sv).string());
+    }
+
+    auto workload_paths = TRY(collect_workload_paths(paths, filter));
+    if (workload_paths.is_empty()) {
+        warnln("No workloads to run");
+        return 1;
+    }
+
+    Optional<JsonObject> baseline;
+    if (!baseline_path.is_empty())
+        baseline = TRY(load_baseline(baseline_path));
+
+    auto vm = JS::VM::create();
+
+    JsonArray benchmarks;
+    bool any_workload_failed = false;
+    bool any_regression = false;
+
+    for (auto const& path : workload_paths) {
+        auto result = run_workload(*vm, path, options);
+        if (!result.has_value()) {
+            any_workload_failed = true;
+            continue;
+        }
+
+        auto json = to_json(*result);
+        auto const& statistics = result->statistics;
+        warn("{:32} {:10.3f} ms ± {:8.3f} ms", result->name, statistics.mean, statistics.confidence_interval);
+
+        if (baseline.has_value()) {
+            auto baseline_result = baseline->get_object(result->name);
+            auto baseline_mean = baseline_result.has_value() ? baseline_result->get_double_with_precision_loss("mean_ms"sv) : Optional<double> {};
+            auto baseline_confidence_interval = baseline_result.has_value() ? baseline_result->get_double_with_precision_loss("ci95_ms"sv) : Optional<double> {};
+
+            if (baseline_mean.has_value() && *baseline_mean > 0) {
+                double change_percent = 0;
+                auto verdict = compare_to_baseline(statistics, *baseline_mean, baseline_confidence_interval.value_or(0), threshold_percent, change_percent);
+                if (verdict == Verdict::Regression)
+                    any_regression = true;
+
+                JsonObject comparison;
+                comparison.set("baseline_mean_ms"sv, *baseline_mean);
+                comparison.set("baseline_ci95_ms"sv, baseline_confidence_interval.value_or(0));
+                comparison.set("change_percent"sv, change_percent);
+                comparison.set("verdict"sv, verdict_name(verdict));
+                json.set("comparison"sv, move(comparison));
+
+                warn("  {:+7.2f}% {}", change_percent, verdict_name(verdict));
+            } else {
+                warn("  (not in baseline)");
+            }
+        }
+        warnln();
+
+        benchmarks.must_append(move(json));
+    }
+
+    JsonObject results;
+    results.set("warmup"sv, options.warmup_iterations);
+    results.set("iterations"sv, options.iterations);
+    results.set("benchmarks"sv, move(benchmarks));
+    auto serialized_results = results.serialized();
+
+    if (output_path.is_empty()) {
+        outln("{}", serialized_results);
+    } else {
+        auto file = TRY(Core::File::open(output_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        TRY(file->write_until_depleted(serialized_results.bytes()));
+    }
+
+    if (any_workload_failed)
+        return 1;
+    return any_regression ? 1 : 0;
+}
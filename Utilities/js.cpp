@@ -817,6 +817,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool disable_debug_printing = false;
     bool use_test262_global = false;
     StringView evaluate_script;
+    StringView cpu_profile_path;
     Vector<StringView> script_paths;
 
     Core::ArgsParser args_parser;
@@ -833,6 +834,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
+    args_parser.add_option(cpu_profile_path, "Write a sampling CPU profile of the scripts to the given file", "cpu-profile", {}, "path");
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -915,9 +917,19 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             source_name = "eval"sv;
         }
 
+        if (!cpu_profile_path.is_empty())
+            g_vm->bytecode_interpreter().start_sampling_profiler();
+
         // We resolve modules as if it is the first file
+        auto succeeded = TRY(parse_and_run(realm, builder.string_view(), source_name));
+
+        if (!cpu_profile_path.is_empty()) {
+            auto profile = g_vm->bytecode_interpreter().stop_sampling_profiler()->to_cpuprofile_json();
+            auto file = TRY(Core::File::open(cpu_profile_path, Core::File::OpenMode::Write, 0666));
+            TRY(file->write_until_depleted(profile.bytes()));
+        }
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
+        if (!succeeded)
             return 1;
     }
 